@@ -0,0 +1,35 @@
+#ifndef __LIBMATH__ALIGNED_H__
+#define __LIBMATH__ALIGNED_H__
+
+#include <cstddef>
+#include <type_traits>
+
+namespace LibMath
+{
+    /**
+     * \brief Over-aligned variant of a math type (e.g. to allow aligned SIMD loads and streaming stores)
+     * \tparam Base The aligned type
+     * \tparam Alignment The required alignment in bytes
+     * \note The aligned variant has the same layout and operations as its base type and converts implicitly from and to it.
+     * Operations inherited from the base type return base type values
+     */
+    template <class Base, size_t Alignment = 16>
+    class alignas(Alignment) TAligned : public Base
+    {
+        static_assert(Alignment >= alignof(Base), "Invalid alignment - should be at least the type's natural alignment");
+        static_assert(std::is_trivially_copyable_v<Base> && std::is_standard_layout_v<Base>,
+            "Invalid aligned type - base type should be trivially copyable and standard layout");
+
+    public:
+        using Base::Base;
+
+        constexpr TAligned() = default;
+
+        constexpr TAligned(const Base& other)
+            : Base(other)
+        {
+        }
+    };
+}
+
+#endif // !__LIBMATH__ALIGNED_H__
@@ -1,6 +1,9 @@
 #ifndef __LIBMATH__ANGLE__DEGREE_H__
 #define __LIBMATH__ANGLE__DEGREE_H__
 #include <iostream>
+#include <type_traits>
+
+#include "Format.h"
 
 namespace LibMath
 {
@@ -11,12 +14,12 @@ namespace LibMath
     public:
         constexpr          Degree();
         constexpr explicit Degree(float); // explicit so no ambiguous / implicit conversion from float to angle can happen
-        constexpr          Degree(const Degree&);
+        constexpr          Degree(const Degree&) = default;
         ~Degree() = default;
 
         constexpr operator Radian() const; // Radian angle = Degree{0.5};		// implicit conversion from Degree to Radian
 
-        constexpr Degree& operator=(const Degree&);
+        constexpr Degree& operator=(const Degree&) = default;
         constexpr Degree& operator+=(const Degree&); // Degree angle += Degree{45};
         constexpr Degree& operator-=(const Degree&); // Degree angle -= Degree{45};
         constexpr Degree& operator*=(float);         // Degree angle *= 3;
@@ -72,12 +75,50 @@ namespace LibMath
      */
     inline std::istream& operator>>(std::istream& stream, Degree& degrees);
 
+    /**
+     * \brief Writes the degrees' raw value to the given buffer without allocating
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param degrees The degrees to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    inline std::to_chars_result formatTo(char* first, char* last, Degree degrees);
+
+    /**
+     * \brief Parses degrees from the start of the given text. Leading whitespace is skipped
+     * \param text The text to parse
+     * \param degrees The output degrees. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    inline std::from_chars_result parse(std::string_view text, Degree& degrees);
+
     inline namespace Literal
     {
         constexpr Degree operator""_deg(long double);            // Degree angle = 7.5_deg;
         constexpr Degree operator""_deg(unsigned long long int); // Degree angle = 45_deg;
     }
+
+    static_assert(std::is_trivially_copyable_v<Degree> && std::is_standard_layout_v<Degree>,
+        "Invalid Degree - should be trivially copyable and standard layout");
+}
+
+#ifdef __cpp_lib_format
+namespace std
+{
+    /**
+     * \brief Formats degrees as their raw value, with the float format specification
+     */
+    template <>
+    struct formatter<LibMath::Degree, char> : formatter<float, char>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::Degree& degrees, FormatContext& context) const
+        {
+            return formatter<float, char>::format(degrees.raw(), context);
+        }
+    };
 }
+#endif // __cpp_lib_format
 
 #include "Degree.inl"
 
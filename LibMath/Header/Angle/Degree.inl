@@ -16,25 +16,11 @@ namespace LibMath
     {
     }
 
-    constexpr Degree::Degree(const Degree& other) : Degree(other.m_value)
-    {
-    }
-
     constexpr Degree::operator Radian() const
     {
         return Radian(m_value * g_deg2Rad);
     }
 
-    constexpr Degree& Degree::operator=(const Degree& other)
-    {
-        if (this == &other)
-            return *this;
-
-        this->m_value = other.m_value;
-
-        return *this;
-    }
-
     constexpr Degree& Degree::operator+=(const Degree& angle)
     {
         this->m_value += angle.m_value;
@@ -180,6 +166,17 @@ namespace LibMath
         return stream;
     }
 
+    inline std::to_chars_result formatTo(char* first, char* last, const Degree degrees)
+    {
+        return Details::formatComponent(first, last, degrees);
+    }
+
+    inline std::from_chars_result parse(const std::string_view text, Degree& degrees)
+    {
+        const char* first = Details::skipWhitespace(text.data(), text.data() + text.size());
+        return Details::parseComponent(first, text.data() + text.size(), degrees);
+    }
+
     constexpr Degree Literal::operator ""_deg(const long double angle)
     {
         return Degree(static_cast<float>(angle));
@@ -1,6 +1,9 @@
 #ifndef __LIBMATH__ANGLE__RADIAN_H__
 #define __LIBMATH__ANGLE__RADIAN_H__
 #include <iostream>
+#include <type_traits>
+
+#include "Format.h"
 
 namespace LibMath
 {
@@ -11,12 +14,12 @@ namespace LibMath
     public:
         constexpr          Radian();
         constexpr explicit Radian(float); // explicit so no ambiguous / implicit conversion from float to angle can happen
-        constexpr          Radian(const Radian&);
+        constexpr          Radian(const Radian&) = default;
         ~Radian() = default;
 
         constexpr operator Degree() const; // Degree angle = Radian{0.5};		// implicit conversion from Radian to Degree
 
-        constexpr Radian& operator=(const Radian&);
+        constexpr Radian& operator=(const Radian&) = default;
         constexpr Radian& operator+=(const Radian&); // Radian angle += Radian{0.5};
         constexpr Radian& operator-=(const Radian&); // Radian angle -= Radian{0.5};
         constexpr Radian& operator*=(float);         // Radian angle *= 3;
@@ -72,12 +75,50 @@ namespace LibMath
      */
     inline std::istream& operator>>(std::istream& stream, Radian& radian);
 
+    /**
+     * \brief Writes the radian's raw value to the given buffer without allocating
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param radian The radian to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    inline std::to_chars_result formatTo(char* first, char* last, Radian radian);
+
+    /**
+     * \brief Parses a radian from the start of the given text. Leading whitespace is skipped
+     * \param text The text to parse
+     * \param radian The output radian. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    inline std::from_chars_result parse(std::string_view text, Radian& radian);
+
     inline namespace Literal
     {
         constexpr Radian operator""_rad(long double);            // Radian angle = 0.5_rad;
         constexpr Radian operator""_rad(unsigned long long int); // Radian angle = 1_rad;
     }
+
+    static_assert(std::is_trivially_copyable_v<Radian> && std::is_standard_layout_v<Radian>,
+        "Invalid Radian - should be trivially copyable and standard layout");
+}
+
+#ifdef __cpp_lib_format
+namespace std
+{
+    /**
+     * \brief Formats radians as their raw value, with the float format specification
+     */
+    template <>
+    struct formatter<LibMath::Radian, char> : formatter<float, char>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::Radian& radian, FormatContext& context) const
+        {
+            return formatter<float, char>::format(radian.raw(), context);
+        }
+    };
 }
+#endif // __cpp_lib_format
 
 #include "Radian.inl"
 
@@ -16,25 +16,11 @@ namespace LibMath
     {
     }
 
-    constexpr Radian::Radian(const Radian& other) : Radian(other.m_value)
-    {
-    }
-
     constexpr Radian::operator Degree() const
     {
         return Degree(m_value * g_rad2Deg);
     }
 
-    constexpr Radian& Radian::operator=(const Radian& other)
-    {
-        if (this == &other)
-            return *this;
-
-        this->m_value = other.m_value;
-
-        return *this;
-    }
-
     constexpr Radian& Radian::operator+=(const Radian& angle)
     {
         this->m_value += angle.m_value;
@@ -181,6 +167,17 @@ namespace LibMath
         return stream;
     }
 
+    inline std::to_chars_result formatTo(char* first, char* last, const Radian radian)
+    {
+        return Details::formatComponent(first, last, radian);
+    }
+
+    inline std::from_chars_result parse(const std::string_view text, Radian& radian)
+    {
+        const char* first = Details::skipWhitespace(text.data(), text.data() + text.size());
+        return Details::parseComponent(first, text.data() + text.size(), radian);
+    }
+
     constexpr Radian Literal::operator ""_rad(const long double angle)
     {
         return Radian(static_cast<float>(angle));
@@ -4,10 +4,13 @@
 #include <type_traits>
 #include <cstddef>
 
+#include "EPrecision.h"
+#include "Packet.h"
+
 namespace LibMath
 {
 	template <typename T>
-	using floating_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+	using floating_t = std::conditional_t<std::is_floating_point_v<T> || Details::IS_PACKET<T>, T, double>;
 
 	/**
 	 * \brief Returns the highest integer lower than or equal to the received value
@@ -64,18 +67,32 @@ namespace LibMath
 	constexpr T	wrap(T value, T a, T b);
 
 	/**
-	 * \brief Approximates the square root of a value up to the given precision.
+	 * \brief Computes the square root of a value.
+	 * At runtime, uses the hardware square root (always correctly rounded).
+	 * During constant evaluation, approximates it up to the given precision with babylonian steps.
 	 * \param value The value to compute the square root of
-	 * \param precision The target precision of the computed square root
-	 * \param maxSteps The maximum number of babylonian steps to perform
-	 * \return An approximation of the square root of the given value
+	 * \param precision The target precision of the computed square root (constant evaluation only)
+	 * \param maxSteps The maximum number of babylonian steps to perform (constant evaluation only)
+	 * \return The square root of the given value
 	 */
 	template <typename T>
 	constexpr T squareRoot(T value, floating_t<T> precision = std::numeric_limits<floating_t<T>>::epsilon(),
 		size_t maxSteps = 16);
 
 	/**
-	 * \brief Raises the received value to the given exponent
+	 * \brief Computes 1 / squareRoot(value).
+	 * At runtime, the FAST and BALANCED precisions use the hardware reciprocal square root estimate for floats
+	 * (refined by a Newton-Raphson step for BALANCED) instead of a square root and a division.
+	 * \param value The value to compute the inverse square root of
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return The inverse square root of the given value
+	 */
+	template <typename T>
+	constexpr floating_t<T> inverseSquareRoot(T value, EPrecision precision = EPrecision::PRECISE);
+
+	/**
+	 * \brief Raises the received value to the given exponent, by squaring (one or two multiplications per bit
+	 * of the exponent)
 	 * \param value The value to raise to the given exponent
 	 * \param exponent The exponent to which the value must be raised
 	 * \return The received value raised to the given exponent
@@ -83,6 +100,72 @@ namespace LibMath
     template <typename T>
 	constexpr T	pow(T value, int exponent);
 
+	/**
+	 * \brief Raises the received value to a compile time exponent, by squaring fully unrolled
+	 * (e.g. pow<5>(x) computes x2 = x * x and returns x2 * x2 * x). Also works on packets
+	 * \tparam Exponent The exponent to which the value must be raised
+	 * \param value The value to raise to the given exponent
+	 * \return The received value raised to the given exponent
+	 */
+	template <int Exponent, typename T>
+	constexpr T	pow(T value);
+
+	/**
+	 * \brief Computes e raised to the given power.
+	 * At runtime, PRECISE uses the standard library while FAST (3.6e-6 relative error) and BALANCED (1.5 ulp) evaluate
+	 * a polynomial on the power's fractional part and build the power of 2 of its integer part from its bits.
+	 * Both give exactly 1 for 0.
+	 * The approximations pay off in the batch versions (see ArithmeticBatch.h) - one call at a time, the float versions
+	 * of the usual standard libraries are as fast or faster.
+	 * During constant evaluation, the result is computed with double precision series whatever the precision.
+	 * \param value The power to which e must be raised
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return e raised to the given power
+	 */
+	constexpr float	exp(float value, EPrecision precision = EPrecision::PRECISE);
+
+	/**
+	 * \brief Computes 2 raised to the given power, with the same precision tiers as exp
+	 * \param value The power to which 2 must be raised
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return 2 raised to the given power
+	 */
+	constexpr float	exp2(float value, EPrecision precision = EPrecision::PRECISE);
+
+	/**
+	 * \brief Computes the natural logarithm of the given value.
+	 * At runtime, PRECISE uses the standard library while FAST (1.2e-5 absolute error) and BALANCED (2 ulp, 3 ulp for
+	 * log2) split the value's exponent from its mantissa and evaluate a polynomial on the mantissa. As for exp, the
+	 * approximations pay off in the batch versions.
+	 * During constant evaluation, the result is computed with double precision series whatever the precision.
+	 * \param value The value to compute the logarithm of. Gives -inf for 0 and NaN for negative values
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return The natural logarithm of the given value
+	 */
+	constexpr float	log(float value, EPrecision precision = EPrecision::PRECISE);
+
+	/**
+	 * \brief Computes the base 2 logarithm of the given value, with the same precision tiers as log
+	 * \param value The value to compute the logarithm of. Gives -inf for 0 and NaN for negative values
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return The base 2 logarithm of the given value
+	 */
+	constexpr float	log2(float value, EPrecision precision = EPrecision::PRECISE);
+
+	/**
+	 * \brief Raises the received value to the given real exponent.
+	 * At runtime, PRECISE uses the standard library while FAST and BALANCED compute exp2(exponent * log2(value)),
+	 * whose relative error grows with the exponent : about 4e-6 + 1e-5 * |exponent| for FAST and
+	 * 1e-7 * (1 + |exponent * log2(value)|) for BALANCED. The special values follow std::pow (e.g. pow(-1, inf) is 1
+	 * and pow(-0, -3) is -inf).
+	 * During constant evaluation, the result is computed with double precision series whatever the precision.
+	 * \param value The value to raise to the given exponent. Negative values need an integer exponent (NaN otherwise)
+	 * \param exponent The exponent to which the value must be raised
+	 * \param precision The accuracy/speed trade-off of the computation
+	 * \return The received value raised to the given exponent
+	 */
+	constexpr float	pow(float value, float exponent, EPrecision precision = EPrecision::PRECISE);
+
 	/**
 	 * \brief Returns the smallest of two given values
 	 * \param a The first value
@@ -122,7 +205,7 @@ namespace LibMath
 	 * \param a The first value to check
 	 * \param b The second value to check
 	 * \param scale The comparison's epsilon's scale
-	 * \return True if a can be considered equal to b. False otherwise.
+	 * \return True if a can be considered equal to b (in all their lanes for packets). False otherwise.
 	 */
 	template <typename T>
 	constexpr bool	floatEquals(T a, T b, T scale = T(100));
@@ -132,7 +215,7 @@ namespace LibMath
 	 * \param value The value to check
 	 * \param a The lower bound of the range
 	 * \param b The upper bound of the range
-	 * \return True if the value is between a and b inclusive. False otherwise.
+	 * \return True if the value is between a and b inclusive (in all its lanes for packets). False otherwise.
 	 */
 	template <typename T>
 	constexpr bool	isInRange(T value, T a, T b);
@@ -2,7 +2,10 @@
 #define __LIBMATH__ARITHMETIC_INL__
 
 #include "Arithmetic.h"
+#include "Simd.h"
+#include <bit>
 #include <cmath>
+#include <cstdint>
 
 namespace LibMath
 {
@@ -78,7 +81,10 @@ namespace LibMath
     template <typename T>
     constexpr T snap(T value, T a, T b)
     {
-        return abs(value - a) < abs(value - b) ? a : b;
+        if constexpr (Details::IS_PACKET<T>)
+            return select(abs(value - a) < abs(value - b), a, b);
+        else
+            return abs(value - a) < abs(value - b) ? a : b;
     }
 
     template <typename T>
@@ -95,34 +101,65 @@ namespace LibMath
     template <typename T>
     constexpr T squareRoot(const T value, floating_t<T> precision, const size_t maxSteps)
     {
-        if (value < 0)
-            return static_cast<T>(NAN);
-
-        if (floatEquals<T>(value, static_cast<T>(0)))
-            return static_cast<floating_t<T>>(0);
-
-        if (floatEquals<T>(value, static_cast<T>(1)))
-            return static_cast<floating_t<T>>(1);
-
-        if (floatEquals<floating_t<T>>(precision, static_cast<floating_t<T>>(0)))
-            precision = std::numeric_limits<T>::epsilon();
+        if constexpr (Details::IS_PACKET<T>)
+        {
+            static_cast<void>(precision);
+            static_cast<void>(maxSteps);
+            return Details::packSqrt(value);
+        }
         else
-            precision = abs(precision);
-
-        floating_t<T> sqrt = value >= floating_t<T>(4)
-                                 ? value / floating_t<T>(2)
-                                 : value < floating_t<T>(.5)
-                                       ? floating_t<T>(1) / (1 - value)
-                                       : value < floating_t<T>(1)
-                                             ? floating_t<T>(1) / value
-                                             : floating_t<T>(value);
+        {
+            if (value < 0)
+                return static_cast<T>(NAN);
+
+            if (!std::is_constant_evaluated())
+            {
+                if constexpr (std::is_same_v<T, float>)
+                    return Details::packSqrt(value);
+                else
+                    return static_cast<T>(std::sqrt(static_cast<floating_t<T>>(value)));
+            }
+
+            if (floatEquals<T>(value, static_cast<T>(0)))
+                return static_cast<floating_t<T>>(0);
+
+            if (floatEquals<T>(value, static_cast<T>(1)))
+                return static_cast<floating_t<T>>(1);
+
+            if (floatEquals<floating_t<T>>(precision, static_cast<floating_t<T>>(0)))
+                precision = std::numeric_limits<T>::epsilon();
+            else
+                precision = abs(precision);
+
+            floating_t<T> sqrt = value >= floating_t<T>(4)
+                                     ? value / floating_t<T>(2)
+                                     : value < floating_t<T>(.5)
+                                           ? floating_t<T>(1) / (1 - value)
+                                           : value < floating_t<T>(1)
+                                                 ? floating_t<T>(1) / value
+                                                 : floating_t<T>(value);
+
+            // Keep repeating until the approximation is close enough to the real value
+            for (size_t i = 0; (maxSteps == 0 || i < maxSteps) && abs(sqrt * sqrt - value) > precision; i++)
+                sqrt = .5f * (sqrt + value / sqrt);
+            // Babylonian step - cf. https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Heron's_method
+
+            return sqrt;
+        }
+    }
 
-        // Keep repeating until the approximation is close enough to the real value
-        for (size_t i = 0; (maxSteps == 0 || i < maxSteps) && abs(sqrt * sqrt - value) > precision; i++)
-            sqrt = .5f * (sqrt + value / sqrt);
-        // Babylonian step - cf. https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Heron's_method
+    template <typename T>
+    constexpr floating_t<T> inverseSquareRoot(const T value, const EPrecision precision)
+    {
+        if constexpr (Details::IS_PACKET<T>)
+            return Details::packInverseSqrt(value, precision);
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if (!std::is_constant_evaluated())
+                return Details::packInverseSqrt(value, precision);
+        }
 
-        return sqrt;
+        return static_cast<floating_t<T>>(1) / squareRoot(static_cast<floating_t<T>>(value));
     }
 
     template <typename T>
@@ -136,57 +173,432 @@ namespace LibMath
         if (floatEquals(value, static_cast<T>(1)) || exponent == 0)
             return 1;
 
-        T result;
+        // Negating in unsigned arithmetic keeps INT_MIN valid
+        unsigned int remaining = exponent < 0 ? 0u - static_cast<unsigned int>(exponent) : static_cast<unsigned int>(exponent);
 
-        if (exponent > 0)
+        T result = 1;
+        T power  = value;
+
+        // power is value^(2^i) at the exponent's i-th bit
+        while (true)
         {
-            result = value;
+            if (remaining & 1u)
+                result *= power;
+
+            remaining >>= 1;
 
-            for (int i = 1; i < exponent; i++)
-                result *= value;
+            if (remaining == 0)
+                break;
+
+            power *= power;
+        }
+
+        return exponent < 0 ? static_cast<T>(1) / result : result;
+    }
+
+    template <int Exponent, typename T>
+    constexpr T pow(const T value)
+    {
+        static_assert(Details::IS_SCALAR<T>);
+
+        if constexpr (Exponent < 0)
+        {
+            return T(1) / pow<-Exponent>(value);
+        }
+        else if constexpr (Exponent == 0)
+        {
+            return T(1);
+        }
+        else if constexpr (Exponent == 1)
+        {
+            return value;
         }
         else
         {
-            result = 1.;
+            const T half = pow<Exponent / 2>(value);
+
+            if constexpr (Exponent % 2 == 0)
+                return half * half;
+            else
+                return half * half * value;
+        }
+    }
+
+    namespace Details
+    {
+        constexpr double LN_2      = 0.693147180559945309;
+        constexpr double LOG2_E    = 1.44269504088896341;
+        constexpr double SQRT_2    = 1.41421356237309505;
+        constexpr float  FLOAT_INF = std::numeric_limits<float>::infinity();
+        constexpr float  FLOAT_NAN = std::numeric_limits<float>::quiet_NaN();
+
+        /**
+         * \brief Converts the given double to a float, giving +/-inf instead of undefined behavior out of the float range
+         */
+        constexpr float toFloat(const double value)
+        {
+            constexpr double maxFloat = std::numeric_limits<float>::max();
+
+            if (value > maxFloat)
+                return FLOAT_INF;
+
+            if (value < -maxFloat)
+                return -FLOAT_INF;
+
+            return static_cast<float>(value);
+        }
+
+        /**
+         * \brief Computes e^value or 2^value with a Taylor series on the power's fractional part, for constant evaluation
+         */
+        constexpr double expValue(const double value, const bool isBase2)
+        {
+            if (value != value)
+                return value;
+
+            // Far out of the float range - also stops the scaling loop from running forever on infinities
+            if (value > 1024.)
+                return std::numeric_limits<double>::infinity();
+
+            if (value < -1024.)
+                return 0.;
+
+            const double base2Value = isBase2 ? value : value * LOG2_E;
+            const double exponent   = floor(base2Value + .5);
+            const double reduced    = isBase2 ? (value - exponent) * LN_2 : value - exponent * LN_2;
+
+            double result = 1.;
+            double term   = 1.;
+
+            for (int i = 1; i < 20; i++)
+            {
+                term *= reduced / i;
+                result += term;
+            }
+
+            for (double i = 0.; i < exponent; i++)
+                result *= 2.;
+
+            for (double i = 0.; i > exponent; i--)
+                result *= .5;
+
+            return result;
+        }
+
+        /**
+         * \brief Computes ln(value) or log2(value) with an atanh series on the value's mantissa, for constant evaluation
+         */
+        constexpr double logValue(double value, const bool isBase2)
+        {
+            if (value != value || value < 0.)
+                return std::numeric_limits<double>::quiet_NaN();
+
+            if (value == 0.)
+                return -std::numeric_limits<double>::infinity();
+
+            if (value > std::numeric_limits<double>::max())
+                return value;
+
+            // value = mantissa * 2^exponent with mantissa in [sqrt(2) / 2, sqrt(2)]
+            int exponent = 0;
+
+            for (; value > SQRT_2; exponent++)
+                value *= .5;
+
+            for (; value < SQRT_2 * .5; exponent--)
+                value *= 2.;
+
+            // ln(mantissa) = 2 * atanh(t) = 2 * (t + t^3 / 3 + t^5 / 5 + ...) with t = (mantissa - 1) / (mantissa + 1)
+            const double t    = (value - 1.) / (value + 1.);
+            const double tSqr = t * t;
+
+            double series = 0.;
+            double power  = t;
+
+            for (int i = 1; i < 30; i += 2)
+            {
+                series += power / i;
+                power *= tSqr;
+            }
+
+            return isBase2 ? exponent + 2. * series * LOG2_E : exponent * LN_2 + 2. * series;
+        }
+
+        /**
+         * \brief Computes 2^exponent for integer exponents in [-126, 127] by writing the float's exponent bits
+         */
+        template <class T>
+        T powerOfTwoLanes(const T& exponent)
+        {
+            return floatToIntBitsLanes((exponent + 127.f) * 8388608.f);
+        }
+
+        /**
+         * \brief Computes e^value or 2^value as 2^n * e^r, with n an integer and r in [-ln(2) / 2, ln(2) / 2]
+         * \param value The power. Works on both packets and floats
+         * \param precision FAST or BALANCED
+         * \param isBase2 Whether to compute 2^value instead of e^value
+         */
+        template <class T>
+        T expKernel(const T& value, const EPrecision precision, const bool isBase2)
+        {
+            // ln(2) split in two so that n * ln2Hi is exact
+            constexpr float log2E = 1.44269504088896341f;
+            constexpr float ln2   = .693147180559945309f;
+            constexpr float ln2Hi = .693359375f;
+            constexpr float ln2Lo = -2.12194440e-4f;
+
+            // Beyond these bounds, the result is either 0 or inf. min picks the bound for NaN lanes, restored at the end
+            const T clamped = isBase2 ? max(min(value, T(129.f)), T(-151.f)) : max(min(value, T(89.f)), T(-104.f));
+
+            const T exponent = roundLanes(isBase2 ? clamped : clamped * log2E);
+            const T reduced  = isBase2 ? (clamped - exponent) * ln2 : clamped - exponent * ln2Hi - exponent * ln2Lo;
+
+            // Minimax fits of e^r for the relative error, with a constant term of 1 so that e^0 is exactly 1
+            T result;
+
+            if (precision == EPrecision::FAST)
+            {
+                result = 1.f + reduced * (9.9995155985e-1f + reduced * (4.9995962941e-1f + reduced * (1.6808630620e-1f +
+                    reduced * 4.2380524511e-2f)));
+            }
+            else
+            {
+                result = 1.f + reduced * (1.0000000363e+0f + reduced * (4.9999992080e-1f + reduced *
+                    (1.6666420170e-1f + reduced * (4.1668225570e-2f + reduced * (8.3748158045e-3f + reduced *
+                    1.3836845979e-3f)))));
+            }
+
+            // 2^n is split in two normal powers of 2 to reach the subnormal and overflowing results
+            const T firstExponent = max(min(exponent, T(127.f)), T(-126.f));
+            result = result * powerOfTwoLanes(firstExponent) * powerOfTwoLanes(exponent - firstExponent);
+
+            return selectLanes(value != value, value, result);
+        }
+
+        /**
+         * \brief Computes ln(value) or log2(value) as exponent * ln(2) + ln(mantissa), with the mantissa in
+         * [sqrt(2) / 2, sqrt(2)]
+         * \param value The value. Works on both packets and floats
+         * \param precision FAST or BALANCED
+         * \param isBase2 Whether to compute log2(value) instead of ln(value)
+         */
+        template <class T>
+        T logKernel(const T& value, const EPrecision precision, const bool isBase2)
+        {
+            constexpr float log2E        = 1.44269504088896341f;
+            constexpr float ln2Hi        = .693359375f;
+            constexpr float ln2Lo        = -2.12194440e-4f;
+            constexpr float sqrt2        = 1.41421356237309505f;
+            constexpr float exponentMask = std::bit_cast<float>(0x7F800000u);
+            constexpr float mantissaMask = std::bit_cast<float>(0x007FFFFFu);
+
+            // Subnormal values are scaled by 2^24 to get a normal exponent
+            const auto isSubnormal = value < std::numeric_limits<float>::min();
+            const T    scaled      = selectLanes(isSubnormal, value * 16777216.f, value);
+            const T    bias        = selectLanes(isSubnormal, T(151.f), T(127.f));
+
+            // The exponent's bits, read as an integer, are exactly representable as a float
+            T exponent = intBitsToFloatLanes(bitAndLanes(scaled, T(exponentMask))) * (1.f / 8388608.f) - bias;
+            T mantissa = bitOrLanes(bitAndLanes(scaled, T(mantissaMask)), T(1.f));
+
+            const auto isLarge = mantissa > sqrt2;
+            mantissa = selectLanes(isLarge, mantissa * .5f, mantissa);
+            exponent = selectLanes(isLarge, exponent + 1.f, exponent);
+
+            // ln(mantissa) = 2 * atanh(t) with t = (mantissa - 1) / (mantissa + 1) in [-0.172, 0.172]
+            const T t    = (mantissa - 1.f) / (mantissa + 1.f);
+            const T tSqr = t * t;
+            T       series;
+
+            if (precision == EPrecision::FAST)
+                series = T(6.7710285876e-1f);
+            else
+                series = 6.6666816703e-1f + tSqr * (3.9973603484e-1f + tSqr * 2.9961265066e-1f);
+
+            const T logMantissa = t + t + t * tSqr * series;
+            T       result      = isBase2
+                                      ? exponent + logMantissa * log2E
+                                      : (exponent * ln2Lo + logMantissa) + exponent * ln2Hi;
+
+            result = selectLanes(value > std::numeric_limits<float>::max(), T(FLOAT_INF), result);
+            result = selectLanes(value == T(0.f), T(-FLOAT_INF), result);
+            return selectLanes(!(value >= 0.f), T(FLOAT_NAN), result);
+        }
+
+        /**
+         * \brief Computes value^exponent as 2^(exponent * log2(|value|)), with the sign of negative values raised to
+         * odd integer exponents
+         * \param value The value. Works on both packets and floats
+         * \param exponent The exponent
+         * \param precision FAST or BALANCED
+         */
+        template <class T>
+        T powKernel(const T& value, const T& exponent, const EPrecision precision)
+        {
+            constexpr float oneBits = std::bit_cast<float>(1u);
+
+            T result = expKernel(exponent * logKernel(abs(value), precision, true), precision, true);
+
+            // Floats above 2^24 are all even integers. min and max pick 2^24 for NaN exponents
+            const T    integerExponent = max(min(exponent, T(16777216.f)), T(-16777216.f));
+            const T    integerBits     = floatToIntBitsLanes(integerExponent);
+            const auto isInteger       = intBitsToFloatLanes(integerBits) == integerExponent;
+            const auto isOdd           = intBitsToFloatLanes(bitAndLanes(integerBits, T(oneBits))) > 0.f;
+            // Or-ing 1's bits only keeps the sign bit - also set for -0 (e.g. -0^-3 = -inf)
+            const auto hasSign    = bitOrLanes(value, T(1.f)) < 0.f;
+            const auto isNegative = (value < 0.f) & (value > -FLOAT_INF);
 
-            for (int i = 0; i > exponent; i--)
-                result /= value;
+            result = selectLanes(hasSign & isInteger & isOdd, -result, result);
+            result = selectLanes(isNegative & !isInteger, T(FLOAT_NAN), result);
+
+            // 0 * log2(0) and +/-inf * log2(1) are NaN. Infinite exponents are even, so (-1)^+/-inf is 1 too
+            const auto isOne = (value == T(1.f)) | ((value == T(-1.f)) & (abs(exponent) == T(FLOAT_INF)));
+            return selectLanes((exponent == T(0.f)) | isOne, T(1.f), result);
         }
+    }
+
+    constexpr float exp(const float value, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+            return Details::toFloat(Details::expValue(value, false));
+
+        if (precision == EPrecision::PRECISE)
+            return std::exp(value);
+
+        return Details::expKernel(value, precision, false);
+    }
+
+    constexpr float exp2(const float value, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+            return Details::toFloat(Details::expValue(value, true));
+
+        if (precision == EPrecision::PRECISE)
+            return std::exp2(value);
+
+        return Details::expKernel(value, precision, true);
+    }
+
+    constexpr float log(const float value, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+            return Details::toFloat(Details::logValue(value, false));
+
+        if (precision == EPrecision::PRECISE)
+            return std::log(value);
+
+        return Details::logKernel(value, precision, false);
+    }
+
+    constexpr float log2(const float value, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+            return Details::toFloat(Details::logValue(value, true));
+
+        if (precision == EPrecision::PRECISE)
+            return std::log2(value);
 
-        return result;
+        return Details::logKernel(value, precision, true);
+    }
+
+    constexpr float pow(const float value, const float exponent, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+        {
+            if (exponent == 0.f || value == 1.f || (value == -1.f && abs(exponent) == Details::FLOAT_INF))
+                return 1.f;
+
+            const double absResult = Details::expValue(exponent * Details::logValue(abs(value), true), true);
+
+            // The sign bit is also set for -0 (e.g. -0^-3 = -inf)
+            const bool hasSign = (std::bit_cast<uint32_t>(value) >> 31) != 0u;
+
+            if (!hasSign || absResult != absResult)
+                return Details::toFloat(absResult);
+
+            // Floats above 2^24 are all even integers
+            if (abs(exponent) >= 16777216.f)
+                return Details::toFloat(absResult);
+
+            const float integerPart = floor(exponent);
+
+            // Finite negative values are only defined for integer exponents
+            if (integerPart != exponent)
+                return value == 0.f || value == -Details::FLOAT_INF ? Details::toFloat(absResult) : Details::FLOAT_NAN;
+
+            return Details::toFloat(floor(integerPart * .5f) * 2.f == integerPart ? absResult : -absResult);
+        }
+
+        if (precision == EPrecision::PRECISE)
+            return std::pow(value, exponent);
+
+        return Details::powKernel(value, exponent, precision);
     }
 
     template <typename T>
     constexpr T min(T a, T b)
     {
-        return a < b ? a : b;
+        if constexpr (Details::IS_PACKET<T>)
+            return Details::packMin(a, b);
+        else
+            return a < b ? a : b;
     }
 
     template <typename T>
     constexpr T max(T a, T b)
     {
-        return a > b ? a : b;
+        if constexpr (Details::IS_PACKET<T>)
+            return Details::packMax(a, b);
+        else
+            return a > b ? a : b;
     }
 
     template <typename T>
     constexpr T abs(const T value)
     {
-        static_assert(std::is_arithmetic_v<T>);
-        return value < 0 ? -value : value;
+        static_assert(Details::IS_SCALAR<T>);
+
+        if constexpr (Details::IS_PACKET<T>)
+            return Details::packAbs(value);
+        else
+            return value < 0 ? -value : value;
     }
 
     template <typename T>
     constexpr T sign(const T value)
     {
-        static_assert(std::is_arithmetic_v<T>);
-        return static_cast<T>(value < 0 ? -1 : 1);
+        static_assert(Details::IS_SCALAR<T>);
+
+        if constexpr (Details::IS_PACKET<T>)
+            return select(value < 0, T(-1), T(1));
+        else
+            return static_cast<T>(value < 0 ? -1 : 1);
+    }
+
+    namespace Details
+    {
+        /**
+         * \brief Lane by lane floatEquals - the mask of the packets' lanes that can be considered equal
+         */
+        template <typename T>
+        auto floatEqualLanes(const T a, const T b, const T scale = T(100))
+        {
+            const T maxXYOne = max(max(T(1), abs(a)), abs(b));
+
+            return abs(a - b) <= std::numeric_limits<typename T::value_type>::epsilon() * scale * maxXYOne;
+        }
     }
 
     // adapted from https://stackoverflow.com/a/15012792
     template <typename T>
     constexpr bool floatEquals(const T a, const T b, const T scale)
     {
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (Details::IS_PACKET<T>)
+        {
+            return all(Details::floatEqualLanes(a, b, scale));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
         {
             const T maxXYOne = max(max(static_cast<T>(1), abs(a)), abs(b));
 
@@ -204,7 +616,10 @@ namespace LibMath
         const T minVal = min(a, b);
         const T maxVal = max(a, b);
 
-        return minVal <= value && value <= maxVal;
+        if constexpr (Details::IS_PACKET<T>)
+            return all((minVal <= value) & (value <= maxVal));
+        else
+            return minVal <= value && value <= maxVal;
     }
 }
 
@@ -0,0 +1,171 @@
+#ifndef __LIBMATH__ARITHMETICBATCH_INL__
+#define __LIBMATH__ARITHMETICBATCH_INL__
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include "Arithmetic.h"
+#include "ArithmeticBatch.h"
+#include "Batch.h"
+#include "Packet.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        /**
+         * \brief Computes out[i] = func(values[i]) for the values in [begin, end)
+         * \param func The computed function. Processes whole packets if it accepts them, one float at a time otherwise
+         */
+        template <class Func>
+        void mapRange(const float* values, float* out, size_t begin, const size_t end, Func& func)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (std::is_invocable_v<Func&, const BatchPacket&>)
+            {
+                for (; begin + BatchPacket::SIZE <= end; begin += BatchPacket::SIZE)
+                    func(BatchPacket::load(values + begin)).store(out + begin);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                out[begin] = func(values[begin]);
+        }
+
+        /**
+         * \brief Computes out[i] = func(values[i], exponents[i]) for the values in [begin, end)
+         * \param func The computed function. Processes whole packets if it accepts them, one float at a time otherwise
+         */
+        template <class Func>
+        void mapRange(const float* values, const float* exponents, float* out, size_t begin, const size_t end, Func& func)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (std::is_invocable_v<Func&, const BatchPacket&, const BatchPacket&>)
+            {
+                for (; begin + BatchPacket::SIZE <= end; begin += BatchPacket::SIZE)
+                    func(BatchPacket::load(values + begin), BatchPacket::load(exponents + begin)).store(out + begin);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                out[begin] = func(values[begin], exponents[begin]);
+        }
+
+        template <class Func>
+        void mapBatch(const std::span<const float> values, const std::span<float> out, const EExecutionPolicy policy, Func&& func)
+        {
+            assert(values.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+            forEachRange(out.size(), policy, [values = values.data(), out = out.data(), &func](const size_t begin, const size_t end)
+            {
+                mapRange(values, out, begin, end, func);
+            });
+        }
+
+        inline void expBatch(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                             const EExecutionPolicy policy, const bool isBase2)
+        {
+            if (precision == EPrecision::PRECISE)
+            {
+                mapBatch(values, out, policy, [isBase2](const float value)
+                {
+                    return isBase2 ? std::exp2(value) : std::exp(value);
+                });
+            }
+            else
+            {
+                mapBatch(values, out, policy, [precision, isBase2](const auto& value)
+                {
+                    return expKernel(value, precision, isBase2);
+                });
+            }
+        }
+
+        inline void logBatch(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                             const EExecutionPolicy policy, const bool isBase2)
+        {
+            if (precision == EPrecision::PRECISE)
+            {
+                mapBatch(values, out, policy, [isBase2](const float value)
+                {
+                    return isBase2 ? std::log2(value) : std::log(value);
+                });
+            }
+            else
+            {
+                mapBatch(values, out, policy, [precision, isBase2](const auto& value)
+                {
+                    return logKernel(value, precision, isBase2);
+                });
+            }
+        }
+    }
+
+    inline void exp(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                    const EExecutionPolicy policy)
+    {
+        Details::expBatch(values, out, precision, policy, false);
+    }
+
+    inline void exp2(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                     const EExecutionPolicy policy)
+    {
+        Details::expBatch(values, out, precision, policy, true);
+    }
+
+    inline void log(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                    const EExecutionPolicy policy)
+    {
+        Details::logBatch(values, out, precision, policy, false);
+    }
+
+    inline void log2(const std::span<const float> values, const std::span<float> out, const EPrecision precision,
+                     const EExecutionPolicy policy)
+    {
+        Details::logBatch(values, out, precision, policy, true);
+    }
+
+    inline void pow(const std::span<const float> values, const float exponent, const std::span<float> out,
+                    const EPrecision precision, const EExecutionPolicy policy)
+    {
+        if (precision == EPrecision::PRECISE)
+        {
+            Details::mapBatch(values, out, policy, [exponent](const float value)
+            {
+                return std::pow(value, exponent);
+            });
+        }
+        else
+        {
+            Details::mapBatch(values, out, policy, [exponent, precision]<class T>(const T& value)
+            {
+                return Details::powKernel(value, T(exponent), precision);
+            });
+        }
+    }
+
+    inline void pow(const std::span<const float> values, const std::span<const float> exponents, const std::span<float> out,
+                    const EPrecision precision, const EExecutionPolicy policy)
+    {
+        assert(values.size() == exponents.size() && values.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::forEachRange(out.size(), policy, [values = values.data(), exponents = exponents.data(), out = out.data(), precision](
+            const size_t begin, const size_t end)
+        {
+            if (precision == EPrecision::PRECISE)
+            {
+                auto func = [](const float value, const float exponent) { return std::pow(value, exponent); };
+                Details::mapRange(values, exponents, out, begin, end, func);
+            }
+            else
+            {
+                auto func = [precision](const auto& value, const auto& exponent) { return Details::powKernel(value, exponent, precision); };
+                Details::mapRange(values, exponents, out, begin, end, func);
+            }
+        });
+    }
+}
+
+#endif // !__LIBMATH__ARITHMETICBATCH_INL__
@@ -0,0 +1,60 @@
+#ifndef __LIBMATH__BATCH_H__
+#define __LIBMATH__BATCH_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "EExecutionPolicy.h"
+
+namespace LibMath::Details
+{
+    /**
+     * \brief The minimum number of elements processed by each thread of a parallel batch operation.
+     * Smaller batches aren't worth the cost of starting a thread
+     */
+    constexpr size_t PARALLEL_BATCH_MIN_SIZE = 4096;
+
+    /**
+     * \brief Calls the given function on contiguous [begin, end) ranges covering [0, count)
+     * \tparam Func The range function's type
+     * \param count The number of elements to process
+     * \param policy The execution policy
+     * \param func The function to call for each range
+     */
+    template <class Func>
+    void forEachRange(const size_t count, const EExecutionPolicy policy, Func&& func)
+    {
+        size_t threadCount = 1;
+
+        if (policy == EExecutionPolicy::PARALLEL)
+        {
+            const size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            threadCount             = std::clamp<size_t>(count / PARALLEL_BATCH_MIN_SIZE, 1, maxThreads);
+        }
+
+        if (threadCount == 1)
+        {
+            func(static_cast<size_t>(0), count);
+            return;
+        }
+
+        const size_t rangeSize = (count + threadCount - 1) / threadCount;
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+
+        // The calling thread handles the first range
+        for (size_t begin = rangeSize; begin < count; begin += rangeSize)
+            threads.emplace_back(std::ref(func), begin, std::min(begin + rangeSize, count));
+
+        func(static_cast<size_t>(0), rangeSize);
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
+
+#endif // !__LIBMATH__BATCH_H__
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace LibMath
+{
+    /**
+     * \brief How the binary readers and writers store floats
+     */
+    enum class EBinaryEncoding : uint8_t
+    {
+        RAW,      // 32 bits little-endian floats - values are stored exactly
+        QUANTIZED // Half precision floats, and snorm16 for unit quaternions - half the size, with the PackedVector error bounds
+    };
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace LibMath
+{
+    /**
+     * \brief How batch operations should process their elements
+     */
+    enum class EExecutionPolicy
+    {
+        SEQUENTIAL, // Process every element on the calling thread
+        PARALLEL    // Split large batches across the available hardware threads
+    };
+}
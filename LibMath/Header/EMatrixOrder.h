@@ -0,0 +1,13 @@
+#pragma once
+
+namespace LibMath
+{
+    /**
+     * \brief The order in which a matrix's elements are stored in memory
+     */
+    enum class EMatrixOrder
+    {
+        ROW_MAJOR,   // Rows are contiguous (i.e. the element at (row, column) is stored at row * Cols + column)
+        COLUMN_MAJOR // Columns are contiguous (i.e. the element at (row, column) is stored at column * Rows + row)
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace LibMath
+{
+    /**
+     * \brief The accuracy/speed trade-off of the approximated math functions
+     */
+    enum class EPrecision
+    {
+        FAST,     // Hardware estimate or low degree approximation only (e.g. ~12 bits for the float inverse square root)
+        BALANCED, // Refined estimate or higher degree approximation (close to full float precision)
+        PRECISE   // Full precision - as accurate as the standard library
+    };
+}
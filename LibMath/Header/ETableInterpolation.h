@@ -0,0 +1,13 @@
+#pragma once
+
+namespace LibMath
+{
+    /**
+     * \brief How lookup tables compute the values between their entries
+     */
+    enum class ETableInterpolation
+    {
+        NEAREST, // Closest entry - a single load, error proportional to the table's step
+        LINEAR   // Linear interpolation of the two surrounding entries - error proportional to the squared step
+    };
+}
@@ -0,0 +1,620 @@
+#ifndef __LIBMATH__EXPRESSION_H__
+#define __LIBMATH__EXPRESSION_H__
+
+#include <concepts>
+#include <type_traits>
+
+#include "Matrix/TMatrix.h"
+#include "Vector/TVector.h"
+#include "Vector/Vector2.h"
+#include "Vector/Vector3.h"
+#include "Vector/Vector4.h"
+
+/*
+ * Opt-in lazy evaluation of chained matrix and vector arithmetic.
+ *
+ * Wrapping an operand with lazy() makes the arithmetic operators build an expression tree instead of a temporary per operation.
+ * The whole tree is then evaluated in a single pass when it gets converted to a matrix or vector (i.e. at assignment time):
+ *
+ *     Matrix4 result = lazy(a) * b + lazy(c) * 2.f - d;   // one product, then a single pass for "+", "* 2.f" and "-"
+ *     Vector3 point  = lazy(u) + lazy(v) * t - w;         // one pass, no intermediate vector
+ *
+ * Only operations involving an expression are deferred - in "lazy(a) + c * 2.f", "c * 2.f" is still computed eagerly.
+ *
+ * Supported operations are +, - (binary and unary), multiplication and division by a scalar and, for matrices, matrix products.
+ * Matrix products and their non-leaf operands are evaluated once, through the Details::Multiply kernels (and their SIMD
+ * specializations), instead of computing one dot product per element.
+ *
+ * Matrix expressions only accept row-major matrices - column-major matrices should be converted explicitly first.
+ *
+ * Expressions only reference their matrix and vector operands. They must be evaluated in the full-expression that created them
+ * and should never be stored (e.g. in an "auto" variable) past the lifetime of their operands.
+ */
+
+namespace LibMath
+{
+    namespace Details
+    {
+        struct MatrixExpressionTag
+        {
+        };
+
+        struct VectorExpressionTag
+        {
+        };
+
+        template <class T>
+        concept MatrixExpression = std::is_base_of_v<MatrixExpressionTag, T>;
+
+        template <class T>
+        concept VectorExpression = std::is_base_of_v<VectorExpressionTag, T>;
+
+        struct AddOperation
+        {
+            template <typename T>
+            static constexpr T apply(const T left, const T right)
+            {
+                return left + right;
+            }
+        };
+
+        struct SubtractOperation
+        {
+            template <typename T>
+            static constexpr T apply(const T left, const T right)
+            {
+                return left - right;
+            }
+        };
+
+        struct MultiplyOperation
+        {
+            template <typename T>
+            static constexpr T apply(const T left, const T right)
+            {
+                return left * right;
+            }
+        };
+
+        struct DivideOperation
+        {
+            template <typename T>
+            static constexpr T apply(const T left, const T right)
+            {
+                return left / right;
+            }
+        };
+
+        /**
+         * \brief Base class of every matrix expression node
+         * \tparam Derived The expression node's type
+         * \tparam Rows The expression's row count
+         * \tparam Cols The expression's column count
+         * \tparam DataT The expression's data type
+         */
+        template <class Derived, length_t Rows, length_t Cols, typename DataT>
+        class MatrixExpressionBase : public MatrixExpressionTag
+        {
+        public:
+            using value_type = DataT;
+            using matrix_type = TMatrix<Rows, Cols, DataT>;
+
+            static constexpr length_t rows = Rows;
+            static constexpr length_t cols = Cols;
+
+            /**
+             * \brief Evaluates the expression in a single pass
+             * \return The expression's result
+             */
+            constexpr matrix_type evaluate() const
+            {
+                const Derived& self = static_cast<const Derived&>(*this);
+
+                matrix_type result;
+                DataT*      values = result.getArray();
+
+                for (length_t row = 0; row < Rows; row++)
+                {
+                    for (length_t col = 0; col < Cols; col++)
+                        values[row * Cols + col] = self.at(row, col);
+                }
+
+                return result;
+            }
+
+            /**
+             * \brief Evaluates the expression into a matrix
+             */
+            constexpr operator matrix_type() const
+            {
+                return static_cast<const Derived&>(*this).evaluate();
+            }
+        };
+
+        /**
+         * \brief Matrix expression leaf referencing an existing matrix
+         */
+        template <length_t Rows, length_t Cols, typename DataT>
+        class MatrixTerminal : public MatrixExpressionBase<MatrixTerminal<Rows, Cols, DataT>, Rows, Cols, DataT>
+        {
+        public:
+            explicit constexpr MatrixTerminal(const TMatrix<Rows, Cols, DataT>& matrix)
+                : m_matrix(&matrix)
+            {
+            }
+
+            constexpr DataT at(const length_t row, const length_t col) const
+            {
+                return m_matrix->getArray()[row * Cols + col];
+            }
+
+            constexpr const TMatrix<Rows, Cols, DataT>& matrix() const
+            {
+                return *m_matrix;
+            }
+
+        private:
+            const TMatrix<Rows, Cols, DataT>* m_matrix;
+        };
+
+        /**
+         * \brief Matrix expression leaf holding an already evaluated sub-expression
+         */
+        template <length_t Rows, length_t Cols, typename DataT>
+        class MatrixValue : public MatrixExpressionBase<MatrixValue<Rows, Cols, DataT>, Rows, Cols, DataT>
+        {
+        public:
+            explicit constexpr MatrixValue(const TMatrix<Rows, Cols, DataT>& matrix)
+                : m_matrix(matrix)
+            {
+            }
+
+            constexpr DataT at(const length_t row, const length_t col) const
+            {
+                return m_matrix.getArray()[row * Cols + col];
+            }
+
+            constexpr const TMatrix<Rows, Cols, DataT>& matrix() const
+            {
+                return m_matrix;
+            }
+
+        private:
+            TMatrix<Rows, Cols, DataT> m_matrix;
+        };
+
+        template <MatrixExpression Left, MatrixExpression Right>
+        class MatrixProduct;
+
+        template <class T>
+        struct IsMatrixProduct : std::false_type
+        {
+        };
+
+        template <MatrixExpression Left, MatrixExpression Right>
+        struct IsMatrixProduct<MatrixProduct<Left, Right>> : std::true_type
+        {
+        };
+
+        /**
+         * \brief Gets the type used to store the given expression as an element-wise operation's operand
+         * \note Matrix products are stored evaluated to compute them with the Multiply kernels instead of one dot product per element
+         */
+        template <MatrixExpression Expr>
+        using ElementOperand = std::conditional_t<IsMatrixProduct<Expr>::value,
+            MatrixValue<Expr::rows, Expr::cols, typename Expr::value_type>, Expr>;
+
+        template <MatrixExpression Expr>
+        constexpr ElementOperand<Expr> toElementOperand(const Expr& expression)
+        {
+            if constexpr (IsMatrixProduct<Expr>::value)
+                return ElementOperand<Expr>(expression.evaluate());
+            else
+                return expression;
+        }
+
+        /**
+         * \brief Element-wise operation between two matrix expressions of the same size
+         */
+        template <class Operation, MatrixExpression Left, MatrixExpression Right>
+        class MatrixBinary : public MatrixExpressionBase<MatrixBinary<Operation, Left, Right>, Left::rows, Left::cols,
+                typename Left::value_type>
+        {
+            static_assert(Left::rows == Right::rows && Left::cols == Right::cols,
+                "Can't combine matrices with different sizes");
+            static_assert(std::is_same_v<typename Left::value_type, typename Right::value_type>,
+                "Can't combine matrices with different data types");
+
+        public:
+            constexpr MatrixBinary(const Left& left, const Right& right)
+                : m_left(toElementOperand(left)), m_right(toElementOperand(right))
+            {
+            }
+
+            constexpr typename Left::value_type at(const length_t row, const length_t col) const
+            {
+                return Operation::apply(m_left.at(row, col), m_right.at(row, col));
+            }
+
+        private:
+            ElementOperand<Left>  m_left;
+            ElementOperand<Right> m_right;
+        };
+
+        /**
+         * \brief Element-wise operation between a matrix expression and a scalar
+         */
+        template <class Operation, MatrixExpression Expr>
+        class MatrixScalar : public MatrixExpressionBase<MatrixScalar<Operation, Expr>, Expr::rows, Expr::cols,
+                typename Expr::value_type>
+        {
+        public:
+            constexpr MatrixScalar(const Expr& expression, const typename Expr::value_type scalar)
+                : m_expression(toElementOperand(expression)), m_scalar(scalar)
+            {
+            }
+
+            constexpr typename Expr::value_type at(const length_t row, const length_t col) const
+            {
+                return Operation::apply(m_expression.at(row, col), m_scalar);
+            }
+
+        private:
+            ElementOperand<Expr>      m_expression;
+            typename Expr::value_type m_scalar;
+        };
+
+        template <class T>
+        struct IsMatrixLeaf : std::false_type
+        {
+        };
+
+        template <length_t Rows, length_t Cols, typename DataT>
+        struct IsMatrixLeaf<MatrixTerminal<Rows, Cols, DataT>> : std::true_type
+        {
+        };
+
+        template <length_t Rows, length_t Cols, typename DataT>
+        struct IsMatrixLeaf<MatrixValue<Rows, Cols, DataT>> : std::true_type
+        {
+        };
+
+        /**
+         * \brief Gets the leaf type used to store the given expression as a matrix product operand
+         */
+        template <MatrixExpression Expr>
+        using ProductOperand = std::conditional_t<IsMatrixLeaf<Expr>::value, Expr,
+            MatrixValue<Expr::rows, Expr::cols, typename Expr::value_type>>;
+
+        /**
+         * \brief Matrix product between two matrix expressions
+         * \note Non-leaf operands are evaluated once on construction to avoid recomputing them for every element
+         */
+        template <MatrixExpression Left, MatrixExpression Right>
+        class MatrixProduct : public MatrixExpressionBase<MatrixProduct<Left, Right>, Left::rows, Right::cols,
+                typename Left::value_type>
+        {
+            static_assert(Left::cols == Right::rows, "Can't multiply matrices with incompatible sizes");
+            static_assert(std::is_same_v<typename Left::value_type, typename Right::value_type>,
+                "Can't multiply matrices with different data types");
+
+            using DataT = typename Left::value_type;
+
+        public:
+            constexpr MatrixProduct(const Left& left, const Right& right)
+                : m_left(toOperand(left)), m_right(toOperand(right))
+            {
+            }
+
+            constexpr DataT at(const length_t row, const length_t col) const
+            {
+                DataT scalar = 0;
+
+                for (length_t i = 0; i < Left::cols; i++)
+                    scalar += m_left.at(row, i) * m_right.at(i, col);
+
+                return scalar;
+            }
+
+            constexpr TMatrix<Left::rows, Right::cols, DataT> evaluate() const
+            {
+                return Multiply<Left::rows, Left::cols, Right::cols, DataT>::compute(m_left.matrix(), m_right.matrix());
+            }
+
+        private:
+            template <MatrixExpression Expr>
+            static constexpr ProductOperand<Expr> toOperand(const Expr& expression)
+            {
+                if constexpr (IsMatrixLeaf<Expr>::value)
+                    return expression;
+                else
+                    return ProductOperand<Expr>(expression.evaluate());
+            }
+
+            ProductOperand<Left>  m_left;
+            ProductOperand<Right> m_right;
+        };
+
+        template <class T>
+        struct IsMatrix : std::false_type
+        {
+        };
+
+        template <length_t Rows, length_t Cols, typename DataT>
+        struct IsMatrix<TMatrix<Rows, Cols, DataT>> : std::true_type
+        {
+        };
+
+        template <class T>
+        concept MatrixOperand = MatrixExpression<T> || IsMatrix<T>::value;
+
+        template <MatrixOperand T>
+        constexpr auto toMatrixExpression(const T& operand)
+        {
+            if constexpr (MatrixExpression<T>)
+                return operand;
+            else
+                return MatrixTerminal<T::getRowCount(), T::getColumnCount(), std::remove_cv_t<
+                    std::remove_reference_t<decltype(*operand.getArray())>>>(operand);
+        }
+
+        template <MatrixOperand Left, MatrixOperand Right>
+            requires MatrixExpression<Left> || MatrixExpression<Right>
+        constexpr auto operator+(const Left& left, const Right& right)
+        {
+            using LeftExpr = decltype(toMatrixExpression(left));
+            using RightExpr = decltype(toMatrixExpression(right));
+
+            return MatrixBinary<AddOperation, LeftExpr, RightExpr>(toMatrixExpression(left), toMatrixExpression(right));
+        }
+
+        template <MatrixOperand Left, MatrixOperand Right>
+            requires MatrixExpression<Left> || MatrixExpression<Right>
+        constexpr auto operator-(const Left& left, const Right& right)
+        {
+            using LeftExpr = decltype(toMatrixExpression(left));
+            using RightExpr = decltype(toMatrixExpression(right));
+
+            return MatrixBinary<SubtractOperation, LeftExpr, RightExpr>(toMatrixExpression(left), toMatrixExpression(right));
+        }
+
+        template <MatrixOperand Left, MatrixOperand Right>
+            requires MatrixExpression<Left> || MatrixExpression<Right>
+        constexpr auto operator*(const Left& left, const Right& right)
+        {
+            using LeftExpr = decltype(toMatrixExpression(left));
+            using RightExpr = decltype(toMatrixExpression(right));
+
+            return MatrixProduct<LeftExpr, RightExpr>(toMatrixExpression(left), toMatrixExpression(right));
+        }
+
+        template <MatrixExpression Expr>
+        constexpr auto operator*(const Expr& expression, const typename Expr::value_type scalar)
+        {
+            return MatrixScalar<MultiplyOperation, Expr>(expression, scalar);
+        }
+
+        template <MatrixExpression Expr>
+        constexpr auto operator*(const typename Expr::value_type scalar, const Expr& expression)
+        {
+            return MatrixScalar<MultiplyOperation, Expr>(expression, scalar);
+        }
+
+        template <MatrixExpression Expr>
+        constexpr auto operator/(const Expr& expression, const typename Expr::value_type scalar)
+        {
+            // Same as the eager operator - multiply by the scalar's inverse
+            return MatrixScalar<MultiplyOperation, Expr>(expression, static_cast<typename Expr::value_type>(1) / scalar);
+        }
+
+        template <MatrixExpression Expr>
+        constexpr auto operator-(const Expr& expression)
+        {
+            return MatrixScalar<MultiplyOperation, Expr>(expression, static_cast<typename Expr::value_type>(-1));
+        }
+
+        template <class T>
+        concept Vector = requires { VectorTraits<T>::size; };
+
+        /**
+         * \brief Base class of every vector expression node
+         * \tparam Derived The expression node's type
+         * \tparam VectorT The expression's result vector type
+         */
+        template <class Derived, Vector VectorT>
+        class VectorExpressionBase : public VectorExpressionTag
+        {
+        public:
+            using vector_type = VectorT;
+            using value_type = typename VectorTraits<VectorT>::value_type;
+
+            static constexpr length_t size = VectorTraits<VectorT>::size;
+
+            /**
+             * \brief Evaluates the expression in a single pass
+             * \return The expression's result
+             */
+            constexpr vector_type evaluate() const
+            {
+                const Derived& self = static_cast<const Derived&>(*this);
+
+                if constexpr (size == 2)
+                    return vector_type(self.at(0), self.at(1));
+                else if constexpr (size == 3)
+                    return vector_type(self.at(0), self.at(1), self.at(2));
+                else
+                    return vector_type(self.at(0), self.at(1), self.at(2), self.at(3));
+            }
+
+            /**
+             * \brief Evaluates the expression into a vector
+             */
+            constexpr operator vector_type() const
+            {
+                return evaluate();
+            }
+        };
+
+        /**
+         * \brief Vector expression leaf referencing an existing vector
+         */
+        template <Vector VectorT>
+        class VectorTerminal : public VectorExpressionBase<VectorTerminal<VectorT>, VectorT>
+        {
+        public:
+            using value_type = typename VectorTraits<VectorT>::value_type;
+
+            explicit constexpr VectorTerminal(const VectorT& vector)
+                : m_vector(&vector)
+            {
+            }
+
+            constexpr value_type at(const length_t index) const
+            {
+                if constexpr (VectorTraits<VectorT>::size > 3)
+                {
+                    if (index == 3)
+                        return m_vector->m_w;
+                }
+
+                if constexpr (VectorTraits<VectorT>::size > 2)
+                {
+                    if (index == 2)
+                        return m_vector->m_z;
+                }
+
+                return index == 0 ? m_vector->m_x : m_vector->m_y;
+            }
+
+        private:
+            const VectorT* m_vector;
+        };
+
+        /**
+         * \brief Element-wise operation between two vector expressions of the same type
+         */
+        template <class Operation, VectorExpression Left, VectorExpression Right>
+        class VectorBinary : public VectorExpressionBase<VectorBinary<Operation, Left, Right>, typename Left::vector_type>
+        {
+            static_assert(std::is_same_v<typename Left::vector_type, typename Right::vector_type>,
+                "Can't combine vectors of different types");
+
+        public:
+            constexpr VectorBinary(const Left& left, const Right& right)
+                : m_left(left), m_right(right)
+            {
+            }
+
+            constexpr typename Left::value_type at(const length_t index) const
+            {
+                return Operation::apply(m_left.at(index), m_right.at(index));
+            }
+
+        private:
+            Left  m_left;
+            Right m_right;
+        };
+
+        /**
+         * \brief Element-wise operation between a vector expression and a scalar
+         */
+        template <class Operation, VectorExpression Expr>
+        class VectorScalar : public VectorExpressionBase<VectorScalar<Operation, Expr>, typename Expr::vector_type>
+        {
+        public:
+            constexpr VectorScalar(const Expr& expression, const typename Expr::value_type scalar)
+                : m_expression(expression), m_scalar(scalar)
+            {
+            }
+
+            constexpr typename Expr::value_type at(const length_t index) const
+            {
+                return Operation::apply(m_expression.at(index), m_scalar);
+            }
+
+        private:
+            Expr                      m_expression;
+            typename Expr::value_type m_scalar;
+        };
+
+        template <class T>
+        concept VectorOperand = VectorExpression<T> || Vector<T>;
+
+        template <VectorOperand T>
+        constexpr auto toVectorExpression(const T& operand)
+        {
+            if constexpr (VectorExpression<T>)
+                return operand;
+            else
+                return VectorTerminal<T>(operand);
+        }
+
+        template <VectorOperand Left, VectorOperand Right>
+            requires VectorExpression<Left> || VectorExpression<Right>
+        constexpr auto operator+(const Left& left, const Right& right)
+        {
+            using LeftExpr = decltype(toVectorExpression(left));
+            using RightExpr = decltype(toVectorExpression(right));
+
+            return VectorBinary<AddOperation, LeftExpr, RightExpr>(toVectorExpression(left), toVectorExpression(right));
+        }
+
+        template <VectorOperand Left, VectorOperand Right>
+            requires VectorExpression<Left> || VectorExpression<Right>
+        constexpr auto operator-(const Left& left, const Right& right)
+        {
+            using LeftExpr = decltype(toVectorExpression(left));
+            using RightExpr = decltype(toVectorExpression(right));
+
+            return VectorBinary<SubtractOperation, LeftExpr, RightExpr>(toVectorExpression(left), toVectorExpression(right));
+        }
+
+        template <VectorExpression Expr>
+        constexpr auto operator*(const Expr& expression, const typename Expr::value_type scalar)
+        {
+            return VectorScalar<MultiplyOperation, Expr>(expression, scalar);
+        }
+
+        template <VectorExpression Expr>
+        constexpr auto operator*(const typename Expr::value_type scalar, const Expr& expression)
+        {
+            return VectorScalar<MultiplyOperation, Expr>(expression, scalar);
+        }
+
+        template <VectorExpression Expr>
+        constexpr auto operator/(const Expr& expression, const typename Expr::value_type scalar)
+        {
+            return VectorScalar<DivideOperation, Expr>(expression, scalar);
+        }
+
+        template <VectorExpression Expr>
+        constexpr auto operator-(const Expr& expression)
+        {
+            return VectorScalar<MultiplyOperation, Expr>(expression, static_cast<typename Expr::value_type>(-1));
+        }
+    }
+
+    /**
+     * \brief Starts a lazily evaluated matrix expression
+     * \param matrix The expression's first operand
+     * \return A matrix expression referencing the given matrix
+     */
+    template <length_t Rows, length_t Cols, typename DataT>
+    constexpr Details::MatrixTerminal<Rows, Cols, DataT> lazy(const TMatrix<Rows, Cols, DataT>& matrix)
+    {
+        return Details::MatrixTerminal<Rows, Cols, DataT>(matrix);
+    }
+
+    /**
+     * \brief Starts a lazily evaluated vector expression
+     * \param vector The expression's first operand
+     * \return A vector expression referencing the given vector
+     */
+    template <Details::Vector VectorT>
+    constexpr Details::VectorTerminal<VectorT> lazy(const VectorT& vector)
+    {
+        return Details::VectorTerminal<VectorT>(vector);
+    }
+}
+
+#endif // !__LIBMATH__EXPRESSION_H__
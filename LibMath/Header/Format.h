@@ -0,0 +1,54 @@
+#ifndef __LIBMATH__FORMAT_H__
+#define __LIBMATH__FORMAT_H__
+
+#include <charconv>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+/*
+ * Allocation-free text conversions built on std::to_chars and std::from_chars. Each math type provides :
+ * - formatTo(first, last, value) : writes the value's string() representation (e.g. "{1.5,-2,0.25}") to [first, last)
+ * - parse(text, value) : reads a value from the start of the text. Whitespace is allowed around the components
+ * Floats are written in their shortest form that parses back to the exact same value.
+ * Both return the standard to_chars_result/from_chars_result and report errors the same way.
+ */
+
+namespace LibMath
+{
+    /**
+     * \brief The result of a parseArray call
+     */
+    struct ArrayParseResult
+    {
+        const char* ptr;   // The first character that wasn't parsed
+        std::errc   ec;    // std::errc() on success, the first invalid value's error otherwise
+        size_t      count; // The number of parsed values
+    };
+
+    /**
+     * \brief Writes the given values to [first, last), separated by the given character
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param values The values to write
+     * \param separator The character written between two values
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    template <class Value>
+    std::to_chars_result formatArray(char* first, char* last, std::span<const Value> values, char separator = '\n');
+
+    /**
+     * \brief Reads consecutive values from the given text. Values can be separated by whitespace and commas
+     * \param text The text to parse
+     * \param out The parsed values. Parsing stops once the output is full
+     * \return The end of the parsed text, the parsing error if any and the number of parsed values. Reaching the end of the
+     * text before filling the output isn't an error
+     */
+    template <class Value>
+    ArrayParseResult parseArray(std::string_view text, std::span<Value> out);
+}
+
+#include "Format.inl"
+
+#endif // !__LIBMATH__FORMAT_H__
@@ -0,0 +1,269 @@
+#ifndef __LIBMATH__FORMAT_INL__
+#define __LIBMATH__FORMAT_INL__
+
+#include <string>
+#include <type_traits>
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <format>
+#endif // __cpp_lib_format
+
+#include "Format.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        /**
+         * \brief The largest number of characters written for a single component (e.g. "-1.2345678e-38" for floats)
+         */
+        constexpr size_t MAX_COMPONENT_CHARS = 32;
+
+        /**
+         * \brief The type written for each T component - angles are written as their raw value
+         */
+        template <class T>
+        using format_component_t = std::conditional_t<std::is_arithmetic_v<T>, T, float>;
+
+        template <class T>
+        constexpr format_component_t<T> toFormatComponent(const T value)
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+                return value;
+            else
+                return value.raw();
+        }
+
+        constexpr bool isWhitespace(const char character)
+        {
+            return character == ' ' || character == '\t' || character == '\n' || character == '\r' || character == '\f' || character == '\v';
+        }
+
+        constexpr const char* skipWhitespace(const char* first, const char* last)
+        {
+            while (first != last && isWhitespace(*first))
+                ++first;
+
+            return first;
+        }
+
+        template <class T>
+        std::to_chars_result formatComponent(char* first, char* last, const T value)
+        {
+            return std::to_chars(first, last, toFormatComponent(value));
+        }
+
+        /**
+         * \brief Appends the given component to the string, written the same way as by formatComponent
+         */
+        template <class T>
+        void appendComponent(std::string& out, const T value)
+        {
+            char buffer[MAX_COMPONENT_CHARS];
+
+            const std::to_chars_result result = formatComponent(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+        }
+
+        template <class T>
+        std::from_chars_result parseComponent(const char* first, const char* last, T& value)
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                return std::from_chars(first, last, value);
+            }
+            else
+            {
+                float                        raw;
+                const std::from_chars_result result = std::from_chars(first, last, raw);
+
+                if (result.ec == std::errc())
+                    value = T(raw);
+
+                return result;
+            }
+        }
+
+        /**
+         * \brief Writes the given components as "{a,b,c}"
+         */
+        template <class T>
+        std::to_chars_result formatComponents(char* first, char* last, const T* values, const size_t count)
+        {
+            if (first == last)
+                return { last, std::errc::value_too_large };
+
+            *first++ = '{';
+
+            for (size_t i = 0; i < count; i++)
+            {
+                if (i > 0)
+                {
+                    if (first == last)
+                        return { last, std::errc::value_too_large };
+
+                    *first++ = ',';
+                }
+
+                const std::to_chars_result result = formatComponent(first, last, values[i]);
+
+                if (result.ec != std::errc())
+                    return result;
+
+                first = result.ptr;
+            }
+
+            if (first == last)
+                return { last, std::errc::value_too_large };
+
+            *first++ = '}';
+            return { first, std::errc() };
+        }
+
+        /**
+         * \brief Reads "{a, b, c" - i.e. the given number of components, without the closing brace
+         */
+        template <class T>
+        std::from_chars_result parseComponentList(const char* first, const char* last, T* values, const size_t count)
+        {
+            first = skipWhitespace(first, last);
+
+            if (first == last || *first != '{')
+                return { first, std::errc::invalid_argument };
+
+            ++first;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                first = skipWhitespace(first, last);
+
+                if (i > 0)
+                {
+                    if (first == last || *first != ',')
+                        return { first, std::errc::invalid_argument };
+
+                    first = skipWhitespace(first + 1, last);
+                }
+
+                const std::from_chars_result result = parseComponent(first, last, values[i]);
+
+                if (result.ec != std::errc())
+                    return result;
+
+                first = result.ptr;
+            }
+
+            return { first, std::errc() };
+        }
+
+        /**
+         * \brief Reads "{a, b, c}"
+         */
+        template <class T>
+        std::from_chars_result parseComponents(const char* first, const char* last, T* values, const size_t count)
+        {
+            std::from_chars_result result = parseComponentList(first, last, values, count);
+
+            if (result.ec != std::errc())
+                return result;
+
+            first = skipWhitespace(result.ptr, last);
+
+            if (first == last || *first != '}')
+                return { first, std::errc::invalid_argument };
+
+            return { first + 1, std::errc() };
+        }
+
+#ifdef __cpp_lib_format
+        /**
+         * \brief Base std::formatter of the math types. The format specification applies to each component
+         * (e.g. std::format("{:.2f}", vector) gives "{1.00,2.50,-3.00}")
+         */
+        template <class T>
+        class TComponentsFormatter
+        {
+        public:
+            constexpr auto parse(std::format_parse_context& context)
+            {
+                return m_formatter.parse(context);
+            }
+
+        protected:
+            template <class FormatContext>
+            auto formatComponents(const T* values, const size_t count, FormatContext& context) const
+            {
+                auto out = context.out();
+                *out++   = '{';
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (i > 0)
+                        *out++ = ',';
+
+                    context.advance_to(out);
+                    out = m_formatter.format(toFormatComponent(values[i]), context);
+                }
+
+                *out++ = '}';
+                return out;
+            }
+
+        private:
+            std::formatter<format_component_t<T>, char> m_formatter;
+        };
+#endif // __cpp_lib_format
+    }
+
+    template <class Value>
+    std::to_chars_result formatArray(char* first, char* last, const std::span<const Value> values, const char separator)
+    {
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (i > 0)
+            {
+                if (first == last)
+                    return { last, std::errc::value_too_large };
+
+                *first++ = separator;
+            }
+
+            const std::to_chars_result result = formatTo(first, last, values[i]);
+
+            if (result.ec != std::errc())
+                return result;
+
+            first = result.ptr;
+        }
+
+        return { first, std::errc() };
+    }
+
+    template <class Value>
+    ArrayParseResult parseArray(const std::string_view text, const std::span<Value> out)
+    {
+        const char* first = text.data();
+        const char* last  = text.data() + text.size();
+
+        for (size_t count = 0; count < out.size(); count++)
+        {
+            while (first != last && (*first == ',' || Details::isWhitespace(*first)))
+                ++first;
+
+            if (first == last)
+                return { first, std::errc(), count };
+
+            const std::from_chars_result result = parse(std::string_view(first, last), out[count]);
+
+            if (result.ec != std::errc())
+                return { result.ptr, result.ec, count };
+
+            first = result.ptr;
+        }
+
+        return { first, std::errc(), out.size() };
+    }
+}
+
+#endif // !__LIBMATH__FORMAT_INL__
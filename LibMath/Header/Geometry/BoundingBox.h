@@ -13,7 +13,8 @@ namespace LibMath
         Vector3 m_max;
     };
 
-    inline BoundingBox transformBoundingBox(BoundingBox boundingBox, const Matrix4& transform)
+    template <EMatrixOrder Order>
+    BoundingBox transformBoundingBox(BoundingBox boundingBox, const TMatrix<4, 4, float, Order>& transform)
     {
         Vector3 corners[8]
         {
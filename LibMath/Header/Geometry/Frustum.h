@@ -22,9 +22,11 @@ namespace LibMath
 
         /**
          * \brief Computes the frustum from the given view-projection matrix
+         * \tparam Order The view-projection matrix's storage order
          * \param p_viewProjection The source view-projection matrix
          */
-        explicit Frustum(const Matrix4& p_viewProjection);
+        template <EMatrixOrder Order>
+        explicit Frustum(const TMatrix<4, 4, float, Order>& p_viewProjection);
 
         /**
          * \brief Creates a copy of the given frustum
@@ -4,7 +4,8 @@
 namespace LibMath
 {
     // Adapted from https://www8.cs.umu.se/kurser/5DV051/HT12/lab/plane_extraction.pdf
-    inline Frustum::Frustum(const Matrix4& p_viewProjection)
+    template <EMatrixOrder Order>
+    Frustum::Frustum(const TMatrix<4, 4, float, Order>& p_viewProjection)
     {
         for (int8_t i = 0; i < 4; ++i)
             m_planes[PLANE_LEFT][i] = p_viewProjection(3, i) + p_viewProjection(0, i);
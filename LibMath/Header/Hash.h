@@ -0,0 +1,56 @@
+#ifndef __LIBMATH__HASH_H__
+#define __LIBMATH__HASH_H__
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace LibMath::Details
+{
+    /**
+     * \brief Gets the bits to hash for the given value. Both float zeros give the same bits
+     * \tparam T The value's type (an arithmetic or angle type)
+     */
+    template <class T>
+    constexpr uint64_t hashBits(const T value)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return static_cast<uint64_t>(value);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            if (value == static_cast<T>(0))
+                return 0;
+
+            if constexpr (sizeof(T) == sizeof(uint32_t))
+                return std::bit_cast<uint32_t>(value);
+            else if constexpr (sizeof(T) == sizeof(uint64_t))
+                return std::bit_cast<uint64_t>(value);
+            else
+                return std::hash<T>{}(value);
+        }
+        else
+        {
+            return hashBits(value.raw());
+        }
+    }
+
+    /**
+     * \brief Mixes the given value's bits into the given hash
+     * \param seed The hash of the previous values
+     * \param value The value to add to the hash
+     * \return The combined hash
+     */
+    template <class T>
+    constexpr uint64_t hashCombine(uint64_t seed, const T value)
+    {
+        // Multiply-xorshift mix - consecutive integer coordinates still spread over the whole range
+        seed = (seed ^ hashBits(value)) * 0x9E3779B97F4A7C15;
+        return seed ^ seed >> 32;
+    }
+}
+
+#endif // !__LIBMATH__HASH_H__
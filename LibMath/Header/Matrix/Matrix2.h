@@ -8,21 +8,27 @@ namespace LibMath
     template <typename DataT>
     struct Details::Determinant<2, 2, DataT>
     {
-        static DataT compute(const TMatrix<2, 2, DataT>& mat);
+        static constexpr DataT compute(const TMatrix<2, 2, DataT>& mat);
     };
 
     template <typename DataT>
     struct Details::Inverse<2, 2, DataT>
     {
-        static TMatrix<2, 2, DataT> compute(const TMatrix<2, 2, DataT>& mat);
+        static constexpr TMatrix<2, 2, DataT> compute(const TMatrix<2, 2, DataT>& mat);
     };
 
     using Matrix2x2 = TMatrix<2, 2, float>;
     using Matrix2 = Matrix2x2;
 
+    using Matrix2RowMajor = TRowMajorMatrix<2, 2, float>;
+    using Matrix2ColumnMajor = TColumnMajorMatrix<2, 2, float>;
+
     using Matrix2x3 = TMatrix<2, 3, float>;
 
     using Matrix2x4 = TMatrix<2, 4, float>;
+
+    static_assert(std::is_trivially_copyable_v<Matrix2> && std::is_standard_layout_v<Matrix2>,
+        "Invalid Matrix2 - should be trivially copyable and standard layout");
 }
 
 #include "Matrix2.inl"
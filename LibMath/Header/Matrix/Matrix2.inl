@@ -6,25 +6,31 @@
 namespace LibMath::Details
 {
     template <typename DataT>
-    DataT Determinant<2, 2, DataT>::compute(const TMatrix<2, 2, DataT>& mat)
+    constexpr DataT Determinant<2, 2, DataT>::compute(const TMatrix<2, 2, DataT>& mat)
     {
+        const DataT* values = mat.getArray();
+
         // 0 1
         // 2 3
-        return mat[0] * mat[3] - mat[1] * mat[2];
+        return values[0] * values[3] - values[1] * values[2];
     }
 
     template <typename DataT>
-    TMatrix<2, 2, DataT> Inverse<2, 2, DataT>::compute(const TMatrix<2, 2, DataT>& mat)
+    constexpr TMatrix<2, 2, DataT> Inverse<2, 2, DataT>::compute(const TMatrix<2, 2, DataT>& mat)
     {
+        const DataT* values = mat.getArray();
+
         DataT detInv = static_cast<DataT>(1) / mat.determinant();
 
         // 0 1
         // 2 3
         TMatrix<2, 2, DataT> inv;
-        inv[0] = mat[3] * detInv;
-        inv[1] = -mat[2] * detInv;
-        inv[2] = -mat[1] * detInv;
-        inv[3] = mat[0] * detInv;
+        DataT*               invValues = inv.getArray();
+
+        invValues[0] = values[3] * detInv;
+        invValues[1] = -values[1] * detInv;
+        invValues[2] = -values[2] * detInv;
+        invValues[3] = values[0] * detInv;
 
         return inv;
     }
@@ -8,13 +8,13 @@ namespace LibMath
     template <typename DataT>
     struct Details::Determinant<3, 3, DataT>
     {
-        static DataT compute(const TMatrix<3, 3, DataT>& mat);
+        static constexpr DataT compute(const TMatrix<3, 3, DataT>& mat);
     };
 
     template <typename DataT>
     struct Details::Inverse<3, 3, DataT>
     {
-        static TMatrix<3, 3, DataT> compute(const TMatrix<3, 3, DataT>& mat);
+        static constexpr TMatrix<3, 3, DataT> compute(const TMatrix<3, 3, DataT>& mat);
     };
 
     using Matrix3x2 = TMatrix<3, 2, float>;
@@ -22,7 +22,13 @@ namespace LibMath
     using Matrix3x3 = TMatrix<3, 3, float>;
     using Matrix3 = Matrix3x3;
 
+    using Matrix3RowMajor = TRowMajorMatrix<3, 3, float>;
+    using Matrix3ColumnMajor = TColumnMajorMatrix<3, 3, float>;
+
     using Matrix3x4 = TMatrix<3, 4, float>;
+
+    static_assert(std::is_trivially_copyable_v<Matrix3> && std::is_standard_layout_v<Matrix3>,
+        "Invalid Matrix3 - should be trivially copyable and standard layout");
 }
 
 #include "Matrix3.inl"
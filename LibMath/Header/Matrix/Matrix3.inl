@@ -6,40 +6,52 @@
 namespace LibMath::Details
 {
     template <typename DataT>
-    DataT Determinant<3, 3, DataT>::compute(const TMatrix<3, 3, DataT>& mat)
+    constexpr DataT Determinant<3, 3, DataT>::compute(const TMatrix<3, 3, DataT>& mat)
     {
+        const DataT* values = mat.getArray();
+
         // 0 1 2
         // 3 4 5
         // 6 7 8
-        const DataT positive = mat[0] * mat[4] * mat[8] +
-            mat[1] * mat[5] * mat[6] +
-            mat[2] * mat[3] * mat[7];
+        const DataT positive = values[0] * values[4] * values[8] +
+            values[1] * values[5] * values[6] +
+            values[2] * values[3] * values[7];
 
-        const DataT negative = mat[2] * mat[4] * mat[6] +
-            mat[1] * mat[3] * mat[8] +
-            mat[0] * mat[5] * mat[7];
+        const DataT negative = values[2] * values[4] * values[6] +
+            values[1] * values[3] * values[8] +
+            values[0] * values[5] * values[7];
 
         return positive - negative;
     }
 
     template <typename DataT>
-    TMatrix<3, 3, DataT> Inverse<3, 3, DataT>::compute(const TMatrix<3, 3, DataT>& mat)
+    constexpr TMatrix<3, 3, DataT> Inverse<3, 3, DataT>::compute(const TMatrix<3, 3, DataT>& mat)
     {
-        DataT oneOverDeterminant = static_cast<DataT>(1) / mat.determinant();
+        const DataT* values = mat.getArray();
 
         // 0 1 2
         // 3 4 5
         // 6 7 8
         TMatrix<3, 3, DataT> inv;
-        inv[0] = +(mat[4] * mat[8] - mat[5] * mat[7]) * oneOverDeterminant;
-        inv[1] = -(mat[1] * mat[8] - mat[2] * mat[7]) * oneOverDeterminant;
-        inv[2] = +(mat[1] * mat[5] - mat[2] * mat[4]) * oneOverDeterminant;
-        inv[3] = -(mat[3] * mat[8] - mat[5] * mat[6]) * oneOverDeterminant;
-        inv[4] = +(mat[0] * mat[8] - mat[2] * mat[6]) * oneOverDeterminant;
-        inv[5] = -(mat[0] * mat[5] - mat[2] * mat[3]) * oneOverDeterminant;
-        inv[6] = +(mat[3] * mat[7] - mat[4] * mat[6]) * oneOverDeterminant;
-        inv[7] = -(mat[0] * mat[7] - mat[1] * mat[6]) * oneOverDeterminant;
-        inv[8] = +(mat[0] * mat[4] - mat[1] * mat[3]) * oneOverDeterminant;
+        DataT*               invValues = inv.getArray();
+
+        // The first column of the adjugate holds the first row's cofactors, which gives the determinant for free
+        invValues[0] = +(values[4] * values[8] - values[5] * values[7]);
+        invValues[3] = -(values[3] * values[8] - values[5] * values[6]);
+        invValues[6] = +(values[3] * values[7] - values[4] * values[6]);
+
+        const DataT oneOverDeterminant = static_cast<DataT>(1) /
+            (values[0] * invValues[0] + values[1] * invValues[3] + values[2] * invValues[6]);
+
+        invValues[0] *= oneOverDeterminant;
+        invValues[3] *= oneOverDeterminant;
+        invValues[6] *= oneOverDeterminant;
+        invValues[1] = -(values[1] * values[8] - values[2] * values[7]) * oneOverDeterminant;
+        invValues[2] = +(values[1] * values[5] - values[2] * values[4]) * oneOverDeterminant;
+        invValues[4] = +(values[0] * values[8] - values[2] * values[6]) * oneOverDeterminant;
+        invValues[5] = -(values[0] * values[5] - values[2] * values[3]) * oneOverDeterminant;
+        invValues[7] = -(values[0] * values[7] - values[1] * values[6]) * oneOverDeterminant;
+        invValues[8] = +(values[0] * values[4] - values[1] * values[3]) * oneOverDeterminant;
 
         return inv;
     }
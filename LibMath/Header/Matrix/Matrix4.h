@@ -1,8 +1,10 @@
 #ifndef __LIBMATH__MATRIX__MATRIX4_H__
 #define __LIBMATH__MATRIX__MATRIX4_H__
 
+#include "Aligned.h"
 #include "TMatrix.h"
 #include "ERotationOrder.h"
+#include "Simd.h"
 
 namespace LibMath
 {
@@ -14,51 +16,98 @@ namespace LibMath
     template <class T>
     class TQuaternion;
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> translation(DataT x, DataT y, DataT z);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> translation(DataT x, DataT y, DataT z);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> translation(const TVector3<DataT>& translation);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> translation(const TVector3<DataT>& translation);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> scaling(DataT x, DataT y, DataT z);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> scaling(DataT x, DataT y, DataT z);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> scaling(const TVector3<DataT>& scale);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> scaling(const TVector3<DataT>& scale);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotation(const Radian& angle, const TVector3<DataT>& axis);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const Radian& angle, const TVector3<DataT>& axis);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotation(const Radian& yaw, const Radian& pitch, const Radian& roll);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const Radian& yaw, const Radian& pitch, const Radian& roll);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotation(const TVector3<Radian>& angles);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const TVector3<Radian>& angles);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotation(const TQuaternion<DataT>& quaternion);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const TQuaternion<DataT>& quaternion);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotationEuler(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotationEuler(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotationEuler(const TVector3<Radian>& angles);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotationEuler(const TVector3<Radian>& angles);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> rotationFromTo(const TVector3<DataT>& from, const TVector3<DataT>& to);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> rotationFromTo(const TVector3<DataT>& from, const TVector3<DataT>& to);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT>
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order>
     orthographicProjection(DataT left, DataT right, DataT bottom, DataT top, DataT zNear, DataT zFar);
 
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> perspectiveProjection(const Radian& fovY, DataT aspect, DataT zNear, DataT zFar);
-
-    template <class DataT = float>
-    constexpr TMatrix<4, 4, DataT> lookAt(const TVector3<DataT>& eye, const TVector3<DataT>& center, const TVector3<DataT>& up);
-
-    template <class DataT>
-    constexpr TVector3<Radian> toEuler(const TMatrix<4, 4, DataT>& matrix, ERotationOrder rotationOrder);
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> perspectiveProjection(const Radian& fovY, DataT aspect, DataT zNear, DataT zFar);
+
+    template <class DataT = float, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
+    constexpr TMatrix<4, 4, DataT, Order> lookAt(const TVector3<DataT>& eye, const TVector3<DataT>& center, const TVector3<DataT>& up);
+
+    template <class DataT, EMatrixOrder Order>
+    constexpr TVector3<Radian> toEuler(const TMatrix<4, 4, DataT, Order>& matrix, ERotationOrder rotationOrder);
+
+    template <typename DataT>
+    struct Details::Determinant<4, 4, DataT>
+    {
+        static constexpr DataT compute(const TMatrix<4, 4, DataT>& mat);
+    };
+
+    template <typename DataT>
+    struct Details::Inverse<4, 4, DataT>
+    {
+        static constexpr TMatrix<4, 4, DataT> compute(const TMatrix<4, 4, DataT>& mat);
+    };
+
+#ifdef LIBMATH_SIMD_SSE
+    /*
+     * SSE (or AVX when available) kernels for single precision 4x4 matrices.
+     * Products are accumulated in the same order as the generic implementation (column 0 to 3, without fused multiply-add)
+     * which makes their results bit-identical to it, the only exception being a sum of negative zeros which yields -0 instead of +0.
+     * If the compiler is allowed to contract the generic loop into fused multiply-adds (e.g. -mfma with -ffp-contract=fast),
+     * the generic path skips the intermediate roundings and the results can then differ by up to 1 ulp per accumulation (3 ulp).
+     * In constant evaluation, they fall back to the generic implementations.
+     */
+
+    template <>
+    struct Details::Multiply<4, 4, 4, float>
+    {
+        static constexpr TMatrix<4, 4, float> compute(const TMatrix<4, 4, float>& left, const TMatrix<4, 4, float>& right);
+    };
+
+    template <>
+    struct Details::Multiply<4, 4, 1, float>
+    {
+        static constexpr TMatrix<4, 1, float> compute(const TMatrix<4, 4, float>& left, const TMatrix<4, 1, float>& right);
+    };
+
+    template <>
+    struct Details::Multiply<1, 4, 4, float>
+    {
+        static constexpr TMatrix<1, 4, float> compute(const TMatrix<1, 4, float>& left, const TMatrix<4, 4, float>& right);
+    };
+
+    template <>
+    struct Details::Transpose<4, 4, float>
+    {
+        static constexpr TMatrix<4, 4, float> compute(const TMatrix<4, 4, float>& mat);
+    };
+#endif // LIBMATH_SIMD_SSE
 
     using Matrix4x2 = TMatrix<4, 2, float>;
 
@@ -66,6 +115,17 @@ namespace LibMath
 
     using Matrix4x4 = TMatrix<4, 4, float>;
     using Matrix4 = Matrix4x4;
+
+    using Matrix4RowMajor = TRowMajorMatrix<4, 4, float>;
+    using Matrix4ColumnMajor = TColumnMajorMatrix<4, 4, float>;
+
+    // 16 bytes aligned variant for aligned SIMD loads and stores
+    using Matrix4A = TAligned<Matrix4, 16>;
+
+    static_assert(std::is_trivially_copyable_v<Matrix4> && std::is_standard_layout_v<Matrix4>,
+        "Invalid Matrix4 - should be trivially copyable and standard layout");
+    static_assert(std::is_trivially_copyable_v<Matrix4A> && std::is_standard_layout_v<Matrix4A>,
+        "Invalid Matrix4A - should be trivially copyable and standard layout");
 }
 
 #include "Matrix4.inl"
@@ -1,6 +1,8 @@
 #ifndef __LIBMATH__MATRIX__MATRIX4_INL__
 #define __LIBMATH__MATRIX__MATRIX4_INL__
 
+#include <type_traits>
+
 #include "Angle.h"
 #include "Matrix4.h"
 #include "Quaternion.h"
@@ -9,10 +11,10 @@
 
 namespace LibMath
 {
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> translation(const DataT x, const DataT y, const DataT z)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> translation(const DataT x, const DataT y, const DataT z)
     {
-        TMatrix<4, 4, DataT> translationMatrix(1);
+        TMatrix<4, 4, DataT, Order> translationMatrix(1);
 
         translationMatrix(0, 3) = x;
         translationMatrix(1, 3) = y;
@@ -21,16 +23,16 @@ namespace LibMath
         return translationMatrix;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> translation(const TVector3<DataT>& translation)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> translation(const TVector3<DataT>& translation)
     {
-        return LibMath::translation(translation.m_x, translation.m_y, translation.m_z);
+        return LibMath::translation<DataT, Order>(translation.m_x, translation.m_y, translation.m_z);
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> scaling(const DataT x, const DataT y, const DataT z)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> scaling(const DataT x, const DataT y, const DataT z)
     {
-        TMatrix<4, 4, DataT> scalingMatrix;
+        TMatrix<4, 4, DataT, Order> scalingMatrix;
 
         scalingMatrix(0, 0) = x;
         scalingMatrix(1, 1) = y;
@@ -40,20 +42,21 @@ namespace LibMath
         return scalingMatrix;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> scaling(const TVector3<DataT>& scale)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> scaling(const TVector3<DataT>& scale)
     {
-        return scaling<DataT>(scale.m_x, scale.m_y, scale.m_z);
+        return scaling<DataT, Order>(scale.m_x, scale.m_y, scale.m_z);
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotation(const Radian& angle, const TVector3<DataT>& axis)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const Radian& angle, const TVector3<DataT>& axis)
     {
         const TVector3<DataT> dir = axis.normalized();
-        const DataT           cos = LibMath::cos(angle);
-        const DataT           sin = LibMath::sin(angle);
+        const SinCos          sinCos = LibMath::sinCos(angle);
+        const DataT           cos = sinCos.m_cos;
+        const DataT           sin = sinCos.m_sin;
 
-        TMatrix<4, 4, DataT> mat;
+        TMatrix<4, 4, DataT, Order> mat;
 
         mat(0, 0) = cos + dir.m_x * dir.m_x * (1 - cos);
         mat(0, 1) = dir.m_x * dir.m_y * (1 - cos) - dir.m_z * sin;
@@ -78,19 +81,14 @@ namespace LibMath
         return mat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotation(const Radian& yaw, const Radian& pitch, const Radian& roll)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const Radian& yaw, const Radian& pitch, const Radian& roll)
     {
-        const DataT cosYaw = cos(yaw);
-        const DataT sinYaw = sin(yaw);
-
-        const DataT cosPitch = cos(pitch);
-        const DataT sinPitch = sin(pitch);
+        const auto [sinYaw, cosYaw] = sinCos(yaw);
+        const auto [sinPitch, cosPitch] = sinCos(pitch);
+        const auto [sinRoll, cosRoll] = sinCos(roll);
 
-        const DataT cosRoll = cos(roll);
-        const DataT sinRoll = sin(roll);
-
-        TMatrix<4, 4, DataT> rotationMat;
+        TMatrix<4, 4, DataT, Order> rotationMat;
 
         rotationMat(0, 0) = cosYaw * cosRoll + sinYaw * sinPitch * sinRoll;
         rotationMat(0, 1) = -cosYaw * sinRoll + sinYaw * sinPitch * cosRoll;
@@ -115,16 +113,16 @@ namespace LibMath
         return rotationMat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotation(const TVector3<Radian>& angles)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const TVector3<Radian>& angles)
     {
-        return rotation<DataT>(angles.m_x, angles.m_y, angles.m_z);
+        return rotation<DataT, Order>(angles.m_x, angles.m_y, angles.m_z);
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotation(const TQuaternion<DataT>& quaternion)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotation(const TQuaternion<DataT>& quaternion)
     {
-        TMatrix<4, 4, DataT> mat(static_cast<DataT>(1));
+        TMatrix<4, 4, DataT, Order> mat(static_cast<DataT>(1));
 
         DataT xSqr = quaternion.m_x * quaternion.m_x;
         DataT ySqr = quaternion.m_y * quaternion.m_y;
@@ -154,38 +152,38 @@ namespace LibMath
         return mat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotationEuler(const Radian& xAngle, const Radian& yAngle,
-                                                 const Radian& zAngle)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotationEuler(const Radian& xAngle, const Radian& yAngle,
+                                                        const Radian& zAngle)
     {
-        return rotation<DataT>(zAngle, xAngle, yAngle);
+        return rotation<DataT, Order>(zAngle, xAngle, yAngle);
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotationEuler(const TVector3<Radian>& angles)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotationEuler(const TVector3<Radian>& angles)
     {
-        return rotationEuler<DataT>(angles.m_x, angles.m_y, angles.m_z);
+        return rotationEuler<DataT, Order>(angles.m_x, angles.m_y, angles.m_z);
     }
 
     // Adapted from https://gist.github.com/kevinmoran/b45980723e53edeb8a5a43c49f134724
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> rotationFromTo(const TVector3<DataT>& from, const TVector3<DataT>& to)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> rotationFromTo(const TVector3<DataT>& from, const TVector3<DataT>& to)
     {
         const auto& fromDir = from.normalized();
         const auto& toDir = to.normalized();
 
         if (toDir == fromDir)
-            return TMatrix<4, 4, DataT>(1);
+            return TMatrix<4, 4, DataT, Order>(1);
 
         if (toDir == -fromDir)
-            return scaling<DataT>(-1, -1, -1);
+            return scaling<DataT, Order>(-1, -1, -1);
 
         const TVector3<DataT> axis = from.cross(to);
 
         const DataT cosA = from.dot(to);
         const DataT k = static_cast<DataT>(1) / (static_cast<DataT>(1) + cosA);
 
-        TMatrix<4, 4, DataT> rotationMat;
+        TMatrix<4, 4, DataT, Order> rotationMat;
 
         rotationMat(0, 0) = (axis.m_x * axis.m_x * k) + cosA;
         rotationMat(0, 1) = (axis.m_y * axis.m_x * k) - axis.m_z;
@@ -210,11 +208,11 @@ namespace LibMath
         return rotationMat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> orthographicProjection(const DataT left, const DataT   right,
-                                                          const DataT bottom, const DataT top, const DataT zNear, const DataT zFar)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> orthographicProjection(const DataT left, const DataT   right,
+                                                                 const DataT bottom, const DataT top, const DataT zNear, const DataT zFar)
     {
-        TMatrix<4, 4, DataT> mat;
+        TMatrix<4, 4, DataT, Order> mat;
 
         mat(0, 0) = static_cast<DataT>(2) / (right - left);
         mat(0, 3) = (right + left) / (left - right);
@@ -230,13 +228,13 @@ namespace LibMath
         return mat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> perspectiveProjection(const Radian& fovY,
-                                                         const DataT   aspect, const DataT zNear, const DataT zFar)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> perspectiveProjection(const Radian& fovY,
+                                                                const DataT   aspect, const DataT zNear, const DataT zFar)
     {
         const DataT tanHalfFovY = tan(fovY * .5f);
 
-        TMatrix<4, 4, DataT> mat;
+        TMatrix<4, 4, DataT, Order> mat;
 
         mat(0, 0) = static_cast<DataT>(1) / (aspect * tanHalfFovY);
         mat(1, 1) = static_cast<DataT>(1) / tanHalfFovY;
@@ -247,15 +245,15 @@ namespace LibMath
         return mat;
     }
 
-    template <class DataT>
-    constexpr TMatrix<4, 4, DataT> lookAt(const TVector3<DataT>& eye, const TVector3<DataT>& center,
-                                          const TVector3<DataT>& up)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TMatrix<4, 4, DataT, Order> lookAt(const TVector3<DataT>& eye, const TVector3<DataT>& center,
+                                                 const TVector3<DataT>& up)
     {
         const TVector3<DataT> f = (center - eye).normalized();
         const TVector3<DataT> s = f.cross(up).normalized();
         const TVector3<DataT> u = s.cross(f);
 
-        TMatrix<4, 4, DataT> mat;
+        TMatrix<4, 4, DataT, Order> mat;
 
         mat(0, 0) = s.m_x;
         mat(0, 1) = s.m_y;
@@ -277,8 +275,8 @@ namespace LibMath
         return mat;
     }
 
-    template <class DataT>
-    constexpr TVector3<Radian> toEuler(const TMatrix<4, 4, DataT>& matrix, const ERotationOrder rotationOrder)
+    template <class DataT, EMatrixOrder Order>
+    constexpr TVector3<Radian> toEuler(const TMatrix<4, 4, DataT, Order>& matrix, const ERotationOrder rotationOrder)
     {
         using T = floating_t<DataT>;
         TVector3<Radian> angles;
@@ -292,8 +290,7 @@ namespace LibMath
             const T c2 = squareRoot(matrix(0, 0) * matrix(0, 0) + matrix(0, 1) * matrix(0, 1));
             angles.m_y = -atan(-matrix(0, 2), c2);
 
-            const T s1 = sin(-angles.m_x);
-            const T c1 = cos(-angles.m_x);
+            const auto [s1, c1] = sinCos(-angles.m_x);
             angles.m_z = -atan(s1 * matrix(2, 0) - c1 * matrix(1, 0), c1 * matrix(1, 1) - s1 * matrix(2, 1));
             break;
         }
@@ -304,8 +301,7 @@ namespace LibMath
             T c2 = squareRoot(matrix(0, 0) * matrix(0, 0) + matrix(0, 2) * matrix(0, 2));
             angles.m_z = atan(-matrix(0, 1), c2);
 
-            T s1 = sin(angles.m_x);
-            T c1 = cos(angles.m_x);
+            const auto [s1, c1] = sinCos(angles.m_x);
             angles.m_y = atan(s1 * matrix(1, 0) - c1 * matrix(2, 0), c1 * matrix(2, 2) - s1 * matrix(1, 2));
             break;
         }
@@ -316,8 +312,7 @@ namespace LibMath
             const T c2 = squareRoot(matrix(1, 0) * matrix(1, 0) + matrix(1, 1) * matrix(1, 1));
             angles.m_x = atan(-matrix(1, 2), c2);
 
-            const T s1 = sin(angles.m_y);
-            const T c1 = cos(angles.m_y);
+            const auto [s1, c1] = sinCos(angles.m_y);
             angles.m_z = atan(s1 * matrix(2, 1) - c1 * matrix(0, 1), c1 * matrix(0, 0) - s1 * matrix(2, 0));
 
             break;
@@ -329,8 +324,7 @@ namespace LibMath
             T c2 = squareRoot(matrix(1, 1) * matrix(1, 1) + matrix(1, 2) * matrix(1, 2));
             angles.m_z = atan(matrix(1, 0), c2);
 
-            T s1 = sin(angles.m_y);
-            T c1 = cos(angles.m_y);
+            const auto [s1, c1] = sinCos(angles.m_y);
             angles.m_x = atan(s1 * matrix(0, 1) + c1 * matrix(2, 1), s1 * matrix(0, 2) + c1 * matrix(2, 2));
             break;
         }
@@ -341,8 +335,7 @@ namespace LibMath
             T c2 = squareRoot(matrix(2, 0) * matrix(2, 0) + matrix(2, 2) * matrix(2, 2));
             angles.m_x = atan(matrix(2, 1), c2);
 
-            T s1 = sin(angles.m_z);
-            T c1 = cos(angles.m_z);
+            const auto [s1, c1] = sinCos(angles.m_z);
             angles.m_y = atan(c1 * matrix(0, 2) + s1 * matrix(1, 2), c1 * matrix(0, 0) + s1 * matrix(1, 0));
             break;
         }
@@ -353,8 +346,7 @@ namespace LibMath
             T c2 = squareRoot(matrix(2, 1) * matrix(2, 1) + matrix(2, 2) * matrix(2, 2));
             angles.m_y = atan(-matrix(2, 0), c2);
 
-            T s1 = sin(angles.m_z);
-            T c1 = cos(angles.m_z);
+            const auto [s1, c1] = sinCos(angles.m_z);
             angles.m_x = atan(s1 * matrix(0, 2) - c1 * matrix(1, 2), c1 * matrix(1, 1) - s1 * matrix(0, 1));
             break;
         }
@@ -364,4 +356,218 @@ namespace LibMath
     }
 }
 
+namespace LibMath::Details
+{
+    template <typename DataT>
+    constexpr DataT Determinant<4, 4, DataT>::compute(const TMatrix<4, 4, DataT>& mat)
+    {
+        const DataT* values = mat.getArray();
+
+        //  0  1  2  3
+        //  4  5  6  7
+        //  8  9 10 11
+        // 12 13 14 15
+        // Laplace expansion along the two first rows using their 2x2 sub-determinants and the complementary ones from the two last rows
+        const DataT s0 = values[0] * values[5] - values[4] * values[1];
+        const DataT s1 = values[0] * values[6] - values[4] * values[2];
+        const DataT s2 = values[0] * values[7] - values[4] * values[3];
+        const DataT s3 = values[1] * values[6] - values[5] * values[2];
+        const DataT s4 = values[1] * values[7] - values[5] * values[3];
+        const DataT s5 = values[2] * values[7] - values[6] * values[3];
+
+        const DataT c0 = values[8] * values[13] - values[12] * values[9];
+        const DataT c1 = values[8] * values[14] - values[12] * values[10];
+        const DataT c2 = values[8] * values[15] - values[12] * values[11];
+        const DataT c3 = values[9] * values[14] - values[13] * values[10];
+        const DataT c4 = values[9] * values[15] - values[13] * values[11];
+        const DataT c5 = values[10] * values[15] - values[14] * values[11];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+
+    template <typename DataT>
+    constexpr TMatrix<4, 4, DataT> Inverse<4, 4, DataT>::compute(const TMatrix<4, 4, DataT>& mat)
+    {
+        const DataT* values = mat.getArray();
+
+        //  0  1  2  3
+        //  4  5  6  7
+        //  8  9 10 11
+        // 12 13 14 15
+        const DataT s0 = values[0] * values[5] - values[4] * values[1];
+        const DataT s1 = values[0] * values[6] - values[4] * values[2];
+        const DataT s2 = values[0] * values[7] - values[4] * values[3];
+        const DataT s3 = values[1] * values[6] - values[5] * values[2];
+        const DataT s4 = values[1] * values[7] - values[5] * values[3];
+        const DataT s5 = values[2] * values[7] - values[6] * values[3];
+
+        const DataT c0 = values[8] * values[13] - values[12] * values[9];
+        const DataT c1 = values[8] * values[14] - values[12] * values[10];
+        const DataT c2 = values[8] * values[15] - values[12] * values[11];
+        const DataT c3 = values[9] * values[14] - values[13] * values[10];
+        const DataT c4 = values[9] * values[15] - values[13] * values[11];
+        const DataT c5 = values[10] * values[15] - values[14] * values[11];
+
+        const DataT oneOverDeterminant = static_cast<DataT>(1) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+        TMatrix<4, 4, DataT> inv;
+        DataT*               invValues = inv.getArray();
+
+        invValues[0]  = +(values[5] * c5 - values[6] * c4 + values[7] * c3) * oneOverDeterminant;
+        invValues[1]  = -(values[1] * c5 - values[2] * c4 + values[3] * c3) * oneOverDeterminant;
+        invValues[2]  = +(values[13] * s5 - values[14] * s4 + values[15] * s3) * oneOverDeterminant;
+        invValues[3]  = -(values[9] * s5 - values[10] * s4 + values[11] * s3) * oneOverDeterminant;
+
+        invValues[4]  = -(values[4] * c5 - values[6] * c2 + values[7] * c1) * oneOverDeterminant;
+        invValues[5]  = +(values[0] * c5 - values[2] * c2 + values[3] * c1) * oneOverDeterminant;
+        invValues[6]  = -(values[12] * s5 - values[14] * s2 + values[15] * s1) * oneOverDeterminant;
+        invValues[7]  = +(values[8] * s5 - values[10] * s2 + values[11] * s1) * oneOverDeterminant;
+
+        invValues[8]  = +(values[4] * c4 - values[5] * c2 + values[7] * c0) * oneOverDeterminant;
+        invValues[9]  = -(values[0] * c4 - values[1] * c2 + values[3] * c0) * oneOverDeterminant;
+        invValues[10] = +(values[12] * s4 - values[13] * s2 + values[15] * s0) * oneOverDeterminant;
+        invValues[11] = -(values[8] * s4 - values[9] * s2 + values[11] * s0) * oneOverDeterminant;
+
+        invValues[12] = -(values[4] * c3 - values[5] * c1 + values[6] * c0) * oneOverDeterminant;
+        invValues[13] = +(values[0] * c3 - values[1] * c1 + values[2] * c0) * oneOverDeterminant;
+        invValues[14] = -(values[12] * s3 - values[13] * s1 + values[14] * s0) * oneOverDeterminant;
+        invValues[15] = +(values[8] * s3 - values[9] * s1 + values[10] * s0) * oneOverDeterminant;
+
+        return inv;
+    }
+}
+
+#ifdef LIBMATH_SIMD_SSE
+namespace LibMath::Details
+{
+    constexpr TMatrix<4, 4, float> Multiply<4, 4, 4, float>::compute(const TMatrix<4, 4, float>& left,
+        const TMatrix<4, 4, float>& right)
+    {
+        if (std::is_constant_evaluated())
+            return GenericMultiply<4, 4, 4, float>::compute(left, right);
+
+        const float* leftValues  = left.getArray();
+        const float* rightValues = right.getArray();
+
+        TMatrix<4, 4, float> result;
+        float*               resultValues = result.getArray();
+
+        // Each result row is the sum of the right matrix's rows weighted by the corresponding row of the left matrix
+#ifdef LIBMATH_SIMD_AVX
+        // Duplicate the right matrix's rows in both 128 bits lanes to compute two result rows at once
+        __m256 rightRows[4];
+
+        for (int i = 0; i < 4; i++)
+        {
+            const __m128 rightRow = _mm_loadu_ps(rightValues + i * 4);
+            rightRows[i]          = _mm256_insertf128_ps(_mm256_castps128_ps256(rightRow), rightRow, 1);
+        }
+
+        for (int row = 0; row < 4; row += 2)
+        {
+            const __m256 leftRows = _mm256_loadu_ps(leftValues + row * 4);
+
+            __m256 resultRows = _mm256_mul_ps(_mm256_shuffle_ps(leftRows, leftRows, 0x00), rightRows[0]);
+            resultRows        = _mm256_add_ps(resultRows, _mm256_mul_ps(_mm256_shuffle_ps(leftRows, leftRows, 0x55), rightRows[1]));
+            resultRows        = _mm256_add_ps(resultRows, _mm256_mul_ps(_mm256_shuffle_ps(leftRows, leftRows, 0xAA), rightRows[2]));
+            resultRows        = _mm256_add_ps(resultRows, _mm256_mul_ps(_mm256_shuffle_ps(leftRows, leftRows, 0xFF), rightRows[3]));
+
+            _mm256_storeu_ps(resultValues + row * 4, resultRows);
+        }
+#else
+        const __m128 rightRow0 = _mm_loadu_ps(rightValues);
+        const __m128 rightRow1 = _mm_loadu_ps(rightValues + 4);
+        const __m128 rightRow2 = _mm_loadu_ps(rightValues + 8);
+        const __m128 rightRow3 = _mm_loadu_ps(rightValues + 12);
+
+        for (int row = 0; row < 4; row++)
+        {
+            const float* leftRow = leftValues + row * 4;
+
+            __m128 resultRow = _mm_mul_ps(_mm_set1_ps(leftRow[0]), rightRow0);
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[1]), rightRow1));
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[2]), rightRow2));
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[3]), rightRow3));
+
+            _mm_storeu_ps(resultValues + row * 4, resultRow);
+        }
+#endif // LIBMATH_SIMD_AVX
+
+        return result;
+    }
+
+    constexpr TMatrix<4, 1, float> Multiply<4, 4, 1, float>::compute(const TMatrix<4, 4, float>& left,
+        const TMatrix<4, 1, float>& right)
+    {
+        if (std::is_constant_evaluated())
+            return GenericMultiply<4, 4, 1, float>::compute(left, right);
+
+        const float* leftValues  = left.getArray();
+        const float* rightValues = right.getArray();
+
+        // Work on the left matrix's columns to keep the generic implementation's summation order
+        __m128 col0 = _mm_loadu_ps(leftValues);
+        __m128 col1 = _mm_loadu_ps(leftValues + 4);
+        __m128 col2 = _mm_loadu_ps(leftValues + 8);
+        __m128 col3 = _mm_loadu_ps(leftValues + 12);
+        _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+        __m128 resultCol = _mm_mul_ps(col0, _mm_set1_ps(rightValues[0]));
+        resultCol        = _mm_add_ps(resultCol, _mm_mul_ps(col1, _mm_set1_ps(rightValues[1])));
+        resultCol        = _mm_add_ps(resultCol, _mm_mul_ps(col2, _mm_set1_ps(rightValues[2])));
+        resultCol        = _mm_add_ps(resultCol, _mm_mul_ps(col3, _mm_set1_ps(rightValues[3])));
+
+        TMatrix<4, 1, float> result;
+        _mm_storeu_ps(result.getArray(), resultCol);
+
+        return result;
+    }
+
+    constexpr TMatrix<1, 4, float> Multiply<1, 4, 4, float>::compute(const TMatrix<1, 4, float>& left,
+        const TMatrix<4, 4, float>& right)
+    {
+        if (std::is_constant_evaluated())
+            return GenericMultiply<1, 4, 4, float>::compute(left, right);
+
+        const float* leftValues  = left.getArray();
+        const float* rightValues = right.getArray();
+
+        // Row vector times matrix (e.g. a column-major matrix times a column vector) - sum of the right matrix's weighted rows
+        __m128 resultRow = _mm_mul_ps(_mm_set1_ps(leftValues[0]), _mm_loadu_ps(rightValues));
+        resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftValues[1]), _mm_loadu_ps(rightValues + 4)));
+        resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftValues[2]), _mm_loadu_ps(rightValues + 8)));
+        resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftValues[3]), _mm_loadu_ps(rightValues + 12)));
+
+        TMatrix<1, 4, float> result;
+        _mm_storeu_ps(result.getArray(), resultRow);
+
+        return result;
+    }
+
+    constexpr TMatrix<4, 4, float> Transpose<4, 4, float>::compute(const TMatrix<4, 4, float>& mat)
+    {
+        if (std::is_constant_evaluated())
+            return GenericTranspose<4, 4, float>::compute(mat);
+
+        const float* values = mat.getArray();
+
+        __m128 row0 = _mm_loadu_ps(values);
+        __m128 row1 = _mm_loadu_ps(values + 4);
+        __m128 row2 = _mm_loadu_ps(values + 8);
+        __m128 row3 = _mm_loadu_ps(values + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        TMatrix<4, 4, float> transposed;
+        float*               transposedValues = transposed.getArray();
+
+        _mm_storeu_ps(transposedValues, row0);
+        _mm_storeu_ps(transposedValues + 4, row1);
+        _mm_storeu_ps(transposedValues + 8, row2);
+        _mm_storeu_ps(transposedValues + 12, row3);
+
+        return transposed;
+    }
+}
+#endif // LIBMATH_SIMD_SSE
+
 #endif // !__LIBMATH__MATRIX__MATRIX4_INL__
@@ -0,0 +1,142 @@
+#ifndef __LIBMATH__MATRIX__MATRIX4BATCH_H__
+#define __LIBMATH__MATRIX__MATRIX4BATCH_H__
+
+#include <span>
+
+#include "Matrix4.h"
+#include "EExecutionPolicy.h"
+#include "Vector/Vector3.h"
+#include "Vector/Vector4.h"
+
+namespace LibMath
+{
+    /**
+     * \brief Multiplies each matrix of the left batch by the matching matrix of the right batch (i.e. out[i] = left[i] * right[i])
+     * \param left The left operands
+     * \param right The right operands
+     * \param out The output batch. Should have the same size as the operands. Can be one of the operands
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void multiply(std::span<const Matrix4> left, std::span<const Matrix4> right, std::span<Matrix4> out,
+                         EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Multiplies the given matrix by each matrix of the right batch (i.e. out[i] = left * right[i])
+     * \param left The shared left operand (e.g. a view-projection matrix)
+     * \param right The right operands
+     * \param out The output batch. Should have the same size as the right batch. Can be the right batch
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void multiply(const Matrix4& left, std::span<const Matrix4> right, std::span<Matrix4> out,
+                         EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Multiplies each matrix of the left batch by the given matrix (i.e. out[i] = left[i] * right)
+     * \param left The left operands
+     * \param right The shared right operand
+     * \param out The output batch. Should have the same size as the left batch. Can be the left batch
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void multiply(std::span<const Matrix4> left, const Matrix4& right, std::span<Matrix4> out,
+                         EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given points by the given affine matrix (i.e. out[i] = (matrix * Vector4(points[i], 1)).xyz())
+     * \param matrix The transformation matrix
+     * \param points The points to transform
+     * \param out The transformed points. Should have the same size as the source points. Can be the source points
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPoints(const Matrix4& matrix, std::span<const Vector3> points, std::span<Vector3> out,
+                                EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given points in place by the given affine matrix
+     * \param matrix The transformation matrix
+     * \param points The points to transform
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPoints(const Matrix4& matrix, std::span<Vector3> points, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given homogeneous vectors by the given matrix (i.e. out[i] = matrix * vectors[i])
+     * \param matrix The transformation matrix
+     * \param vectors The vectors to transform
+     * \param out The transformed vectors. Should have the same size as the source vectors. Can be the source vectors
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPoints(const Matrix4& matrix, std::span<const Vector4> vectors, std::span<Vector4> out,
+                                EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given homogeneous vectors in place by the given matrix
+     * \param matrix The transformation matrix
+     * \param vectors The vectors to transform
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPoints(const Matrix4& matrix, std::span<Vector4> vectors, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given directions by the given matrix, ignoring its translation
+     * (i.e. out[i] = (matrix * Vector4(directions[i], 0)).xyz())
+     * \param matrix The transformation matrix
+     * \param directions The directions to transform
+     * \param out The transformed directions. Should have the same size as the source directions. Can be the source directions
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformDirections(const Matrix4& matrix, std::span<const Vector3> directions, std::span<Vector3> out,
+                                    EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given directions in place by the given matrix, ignoring its translation
+     * \param matrix The transformation matrix
+     * \param directions The directions to transform
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformDirections(const Matrix4& matrix, std::span<Vector3> directions,
+                                    EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given points by the given projective matrix and applies the perspective division
+     * (i.e. out[i] = transformed.xyz() / transformed.m_w where transformed = matrix * Vector4(points[i], 1))
+     * \param matrix The transformation matrix (e.g. a view-projection matrix)
+     * \param points The points to transform
+     * \param out The transformed points. Should have the same size as the source points. Can be the source points
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPointsProjective(const Matrix4& matrix, std::span<const Vector3> points, std::span<Vector3> out,
+                                          EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given points in place by the given projective matrix and applies the perspective division
+     * \param matrix The transformation matrix (e.g. a view-projection matrix)
+     * \param points The points to transform
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPointsProjective(const Matrix4& matrix, std::span<Vector3> points,
+                                          EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given homogeneous vectors by the given projective matrix and applies the perspective division
+     * (i.e. out[i] = transformed / transformed.m_w where transformed = matrix * vectors[i])
+     * \param matrix The transformation matrix (e.g. a view-projection matrix)
+     * \param vectors The vectors to transform
+     * \param out The transformed vectors. Should have the same size as the source vectors. Can be the source vectors
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPointsProjective(const Matrix4& matrix, std::span<const Vector4> vectors, std::span<Vector4> out,
+                                          EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Transforms the given homogeneous vectors in place by the given projective matrix and applies the perspective division
+     * \param matrix The transformation matrix (e.g. a view-projection matrix)
+     * \param vectors The vectors to transform
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void transformPointsProjective(const Matrix4& matrix, std::span<Vector4> vectors,
+                                          EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+}
+
+#include "Matrix4Batch.inl"
+
+#endif // !__LIBMATH__MATRIX__MATRIX4BATCH_H__
@@ -0,0 +1,390 @@
+#ifndef __LIBMATH__MATRIX__MATRIX4BATCH_INL__
+#define __LIBMATH__MATRIX__MATRIX4BATCH_INL__
+
+#include <cassert>
+
+#include "Batch.h"
+#include "Matrix4Batch.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+#if defined(LIBMATH_SIMD_AVX)
+        /**
+         * \brief Loads the given matrix's rows, duplicated in both 128 bits lanes to compute two result rows at once
+         */
+        inline void loadDuplicatedRows(const float* values, __m256 (&rows)[4])
+        {
+            for (int row = 0; row < 4; row++)
+                rows[row] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(values + row * 4));
+        }
+
+        /**
+         * \brief Computes two rows of a 4x4 matrix product from the left rows' weights and the right matrix's duplicated rows
+         */
+        inline __m256 multiplyRows(const __m256 (&leftWeights)[4], const __m256 (&rightRows)[4])
+        {
+            __m256 resultRows = _mm256_mul_ps(leftWeights[0], rightRows[0]);
+            resultRows        = _mm256_add_ps(resultRows, _mm256_mul_ps(leftWeights[1], rightRows[1]));
+            resultRows        = _mm256_add_ps(resultRows, _mm256_mul_ps(leftWeights[2], rightRows[2]));
+            return _mm256_add_ps(resultRows, _mm256_mul_ps(leftWeights[3], rightRows[3]));
+        }
+
+        /**
+         * \brief Extracts the weights of two consecutive left rows (each lane holding one row's weights)
+         */
+        inline void loadRowWeights(const float* leftRows, __m256 (&weights)[4])
+        {
+            const __m256 rows = _mm256_loadu_ps(leftRows);
+
+            weights[0] = _mm256_shuffle_ps(rows, rows, 0x00);
+            weights[1] = _mm256_shuffle_ps(rows, rows, 0x55);
+            weights[2] = _mm256_shuffle_ps(rows, rows, 0xAA);
+            weights[3] = _mm256_shuffle_ps(rows, rows, 0xFF);
+        }
+#elif defined(LIBMATH_SIMD_SSE)
+        /**
+         * \brief Computes a row of a 4x4 matrix product from the left row's values and the right matrix's rows
+         */
+        inline __m128 multiplyRow(const float* leftRow, const __m128 (&rightRows)[4])
+        {
+            __m128 resultRow = _mm_mul_ps(_mm_set1_ps(leftRow[0]), rightRows[0]);
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[1]), rightRows[1]));
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[2]), rightRows[2]));
+            return _mm_add_ps(resultRow, _mm_mul_ps(_mm_set1_ps(leftRow[3]), rightRows[3]));
+        }
+
+        /**
+         * \brief Computes a row of a 4x4 matrix product from the left row's splatted values and the right matrix's values
+         */
+        inline __m128 multiplyRow(const __m128 (&leftWeights)[4], const float* rightValues)
+        {
+            __m128 resultRow = _mm_mul_ps(leftWeights[0], _mm_loadu_ps(rightValues));
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(leftWeights[1], _mm_loadu_ps(rightValues + 4)));
+            resultRow        = _mm_add_ps(resultRow, _mm_mul_ps(leftWeights[2], _mm_loadu_ps(rightValues + 8)));
+            return _mm_add_ps(resultRow, _mm_mul_ps(leftWeights[3], _mm_loadu_ps(rightValues + 12)));
+        }
+#endif
+
+        /**
+         * \brief Computes out[i] = left[i * LeftStride] * right[i * RightStride] for every i in [begin, end)
+         * \note A stride of 0 broadcasts the matching operand, which is then only loaded once.
+         * Each product is fully computed before being stored so the output can be one of the operands
+         */
+        template <size_t LeftStride, size_t RightStride>
+        void multiplyRange(const Matrix4* left, const Matrix4* right, Matrix4* out, const size_t begin, const size_t end)
+        {
+#if defined(LIBMATH_SIMD_AVX)
+            __m256 leftWeights[2][4];
+            __m256 rightRows[4];
+
+            if constexpr (LeftStride == 0)
+            {
+                loadRowWeights(left->getArray(), leftWeights[0]);
+                loadRowWeights(left->getArray() + 8, leftWeights[1]);
+            }
+
+            if constexpr (RightStride == 0)
+                loadDuplicatedRows(right->getArray(), rightRows);
+
+            for (size_t i = begin; i < end; i++)
+            {
+                if constexpr (LeftStride != 0)
+                {
+                    loadRowWeights(left[i * LeftStride].getArray(), leftWeights[0]);
+                    loadRowWeights(left[i * LeftStride].getArray() + 8, leftWeights[1]);
+                }
+
+                if constexpr (RightStride != 0)
+                    loadDuplicatedRows(right[i * RightStride].getArray(), rightRows);
+
+                const __m256 firstRows = multiplyRows(leftWeights[0], rightRows);
+                const __m256 lastRows  = multiplyRows(leftWeights[1], rightRows);
+
+                float* resultValues = out[i].getArray();
+                _mm256_storeu_ps(resultValues, firstRows);
+                _mm256_storeu_ps(resultValues + 8, lastRows);
+            }
+#elif defined(LIBMATH_SIMD_SSE)
+            // Only 16 registers - splat the left matrix's values on the fly unless it is shared by every product
+            if constexpr (LeftStride == 0)
+            {
+                __m128 leftWeights[4][4];
+
+                for (int row = 0; row < 4; row++)
+                {
+                    for (int col = 0; col < 4; col++)
+                        leftWeights[row][col] = _mm_set1_ps((*left)[row * 4 + col]);
+                }
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    const float* rightValues = right[i * RightStride].getArray();
+                    __m128       resultRows[4];
+
+                    for (int row = 0; row < 4; row++)
+                        resultRows[row] = multiplyRow(leftWeights[row], rightValues);
+
+                    float* resultValues = out[i].getArray();
+
+                    for (int row = 0; row < 4; row++)
+                        _mm_storeu_ps(resultValues + row * 4, resultRows[row]);
+                }
+            }
+            else
+            {
+                __m128 rightRows[4];
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (RightStride != 0 || i == begin)
+                    {
+                        for (int row = 0; row < 4; row++)
+                            rightRows[row] = _mm_loadu_ps(right[i * RightStride].getArray() + row * 4);
+                    }
+
+                    const float* leftValues = left[i * LeftStride].getArray();
+                    __m128       resultRows[4];
+
+                    for (int row = 0; row < 4; row++)
+                        resultRows[row] = multiplyRow(leftValues + row * 4, rightRows);
+
+                    float* resultValues = out[i].getArray();
+
+                    for (int row = 0; row < 4; row++)
+                        _mm_storeu_ps(resultValues + row * 4, resultRows[row]);
+                }
+            }
+#else
+            for (size_t i = begin; i < end; i++)
+                out[i] = Multiply<4, 4, 4, float>::compute(left[i * LeftStride], right[i * RightStride]);
+#endif
+        }
+
+        /**
+         * \brief The kinds of vector transformations supported by the batch kernels
+         */
+        enum class ETransformKind
+        {
+            POINT,     // matrix * vector, with an implicit w of 1 for 3D points
+            DIRECTION, // matrix * vector, with an implicit w of 0 (3D only)
+            PROJECTIVE // matrix * vector followed by the perspective division
+        };
+
+        /**
+         * \brief Transforms a single vector - used by the scalar fallback and for the batches' remainders
+         */
+        template <ETransformKind Kind>
+        Vector3 transformVector(const Matrix4& matrix, const Vector3& vector)
+        {
+            if constexpr (Kind == ETransformKind::DIRECTION)
+                return (matrix * Vector4(vector, 0.f)).xyz();
+
+            const Vector4 transformed = matrix * Vector4(vector, 1.f);
+
+            if constexpr (Kind == ETransformKind::PROJECTIVE)
+                return transformed.xyz() / transformed.m_w;
+            else
+                return transformed.xyz();
+        }
+
+        template <ETransformKind Kind>
+        Vector4 transformVector(const Matrix4& matrix, const Vector4& vector)
+        {
+            static_assert(Kind != ETransformKind::DIRECTION, "Invalid transform - homogeneous vectors already hold their w");
+
+            const Vector4 transformed = matrix * vector;
+
+            if constexpr (Kind == ETransformKind::PROJECTIVE)
+                return transformed / transformed.m_w;
+            else
+                return transformed;
+        }
+
+        /**
+         * \brief Transforms the vectors in [begin, end)
+         */
+        template <ETransformKind Kind>
+        void transformRange(const Matrix4& matrix, const Vector3* vectors, Vector3* out, size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            static_assert(sizeof(Vector3) == 3 * sizeof(float), "Invalid Vector3 - should be tightly packed");
+
+            // Work on 4 points at once in SoA form so each instruction handles one coordinate of 4 points
+            __m128 weights[4][4];
+
+            for (int row = 0; row < 4; row++)
+            {
+                for (int col = 0; col < 4; col++)
+                    weights[row][col] = _mm_set1_ps(matrix[row * 4 + col]);
+            }
+
+            constexpr int rowCount = Kind == ETransformKind::PROJECTIVE ? 4 : 3;
+
+            for (; begin + 4 <= end; begin += 4)
+            {
+                __m128 xs, ys, zs;
+                loadDeinterleaved3(&vectors[begin].m_x, xs, ys, zs);
+
+                __m128 results[4];
+
+                for (int row = 0; row < rowCount; row++)
+                {
+                    results[row] = _mm_mul_ps(weights[row][0], xs);
+                    results[row] = _mm_add_ps(results[row], _mm_mul_ps(weights[row][1], ys));
+                    results[row] = _mm_add_ps(results[row], _mm_mul_ps(weights[row][2], zs));
+
+                    if constexpr (Kind != ETransformKind::DIRECTION)
+                        results[row] = _mm_add_ps(results[row], weights[row][3]);
+                }
+
+                if constexpr (Kind == ETransformKind::PROJECTIVE)
+                {
+                    for (int row = 0; row < 3; row++)
+                        results[row] = _mm_div_ps(results[row], results[3]);
+                }
+
+                storeInterleaved3(&out[begin].m_x, results[0], results[1], results[2]);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                out[begin] = transformVector<Kind>(matrix, vectors[begin]);
+        }
+
+        template <ETransformKind Kind>
+        void transformRange(const Matrix4& matrix, const Vector4* vectors, Vector4* out, const size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            static_assert(sizeof(Vector4) == 4 * sizeof(float), "Invalid Vector4 - should be tightly packed");
+
+            // Sum of the matrix's columns weighted by the vector's components
+            __m128 columns[4];
+
+            for (int row = 0; row < 4; row++)
+                columns[row] = _mm_loadu_ps(matrix.getArray() + row * 4);
+
+            _MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+            for (size_t i = begin; i < end; i++)
+            {
+                const __m128 vector = _mm_loadu_ps(&vectors[i].m_x);
+
+                __m128 result = _mm_mul_ps(columns[0], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+                result        = _mm_add_ps(result, _mm_mul_ps(columns[1], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+                result        = _mm_add_ps(result, _mm_mul_ps(columns[2], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+                result        = _mm_add_ps(result, _mm_mul_ps(columns[3], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+
+                if constexpr (Kind == ETransformKind::PROJECTIVE)
+                    result = _mm_div_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 3, 3, 3)));
+
+                _mm_storeu_ps(&out[i].m_x, result);
+            }
+#else
+            for (size_t i = begin; i < end; i++)
+                out[i] = transformVector<Kind>(matrix, vectors[i]);
+#endif // LIBMATH_SIMD_SSE
+        }
+
+        template <ETransformKind Kind, class VectorT>
+        void transformBatch(const Matrix4& matrix, const std::span<const VectorT> vectors, const std::span<VectorT> out,
+                            const EExecutionPolicy policy)
+        {
+            assert(vectors.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+            forEachRange(out.size(), policy, [&matrix, vectors = vectors.data(), out = out.data()](const size_t begin, const size_t end)
+            {
+                transformRange<Kind>(matrix, vectors, out, begin, end);
+            });
+        }
+
+        template <size_t LeftStride, size_t RightStride>
+        void multiplyBatch(const Matrix4* left, const Matrix4* right, Matrix4* out, const size_t count,
+                           const EExecutionPolicy policy)
+        {
+            forEachRange(count, policy, [left, right, out](const size_t begin, const size_t end)
+            {
+                multiplyRange<LeftStride, RightStride>(left, right, out, begin, end);
+            });
+        }
+    }
+
+    inline void multiply(const std::span<const Matrix4> left, const std::span<const Matrix4> right, const std::span<Matrix4> out,
+                         const EExecutionPolicy policy)
+    {
+        assert(left.size() == out.size() && right.size() == out.size() && "Invalid batch - operands and output sizes differ");
+        Details::multiplyBatch<1, 1>(left.data(), right.data(), out.data(), out.size(), policy);
+    }
+
+    inline void multiply(const Matrix4& left, const std::span<const Matrix4> right, const std::span<Matrix4> out,
+                         const EExecutionPolicy policy)
+    {
+        assert(right.size() == out.size() && "Invalid batch - operand and output sizes differ");
+        Details::multiplyBatch<0, 1>(&left, right.data(), out.data(), out.size(), policy);
+    }
+
+    inline void multiply(const std::span<const Matrix4> left, const Matrix4& right, const std::span<Matrix4> out,
+                         const EExecutionPolicy policy)
+    {
+        assert(left.size() == out.size() && "Invalid batch - operand and output sizes differ");
+        Details::multiplyBatch<1, 0>(left.data(), &right, out.data(), out.size(), policy);
+    }
+
+    inline void transformPoints(const Matrix4& matrix, const std::span<const Vector3> points, const std::span<Vector3> out,
+                                const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::POINT>(matrix, points, out, policy);
+    }
+
+    inline void transformPoints(const Matrix4& matrix, const std::span<Vector3> points, const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::POINT, Vector3>(matrix, points, points, policy);
+    }
+
+    inline void transformPoints(const Matrix4& matrix, const std::span<const Vector4> vectors, const std::span<Vector4> out,
+                                const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::POINT>(matrix, vectors, out, policy);
+    }
+
+    inline void transformPoints(const Matrix4& matrix, const std::span<Vector4> vectors, const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::POINT, Vector4>(matrix, vectors, vectors, policy);
+    }
+
+    inline void transformDirections(const Matrix4& matrix, const std::span<const Vector3> directions, const std::span<Vector3> out,
+                                    const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::DIRECTION>(matrix, directions, out, policy);
+    }
+
+    inline void transformDirections(const Matrix4& matrix, const std::span<Vector3> directions, const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::DIRECTION, Vector3>(matrix, directions, directions, policy);
+    }
+
+    inline void transformPointsProjective(const Matrix4& matrix, const std::span<const Vector3> points, const std::span<Vector3> out,
+                                          const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::PROJECTIVE>(matrix, points, out, policy);
+    }
+
+    inline void transformPointsProjective(const Matrix4& matrix, const std::span<Vector3> points, const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::PROJECTIVE, Vector3>(matrix, points, points, policy);
+    }
+
+    inline void transformPointsProjective(const Matrix4& matrix, const std::span<const Vector4> vectors, const std::span<Vector4> out,
+                                          const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::PROJECTIVE>(matrix, vectors, out, policy);
+    }
+
+    inline void transformPointsProjective(const Matrix4& matrix, const std::span<Vector4> vectors, const EExecutionPolicy policy)
+    {
+        Details::transformBatch<Details::ETransformKind::PROJECTIVE, Vector4>(matrix, vectors, vectors, policy);
+    }
+}
+
+#endif // !__LIBMATH__MATRIX__MATRIX4BATCH_INL__
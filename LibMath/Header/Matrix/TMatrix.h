@@ -2,83 +2,101 @@
 #define __LIBMATH__MATRIX__TMATRIX_H__
 #include <string>
 
+#include "EMatrixOrder.h"
+#include "Format.h"
+#include "Packet.h"
+
 namespace LibMath
 {
     using length_t = int;
 
-    template <length_t Rows, length_t Cols, typename DataT>
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order = EMatrixOrder::ROW_MAJOR>
     class TMatrix
     {
-        static_assert(std::is_arithmetic_v<DataT>, "Invalid matrix - data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<DataT>, "Invalid matrix - data type should be an arithmetic or packet type");
         static_assert(Rows > 0, "Invalid matrix - row count should be greater than zero");
         static_assert(Cols > 0, "Invalid matrix - column count should be greater than zero");
 
     public:
         constexpr          TMatrix();
         explicit constexpr TMatrix(DataT scalar);
-        constexpr          TMatrix(const TMatrix& other);
-        constexpr          TMatrix(TMatrix&& other) noexcept;
+        constexpr          TMatrix(const TMatrix& other) = default;
+        constexpr          TMatrix(TMatrix&& other) noexcept = default;
         ~TMatrix() = default;
 
-        TMatrix& operator=(const TMatrix& other);
-        TMatrix& operator=(TMatrix&& other) noexcept;
+        constexpr TMatrix& operator=(const TMatrix& other) = default;
+        constexpr TMatrix& operator=(TMatrix&& other) noexcept = default;
+
+        // Converts a matrix stored in the other order - the logical elements are kept and their storage is transposed
+        template <EMatrixOrder OtherOrder>
+            requires (OtherOrder != Order)
+        explicit constexpr TMatrix(const TMatrix<Rows, Cols, DataT, OtherOrder>& other);
 
         template <typename T>
-        operator TMatrix<Rows, Cols, T>();
+        constexpr operator TMatrix<Rows, Cols, T, Order>() const;
 
-        constexpr DataT operator[](size_t index) const;
-        DataT&          operator[](size_t index);
+        // Element accessors only check the received indices through assertions in debug builds and are unchecked in release builds
+        constexpr DataT  operator[](size_t index) const noexcept;
+        constexpr DataT& operator[](size_t index) noexcept;
 
-        DataT  operator()(length_t row, length_t column) const;
-        DataT& operator()(length_t row, length_t column);
+        constexpr DataT  operator()(length_t row, length_t column) const noexcept;
+        constexpr DataT& operator()(length_t row, length_t column) noexcept;
 
-        TMatrix& operator+=(const TMatrix& other);
-        TMatrix& operator-=(const TMatrix& other);
+        constexpr TMatrix& operator+=(const TMatrix& other);
+        constexpr TMatrix& operator-=(const TMatrix& other);
 
-        TMatrix& operator*=(const TMatrix& other);
-        TMatrix& operator/=(const TMatrix& other);
+        constexpr TMatrix& operator*=(const TMatrix& other);
+        constexpr TMatrix& operator/=(const TMatrix& other);
 
-        TMatrix& operator+=(DataT scalar);
-        TMatrix& operator-=(DataT scalar);
-        TMatrix& operator*=(DataT scalar);
-        TMatrix& operator/=(DataT scalar);
+        constexpr TMatrix& operator+=(DataT scalar);
+        constexpr TMatrix& operator-=(DataT scalar);
+        constexpr TMatrix& operator*=(DataT scalar);
+        constexpr TMatrix& operator/=(DataT scalar);
 
-        TMatrix operator+(const TMatrix& other) const;
-        TMatrix operator-(const TMatrix& other) const;
+        constexpr TMatrix operator+(const TMatrix& other) const;
+        constexpr TMatrix operator-(const TMatrix& other) const;
 
         template <length_t OtherRows, length_t OtherCols>
-        TMatrix<Rows, OtherCols, DataT> operator*(const TMatrix<OtherRows, OtherCols, DataT>& other) const;
-        TMatrix                         operator/(const TMatrix& other) const;
+        constexpr TMatrix<Rows, OtherCols, DataT, Order> operator*(const TMatrix<OtherRows, OtherCols, DataT, Order>& other) const;
+        constexpr TMatrix                         operator/(const TMatrix& other) const;
 
-        TMatrix operator+(DataT scalar) const;
-        TMatrix operator-(DataT scalar) const;
-        TMatrix operator*(DataT scalar) const;
-        TMatrix operator/(DataT scalar) const;
+        constexpr TMatrix operator+(DataT scalar) const;
+        constexpr TMatrix operator-(DataT scalar) const;
+        constexpr TMatrix operator*(DataT scalar) const;
+        constexpr TMatrix operator/(DataT scalar) const;
 
-        TMatrix operator-() const;
+        constexpr TMatrix operator-() const;
 
         constexpr bool operator==(const TMatrix& other) const;
         constexpr bool operator!=(const TMatrix& other) const;
         [[nodiscard]] constexpr bool isIdentity() const;
 
-        static constexpr length_t getRowCount();
-        static constexpr length_t getColumnCount();
-        static constexpr size_t   getSize();
+        static constexpr length_t     getRowCount();
+        static constexpr length_t     getColumnCount();
+        static constexpr size_t       getSize();
+        static constexpr EMatrixOrder getOrder();
+
+        static constexpr length_t getIndex(length_t row, length_t column) noexcept;
 
-        static length_t getIndex(length_t row, length_t column);
+        constexpr DataT*       getArray() noexcept;
+        constexpr const DataT* getArray() const noexcept;
 
-        DataT*       getArray();
-        const DataT* getArray() const;
+        constexpr DataT determinant() const;
+        constexpr DataT cofactor(length_t row, length_t column) const;
 
-        DataT determinant() const;
-        DataT cofactor(length_t row, length_t column) const;
+        constexpr TMatrix<Rows - 1, Cols - 1, DataT, Order> minor(length_t row, length_t column) const;
+        constexpr TMatrix<Cols, Rows, DataT, Order>         transposed() const;
+        constexpr TMatrix<Rows, Cols, DataT, Order>         coMatrix() const;
+        constexpr TMatrix<Cols, Rows, DataT, Order>         adjugate() const;
+        constexpr TMatrix<Rows, Cols, DataT, Order>         inverse() const;
 
-        TMatrix<Rows - 1, Cols - 1, DataT> minor(length_t row, length_t column) const;
-        TMatrix<Cols, Rows, DataT>         transposed() const;
-        TMatrix<Rows, Cols, DataT>         coMatrix() const;
-        TMatrix<Cols, Rows, DataT>         adjugate() const;
-        TMatrix<Rows, Cols, DataT>         inverse() const;
+        // Inverts an affine transformation matrix (i.e. whose last row is (0, ..., 0, 1)) from its linear part's inverse
+        constexpr TMatrix<Rows, Cols, DataT, Order> inverseAffine() const;
 
+        // Inverts a rigid transformation matrix (i.e. an affine matrix whose linear part is an orthonormal rotation) by transposition
+        constexpr TMatrix<Rows, Cols, DataT, Order> inverseRigid() const;
+
+        // Returns the matrix's elements in storage order
         std::string string() const;
         std::string stringLong() const;
 
@@ -86,28 +104,107 @@ namespace LibMath
         DataT m_values[Rows * Cols];
     };
 
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::ostream& operator<<(std::ostream& stream, const TMatrix<Rows, Cols, DataT, Order>& mat);
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::istream& operator>>(std::istream& stream, TMatrix<Rows, Cols, DataT, Order>& mat);
+
+    // Writes the matrix's string representation to [first, last) without allocating
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::to_chars_result formatTo(char* first, char* last, const TMatrix<Rows, Cols, DataT, Order>& mat);
+
+    // Parses a matrix's elements in storage order from the start of the given text. The matrix is left unchanged on failure
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::from_chars_result parse(std::string_view text, TMatrix<Rows, Cols, DataT, Order>& mat);
+
     template <length_t Rows, length_t Cols, typename DataT>
-    std::ostream& operator<<(std::ostream& stream, const TMatrix<Rows, Cols, DataT>& mat);
+    using TRowMajorMatrix = TMatrix<Rows, Cols, DataT, EMatrixOrder::ROW_MAJOR>;
 
     template <length_t Rows, length_t Cols, typename DataT>
-    std::istream& operator>>(std::istream& stream, TMatrix<Rows, Cols, DataT>& mat);
+    using TColumnMajorMatrix = TMatrix<Rows, Cols, DataT, EMatrixOrder::COLUMN_MAJOR>;
 
+    /*
+     * The kernels below work on row-major matrices. A column-major matrix's storage being the row-major storage of its transpose,
+     * column-major operations reuse them on their operands' storage (e.g. A * B is computed as the row-major B^T * A^T)
+     * which keeps the SIMD specializations without any runtime check or transposition.
+     */
     namespace Details
     {
+        /**
+         * \brief Reinterprets a column-major matrix's storage as the row-major storage of its transpose (and conversely)
+         * \param mat The matrix to reinterpret
+         * \return The matrix's transpose, stored in the other order
+         */
+        template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+        constexpr auto storageTranspose(const TMatrix<Rows, Cols, DataT, Order>& mat);
+
         template <length_t Rows, length_t Cols, typename DataT>
         struct Determinant
         {
-            static DataT compute(const TMatrix<Rows, Cols, DataT>& mat);
+            static constexpr DataT compute(const TMatrix<Rows, Cols, DataT>& mat);
         };
 
         template <length_t Rows, length_t Cols, typename DataT>
         struct Inverse
         {
-            static TMatrix<Rows, Cols, DataT> compute(const TMatrix<Rows, Cols, DataT>& mat);
+            static constexpr TMatrix<Rows, Cols, DataT> compute(const TMatrix<Rows, Cols, DataT>& mat);
+        };
+
+        template <length_t Size, typename DataT>
+        struct LUDecomposition
+        {
+            static_assert(std::is_floating_point_v<DataT>, "Invalid LU decomposition - data type should be a floating point type");
+
+            /**
+             * \brief Decomposes the given matrix in place into lower and upper triangular matrices using partial pivoting
+             * such that P * mat = L * U, with L's unit diagonal left implicit
+             * \param mat The matrix to decompose
+             * \param permutation The output row permutation (the original row index of each decomposed row)
+             * \return The permutation's sign (1 for an even number of row swaps or -1 otherwise)
+             */
+            static constexpr DataT compute(TMatrix<Size, Size, DataT>& mat, length_t (&permutation)[Size]);
+        };
+
+        // Portable implementations of the kernels below, also used by their SIMD specializations in constant evaluation
+        template <length_t Rows, length_t Cols, length_t OtherCols, typename DataT>
+        struct GenericMultiply
+        {
+            static constexpr TMatrix<Rows, OtherCols, DataT> compute(const TMatrix<Rows, Cols, DataT>& left,
+                const TMatrix<Cols, OtherCols, DataT>& right);
+        };
+
+        template <length_t Rows, length_t Cols, typename DataT>
+        struct GenericTranspose
+        {
+            static constexpr TMatrix<Cols, Rows, DataT> compute(const TMatrix<Rows, Cols, DataT>& mat);
+        };
+
+        template <length_t Rows, length_t Cols, length_t OtherCols, typename DataT>
+        struct Multiply : GenericMultiply<Rows, Cols, OtherCols, DataT>
+        {
+        };
+
+        template <length_t Rows, length_t Cols, typename DataT>
+        struct Transpose : GenericTranspose<Rows, Cols, DataT>
+        {
         };
     }
 }
 
+#ifdef __cpp_lib_format
+namespace std
+{
+    // Formats matrices like string(). The format specification applies to each element (e.g. "{:.2f}")
+    template <LibMath::length_t Rows, LibMath::length_t Cols, typename DataT, LibMath::EMatrixOrder Order>
+    struct formatter<LibMath::TMatrix<Rows, Cols, DataT, Order>, char> : LibMath::Details::TComponentsFormatter<DataT>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::TMatrix<Rows, Cols, DataT, Order>& mat, FormatContext& context) const;
+    };
+}
+#endif // __cpp_lib_format
+
 #include "TMatrix.inl"
 
 #endif // !__LIBMATH__MATRIX_TMATRIX_H__
@@ -1,144 +1,117 @@
 #ifndef __LIBMATH__MATRIX__TMATRIX_INL__
 #define __LIBMATH__MATRIX__TMATRIX_INL__
+#include <bit>
+#include <cassert>
 #include <sstream>
-#include <stdexcept>
+#include <utility>
 
 #include "Arithmetic.h"
 #include "TMatrix.h"
 
 namespace LibMath
 {
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr TMatrix<Rows, Cols, DataT>::TMatrix()
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>::TMatrix()
     {
         // Builds a matrix filled with zeros
         for (size_t i = 0; i < getSize(); i++)
             m_values[i] = 0;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr TMatrix<Rows, Cols, DataT>::TMatrix(const DataT scalar)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>::TMatrix(const DataT scalar)
     {
         // Builds a diagonal matrix with the given scalar
         for (length_t row = 0; row < Rows; row++)
         {
             for (length_t col = 0; col < Cols; col++)
-                (*this)(row, col) = row == col ? scalar : 0;
+                m_values[getIndex(row, col)] = row == col ? scalar : 0;
         }
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    constexpr TMatrix<Rows, Cols, DataT>::TMatrix(const TMatrix& other)
-    {
-        for (size_t i = 0; i < other.getSize(); i++)
-            m_values[i] = other[i];
-    }
-
-    template <length_t Rows, length_t Cols, typename DataT>
-    constexpr TMatrix<Rows, Cols, DataT>::TMatrix(TMatrix&& other) noexcept
-    {
-        for (size_t i = 0; i < other.getSize(); i++)
-            m_values[i] = other[i];
-    }
-
-    template <length_t Rows, length_t Cols, typename DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator=(const TMatrix& other)
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    template <EMatrixOrder OtherOrder>
+        requires (OtherOrder != Order)
+    constexpr TMatrix<Rows, Cols, DataT, Order>::TMatrix(const TMatrix<Rows, Cols, DataT, OtherOrder>& other)
     {
-        if (this == &other)
-            return *this;
-
-        for (size_t i = 0; i < getSize(); i++)
-            m_values[i] = other[i];
-
-        return *this;
-    }
-
-    template <length_t Rows, length_t Cols, typename DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator=(TMatrix&& other) noexcept
-    {
-        if (this == &other)
-            return *this;
-
-        for (size_t i = 0; i < other.getSize(); i++)
-            m_values[i] = other[i];
-
-        return *this;
+        // The other matrix's storage is the transpose of ours in its own order
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
+            *this = Details::Transpose<Cols, Rows, DataT>::compute(Details::storageTranspose(other));
+        else
+            *this = Details::storageTranspose(Details::Transpose<Rows, Cols, DataT>::compute(other));
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
     template <typename T>
-    TMatrix<Rows, Cols, DataT>::operator TMatrix<Rows, Cols, T>()
+    constexpr TMatrix<Rows, Cols, DataT, Order>::operator TMatrix<Rows, Cols, T, Order>() const
     {
-        TMatrix<Rows, Cols, T> mat;
+        TMatrix<Rows, Cols, T, Order> mat;
+        T*                     values = mat.getArray();
 
         for (size_t i = 0; i < getSize(); i++)
-            mat[i] = static_cast<T>(m_values[i]);
+            values[i] = static_cast<T>(m_values[i]);
 
         return mat;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr DataT TMatrix<Rows, Cols, DataT>::operator[](const size_t index) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr DataT TMatrix<Rows, Cols, DataT, Order>::operator[](const size_t index) const noexcept
     {
-        if (index >= getSize())
-            throw std::out_of_range("Index out of range");
-
+        assert(index < getSize() && "Index out of range");
         return m_values[index];
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    DataT& TMatrix<Rows, Cols, DataT>::operator[](const size_t index)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr DataT& TMatrix<Rows, Cols, DataT, Order>::operator[](const size_t index) noexcept
     {
-        if (index >= getSize())
-            throw std::out_of_range("Index out of range");
-
+        assert(index < getSize() && "Index out of range");
         return m_values[index];
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    DataT TMatrix<Rows, Cols, DataT>::operator()(const length_t row, const length_t column) const
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    constexpr DataT TMatrix<Rows, Cols, DataT, Order>::operator()(const length_t row, const length_t column) const noexcept
     {
-        return (*this)[getIndex(row, column)];
+        return m_values[getIndex(row, column)];
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    DataT& TMatrix<Rows, Cols, DataT>::operator()(const length_t row, const length_t column)
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    constexpr DataT& TMatrix<Rows, Cols, DataT, Order>::operator()(const length_t row, const length_t column) noexcept
     {
-        return (*this)[getIndex(row, column)];
+        return m_values[getIndex(row, column)];
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator+=(const TMatrix& other)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator+=(const TMatrix& other)
     {
         for (size_t i = 0; i < getSize(); i++)
-            m_values[i] += other[i];
+            m_values[i] += other.m_values[i];
 
         return *this;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator-=(const TMatrix& other)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator-=(const TMatrix& other)
     {
         for (size_t i = 0; i < getSize(); i++)
-            m_values[i] -= other[i];
+            m_values[i] -= other.m_values[i];
 
         return *this;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator*=(const TMatrix& other)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator*=(const TMatrix& other)
     {
         return (*this = *this * other);
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator/=(const TMatrix& other)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator/=(const TMatrix& other)
     {
         return (*this = *this / other);
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator+=(const DataT scalar)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator+=(const DataT scalar)
     {
         for (size_t i = 0; i < getSize(); i++)
             m_values[i] += scalar;
@@ -146,8 +119,8 @@ namespace LibMath
         return *this;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator-=(const DataT scalar)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator-=(const DataT scalar)
     {
         for (size_t i = 0; i < getSize(); i++)
             m_values[i] -= scalar;
@@ -155,8 +128,8 @@ namespace LibMath
         return *this;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator*=(const DataT scalar)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator*=(const DataT scalar)
     {
         for (size_t i = 0; i < getSize(); i++)
             m_values[i] *= scalar;
@@ -164,92 +137,86 @@ namespace LibMath
         return *this;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT>& TMatrix<Rows, Cols, DataT>::operator/=(const DataT scalar)
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order>& TMatrix<Rows, Cols, DataT, Order>::operator/=(const DataT scalar)
     {
         return *this *= static_cast<DataT>(1) / scalar;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator+(const TMatrix& other) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator+(const TMatrix& other) const
     {
         TMatrix mat = *this;
         return mat += other;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator-(const TMatrix& other) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator-(const TMatrix& other) const
     {
         TMatrix mat = *this;
         return mat -= other;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
     template <length_t OtherRows, length_t OtherCols>
-    TMatrix<Rows, OtherCols, DataT> TMatrix<Rows, Cols, DataT>::operator*(const TMatrix<OtherRows, OtherCols, DataT>& other) const
+    constexpr TMatrix<Rows, OtherCols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator*(const TMatrix<OtherRows, OtherCols, DataT, Order>& other) const
     {
         static_assert(OtherRows == Cols, "Can't multiply matrices with incompatible sizes");
 
-        TMatrix<Rows, OtherCols, DataT> result;
-
-        for (length_t otherCol = 0; otherCol < OtherCols; otherCol++)
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
         {
-            for (length_t row = 0; row < Rows; row++)
-            {
-                DataT scalar = 0;
-
-                for (length_t col = 0; col < Cols; col++)
-                    scalar += (*this)(row, col) * other(col, otherCol);
-
-                result(row, otherCol) = scalar;
-            }
+            return Details::Multiply<Rows, Cols, OtherCols, DataT>::compute(*this, other);
+        }
+        else
+        {
+            // (A * B)^T = B^T * A^T
+            return Details::storageTranspose(Details::Multiply<OtherCols, Cols, Rows, DataT>::compute(
+                Details::storageTranspose(other), Details::storageTranspose(*this)));
         }
-
-        return result;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator/(const TMatrix& other) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator/(const TMatrix& other) const
     {
         return *this * other.inverse();
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator+(DataT scalar) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator+(DataT scalar) const
     {
         TMatrix mat = *this;
         return mat += scalar;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator-(DataT scalar) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator-(DataT scalar) const
     {
         TMatrix mat = *this;
         return mat -= scalar;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator*(DataT scalar) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator*(DataT scalar) const
     {
         TMatrix mat = *this;
         return mat *= scalar;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator/(DataT scalar) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator/(DataT scalar) const
     {
         TMatrix mat = *this;
         return mat /= scalar;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::operator-() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::operator-() const
     {
         return *this * -1;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr bool TMatrix<Rows, Cols, DataT>::operator==(const TMatrix& other) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr bool TMatrix<Rows, Cols, DataT, Order>::operator==(const TMatrix& other) const
     {
         if constexpr (other.getRowCount() != Rows || other.getColumnCount() != Cols)
         {
@@ -259,7 +226,7 @@ namespace LibMath
         {
             for (size_t i = 0; i < getSize(); i++)
             {
-                if (!floatEquals(m_values[i], other[i]))
+                if (!floatEquals(m_values[i], other.m_values[i]))
                     return false;
             }
 
@@ -267,14 +234,14 @@ namespace LibMath
         }
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr bool TMatrix<Rows, Cols, DataT>::operator!=(const TMatrix& other) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr bool TMatrix<Rows, Cols, DataT, Order>::operator!=(const TMatrix& other) const
     {
         return !(*this == other);
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr bool TMatrix<Rows, Cols, DataT>::isIdentity() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr bool TMatrix<Rows, Cols, DataT, Order>::isIdentity() const
     {
         if constexpr (Rows != Cols)
             return false;
@@ -282,53 +249,65 @@ namespace LibMath
             return *this == TMatrix(static_cast<DataT>(1));
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr length_t TMatrix<Rows, Cols, DataT>::getRowCount()
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr length_t TMatrix<Rows, Cols, DataT, Order>::getRowCount()
     {
         return Rows;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    constexpr length_t TMatrix<Rows, Cols, DataT>::getColumnCount()
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr length_t TMatrix<Rows, Cols, DataT, Order>::getColumnCount()
     {
         return Cols;
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    constexpr size_t TMatrix<Rows, Cols, DataT>::getSize()
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    constexpr size_t TMatrix<Rows, Cols, DataT, Order>::getSize()
     {
         return static_cast<size_t>(Rows) * Cols;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    length_t TMatrix<Rows, Cols, DataT>::getIndex(const length_t row, const length_t column)
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    constexpr EMatrixOrder TMatrix<Rows, Cols, DataT, Order>::getOrder()
+    {
+        return Order;
+    }
+
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr length_t TMatrix<Rows, Cols, DataT, Order>::getIndex(const length_t row, const length_t column) noexcept
     {
-        if (row < 0 || row >= Rows || column < 0 || column >= Cols)
-            throw std::out_of_range("Index out of range");
+        assert(row >= 0 && row < Rows && column >= 0 && column < Cols && "Index out of range");
 
-        return row * Cols + column;
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
+            return row * Cols + column;
+        else
+            return column * Rows + row;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    DataT* TMatrix<Rows, Cols, DataT>::getArray()
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr DataT* TMatrix<Rows, Cols, DataT, Order>::getArray() noexcept
     {
         return m_values;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    const DataT* TMatrix<Rows, Cols, DataT>::getArray() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr const DataT* TMatrix<Rows, Cols, DataT, Order>::getArray() const noexcept
     {
         return m_values;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    DataT TMatrix<Rows, Cols, DataT>::determinant() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr DataT TMatrix<Rows, Cols, DataT, Order>::determinant() const
     {
-        return Details::Determinant<Rows, Cols, DataT>::compute(*this);
+        // det(A^T) = det(A)
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
+            return Details::Determinant<Rows, Cols, DataT>::compute(*this);
+        else
+            return Details::Determinant<Cols, Rows, DataT>::compute(Details::storageTranspose(*this));
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    DataT TMatrix<Rows, Cols, DataT>::cofactor(const length_t row, const length_t column) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr DataT TMatrix<Rows, Cols, DataT, Order>::cofactor(const length_t row, const length_t column) const
     {
         static_assert(Rows == Cols, "Can't compute the cofactor of a non-square matrix");
 
@@ -345,192 +324,422 @@ namespace LibMath
         }
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows - 1, Cols - 1, DataT> TMatrix<Rows, Cols, DataT>::minor(const length_t row, const length_t column) const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows - 1, Cols - 1, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::minor(const length_t row, const length_t column) const
     {
-        TMatrix<Rows - 1, Cols - 1, DataT> minor;
-        length_t                           minorLine = 0;
+        TMatrix<Rows - 1, Cols - 1, DataT, Order> minor;
+        DataT*                             minorValues = minor.getArray();
 
-        for (length_t i = 0; i < Rows; i++)
+        // Walk the storage in order, i.e. along the rows for row-major matrices and along the columns otherwise
+        constexpr length_t outerCount = Order == EMatrixOrder::ROW_MAJOR ? Rows : Cols;
+        constexpr length_t innerCount = Order == EMatrixOrder::ROW_MAJOR ? Cols : Rows;
+
+        const length_t outerSkip = Order == EMatrixOrder::ROW_MAJOR ? row : column;
+        const length_t innerSkip = Order == EMatrixOrder::ROW_MAJOR ? column : row;
+
+        for (length_t i = 0; i < outerCount; i++)
         {
-            if (i == row)
+            if (i == outerSkip)
                 continue;
 
-            length_t minorCol = 0;
-
-            for (length_t j = 0; j < Cols; j++)
+            for (length_t j = 0; j < innerCount; j++)
             {
-                if (j == column)
+                if (j == innerSkip)
                     continue;
 
-                minor(minorLine, minorCol++) = (*this)(i, j);
+                *minorValues++ = m_values[i * innerCount + j];
             }
-
-            minorLine++;
         }
 
         return minor;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Cols, Rows, DataT> TMatrix<Rows, Cols, DataT>::transposed() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Cols, Rows, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::transposed() const
     {
-        TMatrix<Cols, Rows, DataT> transposed;
-
-        for (length_t i = 0; i < Rows; i++)
-        {
-            for (length_t j = 0; j < Cols; j++)
-                transposed(j, i) = (*this)(i, j);
-        }
-
-        return transposed;
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
+            return Details::Transpose<Rows, Cols, DataT>::compute(*this);
+        else
+            return Details::storageTranspose(Details::Transpose<Cols, Rows, DataT>::compute(Details::storageTranspose(*this)));
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::coMatrix() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::coMatrix() const
     {
         static_assert(Rows == Cols, "Can't compute the co-matrix of a non-square matrix");
 
-        TMatrix<Rows, Cols, DataT> coMatrix;
+        TMatrix<Rows, Cols, DataT, Order> coMatrix;
 
         for (length_t row = 0; row < Rows; row++)
         {
             for (length_t col = 0; col < Cols; col++)
-                coMatrix(row, col) = cofactor(row, col);
+                coMatrix.m_values[getIndex(row, col)] = cofactor(row, col);
         }
 
         return coMatrix;
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Cols, Rows, DataT> TMatrix<Rows, Cols, DataT>::adjugate() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Cols, Rows, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::adjugate() const
     {
         return coMatrix().transposed();
     }
 
-    template <length_t Rows, length_t Cols, class DataT>
-    TMatrix<Rows, Cols, DataT> TMatrix<Rows, Cols, DataT>::inverse() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::inverse() const
     {
-        return Details::Inverse<Rows, Cols, DataT>::compute(*this);
+        // (A^T)^-1 = (A^-1)^T
+        if constexpr (Order == EMatrixOrder::ROW_MAJOR)
+            return Details::Inverse<Rows, Cols, DataT>::compute(*this);
+        else
+            return Details::storageTranspose(Details::Inverse<Cols, Rows, DataT>::compute(Details::storageTranspose(*this)));
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    std::string TMatrix<Rows, Cols, DataT>::string() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::inverseAffine() const
     {
-        std::ostringstream oss;
-        oss << '{';
+        static_assert(Rows == Cols, "Can't invert a non-square matrix");
+        static_assert(Rows > 1, "Can't compute the affine inverse of a 1x1 matrix");
+
+        constexpr length_t linearSize = Rows - 1;
 
-        for (size_t i = 0; i < getSize(); ++i)
+        TMatrix<linearSize, linearSize, DataT> linear;
+        DataT*                                 linearValues = linear.getArray();
+
+        for (length_t row = 0; row < linearSize; row++)
         {
-            oss << m_values[i];
+            for (length_t col = 0; col < linearSize; col++)
+                linearValues[row * linearSize + col] = m_values[getIndex(row, col)];
+        }
 
-            if (i + 1 < getSize())
-                oss << ',';
+        linear = linear.inverse();
+
+        // The inverse of [A t; 0 1] is [A^-1 -A^-1*t; 0 1]
+        TMatrix inverse(static_cast<DataT>(1));
+
+        for (length_t row = 0; row < linearSize; row++)
+        {
+            DataT translation = 0;
+
+            for (length_t col = 0; col < linearSize; col++)
+            {
+                inverse.m_values[getIndex(row, col)] = linearValues[row * linearSize + col];
+                translation -= linearValues[row * linearSize + col] * m_values[getIndex(col, linearSize)];
+            }
+
+            inverse.m_values[getIndex(row, linearSize)] = translation;
         }
 
-        oss << '}';
-        return oss.str();
+        return inverse;
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    std::string TMatrix<Rows, Cols, DataT>::stringLong() const
+    template <length_t Rows, length_t Cols, class DataT, EMatrixOrder Order>
+    constexpr TMatrix<Rows, Cols, DataT, Order> TMatrix<Rows, Cols, DataT, Order>::inverseRigid() const
+    {
+        static_assert(Rows == Cols, "Can't invert a non-square matrix");
+        static_assert(Rows > 1, "Can't compute the rigid inverse of a 1x1 matrix");
+
+        constexpr length_t linearSize = Rows - 1;
+
+        // The inverse of [R t; 0 1] is [R^T -R^T*t; 0 1]
+        TMatrix inverse(static_cast<DataT>(1));
+
+        for (length_t row = 0; row < linearSize; row++)
+        {
+            DataT translation = 0;
+
+            for (length_t col = 0; col < linearSize; col++)
+            {
+                inverse.m_values[getIndex(row, col)] = m_values[getIndex(col, row)];
+                translation -= m_values[getIndex(col, row)] * m_values[getIndex(col, linearSize)];
+            }
+
+            inverse.m_values[getIndex(row, linearSize)] = translation;
+        }
+
+        return inverse;
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::string TMatrix<Rows, Cols, DataT, Order>::string() const
     {
-        std::ostringstream oss;
-        oss << "Matrix" << Rows << 'x' << Cols << "{ ";
+        char buffer[Rows * Cols * (Details::MAX_COMPONENT_CHARS + 1) + 1];
+
+        const std::to_chars_result result = formatTo(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, result.ptr);
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::string TMatrix<Rows, Cols, DataT, Order>::stringLong() const
+    {
+        std::string str = "Matrix";
+        Details::appendComponent(str, Rows);
+        str += 'x';
+        Details::appendComponent(str, Cols);
+        str += "{ ";
 
         for (length_t row = 0; row < Rows; ++row)
         {
             for (length_t col = 0; col < Cols; ++col)
             {
-                oss << row << '_' << col << ": " << (*this)(row, col);
+                Details::appendComponent(str, row);
+                str += '_';
+                Details::appendComponent(str, col);
+                str += ": ";
+                Details::appendComponent(str, m_values[getIndex(row, col)]);
 
                 if (row + 1 < Rows || col + 1 < Cols)
-                    oss << ", ";
+                    str += ", ";
             }
         }
 
-        oss << " }";
-        return oss.str();
+        str += " }";
+        return str;
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    std::ostream& operator<<(std::ostream& stream, const TMatrix<Rows, Cols, DataT>& mat)
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::ostream& operator<<(std::ostream& stream, const TMatrix<Rows, Cols, DataT, Order>& mat)
     {
         return stream << mat.string();
     }
 
-    template <length_t Rows, length_t Cols, typename DataT>
-    std::istream& operator>>(std::istream& stream, TMatrix<Rows, Cols, DataT>& mat)
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::istream& operator>>(std::istream& stream, TMatrix<Rows, Cols, DataT, Order>& mat)
     {
         std::string line;
 
         std::getline(stream, line, '}');
 
-        size_t component = 0;
-        size_t valStart  = 0;
+        TMatrix<Rows, Cols, DataT, Order> parsed;
 
-        do
+        if (Details::parseComponentList(line.data(), line.data() + line.size(), parsed.getArray(), parsed.getSize()).ec == std::errc())
+            mat = parsed;
+        else
+            mat = TMatrix<Rows, Cols, DataT, Order>(1);
+
+        return stream;
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::to_chars_result formatTo(char* first, char* last, const TMatrix<Rows, Cols, DataT, Order>& mat)
+    {
+        return Details::formatComponents(first, last, mat.getArray(), mat.getSize());
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    std::from_chars_result parse(const std::string_view text, TMatrix<Rows, Cols, DataT, Order>& mat)
+    {
+        TMatrix<Rows, Cols, DataT, Order> parsed;
+
+        const std::from_chars_result result = Details::parseComponents(text.data(), text.data() + text.size(), parsed.getArray(), parsed.getSize());
+
+        if (result.ec == std::errc())
+            mat = parsed;
+
+        return result;
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT, EMatrixOrder Order>
+    constexpr auto Details::storageTranspose(const TMatrix<Rows, Cols, DataT, Order>& mat)
+    {
+        constexpr EMatrixOrder otherOrder = Order == EMatrixOrder::ROW_MAJOR ? EMatrixOrder::COLUMN_MAJOR : EMatrixOrder::ROW_MAJOR;
+        return std::bit_cast<TMatrix<Cols, Rows, DataT, otherOrder>>(mat);
+    }
+
+    template <length_t Size, typename DataT>
+    constexpr DataT Details::LUDecomposition<Size, DataT>::compute(TMatrix<Size, Size, DataT>& mat, length_t (&permutation)[Size])
+    {
+        DataT* values = mat.getArray();
+        DataT  sign   = 1;
+
+        for (length_t i = 0; i < Size; i++)
+            permutation[i] = i;
+
+        for (length_t k = 0; k < Size; k++)
         {
-            if (valStart == std::string::npos)
-                break;
+            // Use the row with the biggest value in the current column as pivot to limit rounding errors
+            length_t pivot    = k;
+            DataT    pivotAbs = abs(values[k * Size + k]);
 
-            if (line[valStart] == '{' || std::isspace(line[valStart]))
+            for (length_t row = k + 1; row < Size; row++)
             {
-                valStart++;
+                if (abs(values[row * Size + k]) > pivotAbs)
+                {
+                    pivot    = row;
+                    pivotAbs = abs(values[row * Size + k]);
+                }
+            }
+
+            // The whole column is already eliminated - the matrix is singular and the zero pivot is left as is
+            if (pivotAbs == static_cast<DataT>(0))
                 continue;
+
+            if (pivot != k)
+            {
+                for (length_t col = 0; col < Size; col++)
+                    std::swap(values[k * Size + col], values[pivot * Size + col]);
+
+                std::swap(permutation[k], permutation[pivot]);
+                sign = -sign;
             }
 
-            if (line[valStart] != '-' && !std::isdigit(line[valStart]))
-                break;
+            const DataT pivotInv = static_cast<DataT>(1) / values[k * Size + k];
 
-            mat[component] = std::stof(line.substr(valStart));
+            for (length_t row = k + 1; row < Size; row++)
+            {
+                const DataT factor = values[row * Size + k] *= pivotInv;
 
-            valStart = line.find(',', valStart) + 1;
-            component++;
+                for (length_t col = k + 1; col < Size; col++)
+                    values[row * Size + col] -= factor * values[k * Size + col];
+            }
         }
-        while (component < mat.getSize() && valStart != 0);
 
-        if (component != mat.getSize())
-            mat = TMatrix<Rows, Cols, DataT>(1);
-
-        return stream;
+        return sign;
     }
 
     template <length_t Rows, length_t Cols, typename DataT>
-    DataT Details::Determinant<Rows, Cols, DataT>::compute(const TMatrix<Rows, Cols, DataT>& mat)
+    constexpr DataT Details::Determinant<Rows, Cols, DataT>::compute(const TMatrix<Rows, Cols, DataT>& mat)
     {
         static_assert(Rows == Cols, "Can't compute the determinant of a non-square matrix");
 
         if constexpr (Rows == 1)
         {
-            return mat[0];
+            return mat.getArray()[0];
         }
         else
         {
-            DataT determinant = 0;
+            using FloatT = floating_t<DataT>;
 
-            for (length_t col = 0; col < Cols; col++)
-                determinant += mat[col] * mat.cofactor(0, col);
+            TMatrix<Rows, Cols, FloatT> lu;
+            FloatT*                     luValues = lu.getArray();
+
+            for (size_t i = 0; i < mat.getSize(); i++)
+                luValues[i] = static_cast<FloatT>(mat.getArray()[i]);
+
+            length_t permutation[Rows];
+            FloatT   determinant = LUDecomposition<Rows, FloatT>::compute(lu, permutation);
+
+            for (length_t i = 0; i < Rows; i++)
+                determinant *= luValues[i * Cols + i];
 
-            return determinant;
+            if constexpr (std::is_integral_v<DataT>)
+                return static_cast<DataT>(round(determinant));
+            else
+                return determinant;
         }
     }
 
     template <length_t Rows, length_t Cols, typename DataT>
-    TMatrix<Rows, Cols, DataT> Details::Inverse<Rows, Cols, DataT>::compute(const TMatrix<Rows, Cols, DataT>& mat)
+    constexpr TMatrix<Rows, Cols, DataT> Details::Inverse<Rows, Cols, DataT>::compute(const TMatrix<Rows, Cols, DataT>& mat)
     {
         static_assert(Rows == Cols, "Can't invert a non-square matrix");
 
         if constexpr (Rows == 1)
         {
-            return TMatrix<1, 1, DataT>(static_cast<DataT>(1) / mat[0]);
+            return TMatrix<1, 1, DataT>(static_cast<DataT>(1) / mat.getArray()[0]);
         }
         else
         {
-            const DataT detInv = static_cast<DataT>(1) / mat.determinant();
-            return mat.adjugate() * detInv;
+            using FloatT = floating_t<DataT>;
+
+            TMatrix<Rows, Cols, FloatT> lu;
+            FloatT*                     luValues = lu.getArray();
+
+            for (size_t i = 0; i < mat.getSize(); i++)
+                luValues[i] = static_cast<FloatT>(mat.getArray()[i]);
+
+            length_t permutation[Rows];
+            LUDecomposition<Rows, FloatT>::compute(lu, permutation);
+
+            TMatrix<Rows, Cols, DataT> inv;
+            DataT*                     invValues = inv.getArray();
+
+            // Solve L * U * x = P * e for each column e of the identity matrix
+            for (length_t col = 0; col < Cols; col++)
+            {
+                FloatT x[Rows];
+
+                // Forward substitution with L's implicit unit diagonal
+                for (length_t i = 0; i < Rows; i++)
+                {
+                    x[i] = permutation[i] == col ? static_cast<FloatT>(1) : static_cast<FloatT>(0);
+
+                    for (length_t k = 0; k < i; k++)
+                        x[i] -= luValues[i * Cols + k] * x[k];
+                }
+
+                // Backward substitution
+                for (length_t i = Rows - 1; i >= 0; i--)
+                {
+                    for (length_t k = i + 1; k < Rows; k++)
+                        x[i] -= luValues[i * Cols + k] * x[k];
+
+                    x[i] /= luValues[i * Cols + i];
+                }
+
+                for (length_t i = 0; i < Rows; i++)
+                    invValues[i * Cols + col] = static_cast<DataT>(x[i]);
+            }
+
+            return inv;
+        }
+    }
+
+    template <length_t Rows, length_t Cols, length_t OtherCols, typename DataT>
+    constexpr TMatrix<Rows, OtherCols, DataT> Details::GenericMultiply<Rows, Cols, OtherCols, DataT>::compute(
+        const TMatrix<Rows, Cols, DataT>& left, const TMatrix<Cols, OtherCols, DataT>& right)
+    {
+        const DataT* leftValues  = left.getArray();
+        const DataT* rightValues = right.getArray();
+
+        TMatrix<Rows, OtherCols, DataT> result;
+        DataT*                          resultValues = result.getArray();
+
+        for (length_t otherCol = 0; otherCol < OtherCols; otherCol++)
+        {
+            for (length_t row = 0; row < Rows; row++)
+            {
+                DataT scalar = 0;
+
+                for (length_t col = 0; col < Cols; col++)
+                    scalar += leftValues[row * Cols + col] * rightValues[col * OtherCols + otherCol];
+
+                resultValues[row * OtherCols + otherCol] = scalar;
+            }
+        }
+
+        return result;
+    }
+
+    template <length_t Rows, length_t Cols, typename DataT>
+    constexpr TMatrix<Cols, Rows, DataT> Details::GenericTranspose<Rows, Cols, DataT>::compute(const TMatrix<Rows, Cols, DataT>& mat)
+    {
+        const DataT* values = mat.getArray();
+
+        TMatrix<Cols, Rows, DataT> transposed;
+        DataT*                     transposedValues = transposed.getArray();
+
+        for (length_t i = 0; i < Rows; i++)
+        {
+            for (length_t j = 0; j < Cols; j++)
+                transposedValues[j * Rows + i] = values[i * Cols + j];
         }
+
+        return transposed;
+    }
+}
+
+#ifdef __cpp_lib_format
+namespace std
+{
+    template <LibMath::length_t Rows, LibMath::length_t Cols, typename DataT, LibMath::EMatrixOrder Order>
+    template <class FormatContext>
+    auto formatter<LibMath::TMatrix<Rows, Cols, DataT, Order>, char>::format(const LibMath::TMatrix<Rows, Cols, DataT, Order>& mat,
+                                                                              FormatContext& context) const
+    {
+        return this->formatComponents(mat.getArray(), mat.getSize(), context);
     }
 }
+#endif // __cpp_lib_format
 
 #endif // !__LIBMATH__MATRIX__TMATRIX_INL__
@@ -6,10 +6,10 @@
 
 namespace LibMath
 {
-    template <class T, class U>
-    TVector4<U> operator*(const TMatrix<4, 4, T>& operation, const TVector4<U>& operand)
+    template <class T, class U, EMatrixOrder Order>
+    constexpr TVector4<U> operator*(const TMatrix<4, 4, T, Order>& operation, const TVector4<U>& operand)
     {
-        TMatrix<4, 1, T> vec4Mat;
+        TMatrix<4, 1, T, Order> vec4Mat;
         vec4Mat[0] = static_cast<T>(operand.m_x);
         vec4Mat[1] = static_cast<T>(operand.m_y);
         vec4Mat[2] = static_cast<T>(operand.m_z);
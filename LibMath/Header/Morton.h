@@ -0,0 +1,107 @@
+#ifndef __LIBMATH__MORTON_H__
+#define __LIBMATH__MORTON_H__
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#include "EExecutionPolicy.h"
+
+#include "Geometry/BoundingBox.h"
+
+#include "Vector/Vector2.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+    /**
+     * \brief The number of bits of each coordinate kept by the 3D Morton codes
+     */
+    constexpr uint32_t MORTON_3D_BITS = 21;
+
+    /*
+     * Morton (Z-order) codes interleave the bits of integer coordinates so that sorting points by code keeps points close
+     * in space close in memory. The conversions use the BMI2 bit deposit/extract instructions when available (see Simd.h)
+     * and bit twiddling otherwise. Both give the same results.
+     */
+
+    /**
+     * \brief Interleaves the bits of the given 2D coordinates (x in the even bits, y in the odd bits)
+     * \param x The x coordinate
+     * \param y The y coordinate
+     * \return The coordinates' Morton code
+     */
+    constexpr uint64_t mortonEncode(uint32_t x, uint32_t y);
+
+    /**
+     * \brief Interleaves the bits of the given 3D coordinates (x in bits 0, 3, 6..., y in bits 1, 4, 7... and z in bits
+     * 2, 5, 8...)
+     * \param x The x coordinate. Only its MORTON_3D_BITS low bits are kept
+     * \param y The y coordinate. Only its MORTON_3D_BITS low bits are kept
+     * \param z The z coordinate. Only its MORTON_3D_BITS low bits are kept
+     * \return The coordinates' Morton code
+     */
+    constexpr uint64_t mortonEncode(uint32_t x, uint32_t y, uint32_t z);
+
+    /**
+     * \brief Computes the Morton code of the given integer 2D coordinates
+     * \param coordinates The coordinates to encode. Negative coordinates are encoded as their 32 bits two's complement
+     * \return The coordinates' Morton code
+     */
+    template <std::integral T>
+    constexpr uint64_t mortonEncode(const TVector2<T>& coordinates);
+
+    /**
+     * \brief Computes the Morton code of the given integer 3D coordinates
+     * \param coordinates The coordinates to encode. Only their MORTON_3D_BITS low bits are kept
+     * \return The coordinates' Morton code
+     */
+    template <std::integral T>
+    constexpr uint64_t mortonEncode(const TVector3<T>& coordinates);
+
+    /**
+     * \brief Extracts the 2D coordinates from the given Morton code
+     * \param code The Morton code to decode
+     * \return The encoded coordinates
+     */
+    constexpr TVector2<uint32_t> mortonDecode2D(uint64_t code);
+
+    /**
+     * \brief Extracts the 3D coordinates from the given Morton code
+     * \param code The Morton code to decode. The highest bit is ignored
+     * \return The encoded coordinates
+     */
+    constexpr TVector3<uint32_t> mortonDecode3D(uint64_t code);
+
+    /**
+     * \brief Computes the coordinates of the grid cell containing the given point. The grid divides the bounding box
+     * in 2^bitsPerAxis cells along each axis
+     * \param point The point whose cell should be computed. Points outside of the box are clamped to its border cells
+     * \param bounds The grid's bounding box
+     * \param bitsPerAxis The number of bits of each cell coordinate. Should be in [1, 24]
+     * \return The point's cell coordinates, in [0, 2^bitsPerAxis - 1]
+     */
+    inline TVector3<uint32_t> toGridCell(const Vector3& point, const BoundingBox& bounds, uint32_t bitsPerAxis = MORTON_3D_BITS);
+
+    /**
+     * \brief Computes the Morton code of the grid cell containing the given point (i.e. mortonEncode(toGridCell(point, bounds)))
+     * \param point The point to encode
+     * \param bounds The grid's bounding box
+     * \return The point's Morton code
+     */
+    inline uint64_t mortonEncode(const Vector3& point, const BoundingBox& bounds);
+
+    /**
+     * \brief Computes the Morton codes of the given points (i.e. out[i] = mortonEncode(points[i], bounds))
+     * \param points The points to encode
+     * \param bounds The grid's bounding box
+     * \param out The points' Morton codes. Should have the same size as the points
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void mortonEncode(std::span<const Vector3> points, const BoundingBox& bounds, std::span<uint64_t> out,
+                             EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+}
+
+#include "Morton.inl"
+
+#endif // !__LIBMATH__MORTON_H__
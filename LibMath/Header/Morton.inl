@@ -0,0 +1,206 @@
+#ifndef __LIBMATH__MORTON_INL__
+#define __LIBMATH__MORTON_INL__
+
+#include <cassert>
+#include <type_traits>
+
+#include "Batch.h"
+#include "Morton.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        constexpr uint64_t MORTON_2D_MASK = 0x5555555555555555;
+        constexpr uint64_t MORTON_3D_MASK = 0x1249249249249249;
+
+        // Magic bits versions adapted from https://fgiesen.wordpress.com/2009/12/13/decoding-morton-codes/
+
+        /**
+         * \brief Inserts a 0 bit between each of the given value's bits
+         */
+        constexpr uint64_t spreadBits2D(uint64_t value)
+        {
+            value &= 0x00000000FFFFFFFF;
+            value = (value | value << 16) & 0x0000FFFF0000FFFF;
+            value = (value | value << 8) & 0x00FF00FF00FF00FF;
+            value = (value | value << 4) & 0x0F0F0F0F0F0F0F0F;
+            value = (value | value << 2) & 0x3333333333333333;
+            value = (value | value << 1) & MORTON_2D_MASK;
+            return value;
+        }
+
+        /**
+         * \brief Removes every odd bit of the given value - inverse of spreadBits2D
+         */
+        constexpr uint32_t compactBits2D(uint64_t value)
+        {
+            value &= MORTON_2D_MASK;
+            value = (value ^ value >> 1) & 0x3333333333333333;
+            value = (value ^ value >> 2) & 0x0F0F0F0F0F0F0F0F;
+            value = (value ^ value >> 4) & 0x00FF00FF00FF00FF;
+            value = (value ^ value >> 8) & 0x0000FFFF0000FFFF;
+            value = (value ^ value >> 16) & 0x00000000FFFFFFFF;
+            return static_cast<uint32_t>(value);
+        }
+
+        /**
+         * \brief Inserts two 0 bits between each of the given value's 21 low bits
+         */
+        constexpr uint64_t spreadBits3D(uint64_t value)
+        {
+            value &= 0x00000000001FFFFF;
+            value = (value | value << 32) & 0x001F00000000FFFF;
+            value = (value | value << 16) & 0x001F0000FF0000FF;
+            value = (value | value << 8) & 0x100F00F00F00F00F;
+            value = (value | value << 4) & 0x10C30C30C30C30C3;
+            value = (value | value << 2) & MORTON_3D_MASK;
+            return value;
+        }
+
+        /**
+         * \brief Keeps one bit out of three of the given value - inverse of spreadBits3D
+         */
+        constexpr uint32_t compactBits3D(uint64_t value)
+        {
+            value &= MORTON_3D_MASK;
+            value = (value ^ value >> 2) & 0x10C30C30C30C30C3;
+            value = (value ^ value >> 4) & 0x100F00F00F00F00F;
+            value = (value ^ value >> 8) & 0x001F0000FF0000FF;
+            value = (value ^ value >> 16) & 0x001F00000000FFFF;
+            value = (value ^ value >> 32) & 0x00000000001FFFFF;
+            return static_cast<uint32_t>(value);
+        }
+
+        /**
+         * \brief Maps points to the cells of a regular grid covering a bounding box
+         */
+        struct GridQuantizer
+        {
+            GridQuantizer(const BoundingBox& bounds, const uint32_t bitsPerAxis)
+                : m_min(bounds.m_min), m_maxCell(static_cast<float>((1u << bitsPerAxis) - 1))
+            {
+                assert(bitsPerAxis >= 1 && bitsPerAxis <= 24 && "Invalid grid - bits per axis should be in [1, 24]");
+
+                // Flat boxes map every point to the first cell of the flat axes
+                const float   cellCount = static_cast<float>(1u << bitsPerAxis);
+                const Vector3 extent    = bounds.m_max - bounds.m_min;
+
+                m_scale = {
+                    extent.m_x > 0.f ? cellCount / extent.m_x : 0.f,
+                    extent.m_y > 0.f ? cellCount / extent.m_y : 0.f,
+                    extent.m_z > 0.f ? cellCount / extent.m_z : 0.f
+                };
+            }
+
+            TVector3<uint32_t> operator()(const Vector3& point) const
+            {
+                // The clamp also sends NaNs to the last cell, which keeps the conversions defined
+                return {
+                    static_cast<uint32_t>(clamp((point.m_x - m_min.m_x) * m_scale.m_x, 0.f, m_maxCell)),
+                    static_cast<uint32_t>(clamp((point.m_y - m_min.m_y) * m_scale.m_y, 0.f, m_maxCell)),
+                    static_cast<uint32_t>(clamp((point.m_z - m_min.m_z) * m_scale.m_z, 0.f, m_maxCell))
+                };
+            }
+
+            Vector3 m_min;
+            Vector3 m_scale;
+            float   m_maxCell;
+        };
+    }
+
+    constexpr uint64_t mortonEncode(const uint32_t x, const uint32_t y)
+    {
+#ifdef LIBMATH_SIMD_BMI2
+        if (!std::is_constant_evaluated())
+            return _pdep_u64(x, Details::MORTON_2D_MASK) | _pdep_u64(y, Details::MORTON_2D_MASK << 1);
+#endif // LIBMATH_SIMD_BMI2
+
+        return Details::spreadBits2D(x) | Details::spreadBits2D(y) << 1;
+    }
+
+    constexpr uint64_t mortonEncode(const uint32_t x, const uint32_t y, const uint32_t z)
+    {
+#ifdef LIBMATH_SIMD_BMI2
+        if (!std::is_constant_evaluated())
+        {
+            return _pdep_u64(x, Details::MORTON_3D_MASK)
+                | _pdep_u64(y, Details::MORTON_3D_MASK << 1)
+                | _pdep_u64(z, Details::MORTON_3D_MASK << 2);
+        }
+#endif // LIBMATH_SIMD_BMI2
+
+        return Details::spreadBits3D(x) | Details::spreadBits3D(y) << 1 | Details::spreadBits3D(z) << 2;
+    }
+
+    template <std::integral T>
+    constexpr uint64_t mortonEncode(const TVector2<T>& coordinates)
+    {
+        return mortonEncode(static_cast<uint32_t>(coordinates.m_x), static_cast<uint32_t>(coordinates.m_y));
+    }
+
+    template <std::integral T>
+    constexpr uint64_t mortonEncode(const TVector3<T>& coordinates)
+    {
+        return mortonEncode(static_cast<uint32_t>(coordinates.m_x), static_cast<uint32_t>(coordinates.m_y),
+                            static_cast<uint32_t>(coordinates.m_z));
+    }
+
+    constexpr TVector2<uint32_t> mortonDecode2D(const uint64_t code)
+    {
+#ifdef LIBMATH_SIMD_BMI2
+        if (!std::is_constant_evaluated())
+        {
+            return {
+                static_cast<uint32_t>(_pext_u64(code, Details::MORTON_2D_MASK)),
+                static_cast<uint32_t>(_pext_u64(code, Details::MORTON_2D_MASK << 1))
+            };
+        }
+#endif // LIBMATH_SIMD_BMI2
+
+        return { Details::compactBits2D(code), Details::compactBits2D(code >> 1) };
+    }
+
+    constexpr TVector3<uint32_t> mortonDecode3D(const uint64_t code)
+    {
+#ifdef LIBMATH_SIMD_BMI2
+        if (!std::is_constant_evaluated())
+        {
+            return {
+                static_cast<uint32_t>(_pext_u64(code, Details::MORTON_3D_MASK)),
+                static_cast<uint32_t>(_pext_u64(code, Details::MORTON_3D_MASK << 1)),
+                static_cast<uint32_t>(_pext_u64(code, Details::MORTON_3D_MASK << 2))
+            };
+        }
+#endif // LIBMATH_SIMD_BMI2
+
+        return { Details::compactBits3D(code), Details::compactBits3D(code >> 1), Details::compactBits3D(code >> 2) };
+    }
+
+    inline TVector3<uint32_t> toGridCell(const Vector3& point, const BoundingBox& bounds, const uint32_t bitsPerAxis)
+    {
+        return Details::GridQuantizer(bounds, bitsPerAxis)(point);
+    }
+
+    inline uint64_t mortonEncode(const Vector3& point, const BoundingBox& bounds)
+    {
+        return mortonEncode(toGridCell(point, bounds));
+    }
+
+    inline void mortonEncode(const std::span<const Vector3> points, const BoundingBox& bounds, const std::span<uint64_t> out,
+                             const EExecutionPolicy policy)
+    {
+        assert(points.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        const Details::GridQuantizer toCell(bounds, MORTON_3D_BITS);
+
+        Details::forEachRange(out.size(), policy, [&toCell, points = points.data(), out = out.data()](const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                out[i] = mortonEncode(toCell(points[i]));
+        });
+    }
+}
+
+#endif // !__LIBMATH__MORTON_INL__
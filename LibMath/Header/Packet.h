@@ -0,0 +1,414 @@
+#ifndef __LIBMATH__PACKET_H__
+#define __LIBMATH__PACKET_H__
+
+#include <cstddef>
+#include <type_traits>
+
+#include "EPrecision.h"
+#include "Simd.h"
+
+/*
+ * Packets hold several floats (lanes) and compute each operation on all of them at once. They can be used as the data
+ * type of vectors, quaternions and matrices, e.g. a TVector3<Packet<float, 8>> holds 8 vectors in SoA form and its
+ * existing algorithms (dot, cross, normalized, quaternion rotation...) process the 8 vectors per call.
+ * Packets of 4, 8 and 16 floats map to a single SSE, AVX or AVX-512 register when available (see Simd.h), and to plain
+ * arrays processed lane by lane otherwise.
+ * Comparisons return per-lane masks, to be combined with select, all and any. The bool returning functions of the
+ * library (e.g. floatEquals or the vectors' operator==) are only true if they are true for all the lanes.
+ */
+
+namespace LibMath
+{
+    template <class T, size_t Size>
+    class Packet;
+
+    template <class T, size_t Size>
+    class PacketMask;
+
+    namespace Details
+    {
+        template <class T>
+        struct IsPacket : std::false_type
+        {
+        };
+
+        template <class T, size_t Size>
+        struct IsPacket<Packet<T, Size>> : std::true_type
+        {
+        };
+
+        template <class T>
+        constexpr bool IS_PACKET = IsPacket<std::remove_cv_t<T>>::value;
+
+        // Types usable as the data type of vectors, quaternions and matrices, and as the scalar of their operations
+        template <class T>
+        constexpr bool IS_SCALAR = std::is_arithmetic_v<T> || IS_PACKET<T>;
+
+        /**
+         * \brief Portable packet storage, processed lane by lane
+         */
+        template <class T, size_t Size>
+        struct TPacketArray
+        {
+            T m_lanes[Size];
+        };
+
+        /**
+         * \brief Gives the registers used to store a packet's values and masks
+         */
+        template <class T, size_t Size>
+        struct PacketRegisters
+        {
+            using value_type = TPacketArray<T, Size>;
+            using mask_type = TPacketArray<bool, Size>;
+        };
+
+#ifdef LIBMATH_SIMD_SSE
+        template <>
+        struct PacketRegisters<float, 4>
+        {
+            using value_type = __m128;
+            using mask_type = __m128;
+        };
+#endif // LIBMATH_SIMD_SSE
+
+#ifdef LIBMATH_SIMD_AVX
+        template <>
+        struct PacketRegisters<float, 8>
+        {
+            using value_type = __m256;
+            using mask_type = __m256;
+        };
+#endif // LIBMATH_SIMD_AVX
+
+#ifdef LIBMATH_SIMD_AVX512
+        template <>
+        struct PacketRegisters<float, 16>
+        {
+            using value_type = __m512;
+            using mask_type = __mmask16;
+        };
+#endif // LIBMATH_SIMD_AVX512
+
+        template <class T, size_t Size>
+        struct PacketOps;
+    }
+
+    /**
+     * \brief A fixed number of values processed together
+     * \tparam T The lanes' data type. Only float is supported
+     * \tparam Size The number of lanes (4, 8 or 16)
+     */
+    template <class T, size_t Size>
+    class Packet
+    {
+        static_assert(std::is_same_v<T, float>, "Invalid packet - Data type should be float");
+        static_assert(Size == 4 || Size == 8 || Size == 16, "Invalid packet - Size should be 4, 8 or 16");
+
+    public:
+        using value_type = T;
+        using register_type = typename Details::PacketRegisters<T, Size>::value_type;
+        using mask_type = PacketMask<T, Size>;
+
+        static constexpr size_t SIZE = Size;
+
+        /**
+         * \brief Creates a packet with all its lanes set to 0
+         */
+        Packet() = default;
+
+        /**
+         * \brief Creates a packet with all its lanes set to the given value
+         * \param value The lanes' value
+         */
+        Packet(T value);
+
+        /**
+         * \brief Creates a packet from the given register
+         * \param value The packet's register
+         */
+        explicit Packet(const register_type& value);
+
+        /**
+         * \brief Loads a packet from Size consecutive values
+         * \param values The values to load. Don't need to be aligned
+         * \return The loaded packet
+         */
+        static Packet load(const T* values);
+
+        /**
+         * \brief Stores the packet's lanes to Size consecutive values
+         * \param values The output values. Don't need to be aligned
+         */
+        void store(T* values) const;
+
+        /**
+         * \brief Gets the packet's lane at the given index
+         * \param index The lane's index
+         * \return The lane's value
+         */
+        T operator[](size_t index) const;
+
+        /**
+         * \brief Gets the packet's register
+         */
+        register_type getRegister() const;
+
+        /**
+         * \brief Adds the given packet to the current one
+         * \param other The packet to add to this one
+         * \return A reference to the modified packet
+         */
+        Packet& operator+=(const Packet& other);
+
+        /**
+         * \brief Subtracts the given packet from the current one
+         * \param other The packet to subtract from this one
+         * \return A reference to the modified packet
+         */
+        Packet& operator-=(const Packet& other);
+
+        /**
+         * \brief Multiplies the current packet by the given one
+         * \param other The packet to multiply this one by
+         * \return A reference to the modified packet
+         */
+        Packet& operator*=(const Packet& other);
+
+        /**
+         * \brief Divides the current packet by the given one
+         * \param other The packet to divide this one by
+         * \return A reference to the modified packet
+         */
+        Packet& operator/=(const Packet& other);
+
+    private:
+        register_type m_value{};
+    };
+
+    /**
+     * \brief The per-lane result of a packet comparison
+     * \tparam T The compared packets' data type
+     * \tparam Size The number of lanes
+     */
+    template <class T, size_t Size>
+    class PacketMask
+    {
+    public:
+        using register_type = typename Details::PacketRegisters<T, Size>::mask_type;
+
+        /**
+         * \brief Creates a mask with all its lanes set to false
+         */
+        PacketMask() = default;
+
+        /**
+         * \brief Creates a mask with all its lanes set to the given value
+         * \param value The lanes' value
+         */
+        explicit PacketMask(bool value);
+
+        /**
+         * \brief Creates a mask from the given register
+         * \param value The mask's register
+         */
+        explicit PacketMask(const register_type& value);
+
+        /**
+         * \brief Gets the mask's lane at the given index
+         * \param index The lane's index
+         * \return The lane's value
+         */
+        bool operator[](size_t index) const;
+
+        /**
+         * \brief Gets the mask's register
+         */
+        register_type getRegister() const;
+
+    private:
+        register_type m_value{};
+    };
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& packet);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& packet);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    // The scalar operand is broadcast to all the lanes
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(std::type_identity_t<T> left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(std::type_identity_t<T> left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(std::type_identity_t<T> left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(std::type_identity_t<T> left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator==(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator!=(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<=(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>=(const Packet<T, Size>& left, const Packet<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<=(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>=(const Packet<T, Size>& left, std::type_identity_t<T> right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator&(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator|(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator^(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right);
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator!(const PacketMask<T, Size>& mask);
+
+    /**
+     * \brief Picks each lane from one of the given packets
+     * \param mask The lanes to take from ifTrue
+     * \param ifTrue The values of the mask's true lanes
+     * \param ifFalse The values of the mask's false lanes
+     * \return The selected lanes
+     */
+    template <class T, size_t Size>
+    Packet<T, Size> select(const PacketMask<T, Size>& mask, const Packet<T, Size>& ifTrue, const Packet<T, Size>& ifFalse);
+
+    /**
+     * \brief Checks whether all the mask's lanes are true
+     */
+    template <class T, size_t Size>
+    bool all(const PacketMask<T, Size>& mask);
+
+    /**
+     * \brief Checks whether at least one of the mask's lanes is true
+     */
+    template <class T, size_t Size>
+    bool any(const PacketMask<T, Size>& mask);
+
+    using Float4 = Packet<float, 4>;
+    using Float8 = Packet<float, 8>;
+    using Float16 = Packet<float, 16>;
+
+    namespace Details
+    {
+        // Widest packet mapping to a single register, used by the batch kernels
+#if defined(LIBMATH_SIMD_AVX512)
+        using BatchPacket = Float16;
+#elif defined(LIBMATH_SIMD_AVX)
+        using BatchPacket = Float8;
+#elif defined(LIBMATH_SIMD_SSE)
+        using BatchPacket = Float4;
+#endif
+
+        // Packet versions of the Simd.h kernels, used by the Arithmetic.h functions
+        template <class T, size_t Size>
+        Packet<T, Size> packSqrt(const Packet<T, Size>& a);
+
+        template <class T, size_t Size>
+        Packet<T, Size> packInverseSqrt(const Packet<T, Size>& a, EPrecision precision);
+
+        template <class T, size_t Size>
+        Packet<T, Size> packMin(const Packet<T, Size>& a, const Packet<T, Size>& b);
+
+        template <class T, size_t Size>
+        Packet<T, Size> packMax(const Packet<T, Size>& a, const Packet<T, Size>& b);
+
+        template <class T, size_t Size>
+        Packet<T, Size> packAbs(const Packet<T, Size>& a);
+
+        // Lane helpers for the kernels written once for both floats and packets (e.g. TrigonometryBatch.h)
+
+        /**
+         * \brief Picks ifTrue for the mask's true lanes and ifFalse for the others
+         */
+        template <class T, class Mask>
+        constexpr T selectLanes(const Mask& mask, const T& ifTrue, const T& ifFalse);
+
+        /**
+         * \brief Rounds each lane to the nearest integer (ties to even). Only valid for values below 2^22
+         */
+        template <class T>
+        constexpr T roundLanes(const T& value);
+
+        /**
+         * \brief Computes the bitwise and of each lane's bits
+         */
+        template <class T>
+        T bitAndLanes(const T& a, const T& b);
+
+        /**
+         * \brief Computes the bitwise or of each lane's bits
+         */
+        template <class T>
+        T bitOrLanes(const T& a, const T& b);
+
+        /**
+         * \brief Reads each lane's bits as a 32 bits integer and converts it to a float
+         */
+        template <class T>
+        T intBitsToFloatLanes(const T& value);
+
+        /**
+         * \brief Rounds each lane to the nearest 32 bits integer and returns the integer's bits.
+         * The lanes should be in the 32 bits integers range
+         */
+        template <class T>
+        T floatToIntBitsLanes(const T& value);
+    }
+}
+
+#include "Packet.inl"
+
+#endif // !__LIBMATH__PACKET_H__
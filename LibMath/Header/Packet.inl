@@ -0,0 +1,1175 @@
+#ifndef __LIBMATH__PACKET_INL__
+#define __LIBMATH__PACKET_INL__
+
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "Packet.h"
+
+namespace LibMath::Details
+{
+    /**
+     * \brief Portable packet operations, processed lane by lane
+     */
+    template <class T, size_t Size>
+    struct PacketOps
+    {
+        using Register = TPacketArray<T, Size>;
+        using Mask = TPacketArray<bool, Size>;
+
+        template <class Func>
+        static Register map(Func&& func, const Register& a)
+        {
+            Register out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = func(a.m_lanes[i]);
+
+            return out;
+        }
+
+        template <class Func>
+        static Register map(Func&& func, const Register& a, const Register& b)
+        {
+            Register out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = func(a.m_lanes[i], b.m_lanes[i]);
+
+            return out;
+        }
+
+        template <class Func>
+        static Mask compare(Func&& func, const Register& a, const Register& b)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = func(a.m_lanes[i], b.m_lanes[i]);
+
+            return out;
+        }
+
+        static Register broadcast(const T value)
+        {
+            Register out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = value;
+
+            return out;
+        }
+
+        static Register load(const T* values)
+        {
+            Register out;
+            std::memcpy(out.m_lanes, values, sizeof(out.m_lanes));
+            return out;
+        }
+
+        static void store(T* values, const Register& a)
+        {
+            std::memcpy(values, a.m_lanes, sizeof(a.m_lanes));
+        }
+
+        static T lane(const Register& a, const size_t index)
+        {
+            return a.m_lanes[index];
+        }
+
+        static Register add(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x + y; }, a, b);
+        }
+
+        static Register sub(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x - y; }, a, b);
+        }
+
+        static Register mul(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x * y; }, a, b);
+        }
+
+        static Register div(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x / y; }, a, b);
+        }
+
+        static Register negate(const Register& a)
+        {
+            return map([](const T x) { return -x; }, a);
+        }
+
+        static Register sqrt(const Register& a)
+        {
+            return map([](const T x) { return packSqrt(x); }, a);
+        }
+
+        static Register inverseSqrt(const Register& a, const EPrecision precision)
+        {
+            return map([precision](const T x) { return packInverseSqrt(x, precision); }, a);
+        }
+
+        static Register min(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x < y ? x : y; }, a, b);
+        }
+
+        static Register max(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y) { return x > y ? x : y; }, a, b);
+        }
+
+        static Register abs(const Register& a)
+        {
+            return map([](const T x) { return std::fabs(x); }, a);
+        }
+
+        static Register bitAnd(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y)
+            {
+                return std::bit_cast<T>(std::bit_cast<std::uint32_t>(x) & std::bit_cast<std::uint32_t>(y));
+            }, a, b);
+        }
+
+        static Register bitOr(const Register& a, const Register& b)
+        {
+            return map([](const T x, const T y)
+            {
+                return std::bit_cast<T>(std::bit_cast<std::uint32_t>(x) | std::bit_cast<std::uint32_t>(y));
+            }, a, b);
+        }
+
+        static Register intBitsToFloat(const Register& a)
+        {
+            return map([](const T x) { return static_cast<T>(std::bit_cast<std::int32_t>(x)); }, a);
+        }
+
+        static Register floatToIntBits(const Register& a)
+        {
+            return map([](const T x) { return std::bit_cast<T>(static_cast<std::int32_t>(std::nearbyint(x))); }, a);
+        }
+
+        static Mask equal(const Register& a, const Register& b)
+        {
+            return compare([](const T x, const T y) { return x == y; }, a, b);
+        }
+
+        static Mask notEqual(const Register& a, const Register& b)
+        {
+            return compare([](const T x, const T y) { return x != y; }, a, b);
+        }
+
+        static Mask less(const Register& a, const Register& b)
+        {
+            return compare([](const T x, const T y) { return x < y; }, a, b);
+        }
+
+        static Mask lessEqual(const Register& a, const Register& b)
+        {
+            return compare([](const T x, const T y) { return x <= y; }, a, b);
+        }
+
+        static Register select(const Mask& mask, const Register& ifTrue, const Register& ifFalse)
+        {
+            Register out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = mask.m_lanes[i] ? ifTrue.m_lanes[i] : ifFalse.m_lanes[i];
+
+            return out;
+        }
+
+        static Mask maskBroadcast(const bool value)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = value;
+
+            return out;
+        }
+
+        static bool maskLane(const Mask& mask, const size_t index)
+        {
+            return mask.m_lanes[index];
+        }
+
+        static Mask maskAnd(const Mask& a, const Mask& b)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = a.m_lanes[i] && b.m_lanes[i];
+
+            return out;
+        }
+
+        static Mask maskOr(const Mask& a, const Mask& b)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = a.m_lanes[i] || b.m_lanes[i];
+
+            return out;
+        }
+
+        static Mask maskXor(const Mask& a, const Mask& b)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = a.m_lanes[i] != b.m_lanes[i];
+
+            return out;
+        }
+
+        static Mask maskNot(const Mask& a)
+        {
+            Mask out;
+
+            for (size_t i = 0; i < Size; i++)
+                out.m_lanes[i] = !a.m_lanes[i];
+
+            return out;
+        }
+
+        static bool all(const Mask& mask)
+        {
+            for (size_t i = 0; i < Size; i++)
+            {
+                if (!mask.m_lanes[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        static bool any(const Mask& mask)
+        {
+            for (size_t i = 0; i < Size; i++)
+            {
+                if (mask.m_lanes[i])
+                    return true;
+            }
+
+            return false;
+        }
+    };
+
+#ifdef LIBMATH_SIMD_SSE
+    template <>
+    struct PacketOps<float, 4>
+    {
+        using Register = __m128;
+        using Mask = __m128;
+
+        static Register broadcast(const float value)
+        {
+            return _mm_set1_ps(value);
+        }
+
+        static Register load(const float* values)
+        {
+            return _mm_loadu_ps(values);
+        }
+
+        static void store(float* values, const Register a)
+        {
+            _mm_storeu_ps(values, a);
+        }
+
+        static float lane(const Register a, const size_t index)
+        {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, a);
+            return lanes[index];
+        }
+
+        static Register add(const Register a, const Register b)
+        {
+            return _mm_add_ps(a, b);
+        }
+
+        static Register sub(const Register a, const Register b)
+        {
+            return _mm_sub_ps(a, b);
+        }
+
+        static Register mul(const Register a, const Register b)
+        {
+            return _mm_mul_ps(a, b);
+        }
+
+        static Register div(const Register a, const Register b)
+        {
+            return _mm_div_ps(a, b);
+        }
+
+        static Register negate(const Register a)
+        {
+            return _mm_xor_ps(a, _mm_set1_ps(-0.f));
+        }
+
+        static Register sqrt(const Register a)
+        {
+            return _mm_sqrt_ps(a);
+        }
+
+        static Register inverseSqrt(const Register a, const EPrecision precision)
+        {
+            return packInverseSqrt(a, precision);
+        }
+
+        static Register min(const Register a, const Register b)
+        {
+            return _mm_min_ps(a, b);
+        }
+
+        static Register max(const Register a, const Register b)
+        {
+            return _mm_max_ps(a, b);
+        }
+
+        static Register abs(const Register a)
+        {
+            return _mm_andnot_ps(_mm_set1_ps(-0.f), a);
+        }
+
+        static Register bitAnd(const Register a, const Register b)
+        {
+            return _mm_and_ps(a, b);
+        }
+
+        static Register bitOr(const Register a, const Register b)
+        {
+            return _mm_or_ps(a, b);
+        }
+
+        static Register intBitsToFloat(const Register a)
+        {
+#ifdef LIBMATH_SIMD_SSE2
+            return _mm_cvtepi32_ps(_mm_castps_si128(a));
+#else
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, a);
+
+            for (float& lane : lanes)
+                lane = static_cast<float>(std::bit_cast<std::int32_t>(lane));
+
+            return _mm_load_ps(lanes);
+#endif // LIBMATH_SIMD_SSE2
+        }
+
+        static Register floatToIntBits(const Register a)
+        {
+#ifdef LIBMATH_SIMD_SSE2
+            return _mm_castsi128_ps(_mm_cvtps_epi32(a));
+#else
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, a);
+
+            for (float& lane : lanes)
+                lane = std::bit_cast<float>(static_cast<std::int32_t>(std::nearbyint(lane)));
+
+            return _mm_load_ps(lanes);
+#endif // LIBMATH_SIMD_SSE2
+        }
+
+        static Mask equal(const Register a, const Register b)
+        {
+            return _mm_cmpeq_ps(a, b);
+        }
+
+        static Mask notEqual(const Register a, const Register b)
+        {
+            return _mm_cmpneq_ps(a, b);
+        }
+
+        static Mask less(const Register a, const Register b)
+        {
+            return _mm_cmplt_ps(a, b);
+        }
+
+        static Mask lessEqual(const Register a, const Register b)
+        {
+            return _mm_cmple_ps(a, b);
+        }
+
+        static Register select(const Mask mask, const Register ifTrue, const Register ifFalse)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+        }
+
+        static Mask maskBroadcast(const bool value)
+        {
+            return value ? _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps()) : _mm_setzero_ps();
+        }
+
+        static bool maskLane(const Mask mask, const size_t index)
+        {
+            return (_mm_movemask_ps(mask) >> index & 1) != 0;
+        }
+
+        static Mask maskAnd(const Mask a, const Mask b)
+        {
+            return _mm_and_ps(a, b);
+        }
+
+        static Mask maskOr(const Mask a, const Mask b)
+        {
+            return _mm_or_ps(a, b);
+        }
+
+        static Mask maskXor(const Mask a, const Mask b)
+        {
+            return _mm_xor_ps(a, b);
+        }
+
+        static Mask maskNot(const Mask a)
+        {
+            return _mm_xor_ps(a, maskBroadcast(true));
+        }
+
+        static bool all(const Mask mask)
+        {
+            return _mm_movemask_ps(mask) == 0xF;
+        }
+
+        static bool any(const Mask mask)
+        {
+            return _mm_movemask_ps(mask) != 0;
+        }
+    };
+#endif // LIBMATH_SIMD_SSE
+
+#ifdef LIBMATH_SIMD_AVX
+    template <>
+    struct PacketOps<float, 8>
+    {
+        using Register = __m256;
+        using Mask = __m256;
+
+        static Register broadcast(const float value)
+        {
+            return _mm256_set1_ps(value);
+        }
+
+        static Register load(const float* values)
+        {
+            return _mm256_loadu_ps(values);
+        }
+
+        static void store(float* values, const Register a)
+        {
+            _mm256_storeu_ps(values, a);
+        }
+
+        static float lane(const Register a, const size_t index)
+        {
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, a);
+            return lanes[index];
+        }
+
+        static Register add(const Register a, const Register b)
+        {
+            return _mm256_add_ps(a, b);
+        }
+
+        static Register sub(const Register a, const Register b)
+        {
+            return _mm256_sub_ps(a, b);
+        }
+
+        static Register mul(const Register a, const Register b)
+        {
+            return _mm256_mul_ps(a, b);
+        }
+
+        static Register div(const Register a, const Register b)
+        {
+            return _mm256_div_ps(a, b);
+        }
+
+        static Register negate(const Register a)
+        {
+            return _mm256_xor_ps(a, _mm256_set1_ps(-0.f));
+        }
+
+        static Register sqrt(const Register a)
+        {
+            return _mm256_sqrt_ps(a);
+        }
+
+        static Register inverseSqrt(const Register a, const EPrecision precision)
+        {
+            return packInverseSqrt(a, precision);
+        }
+
+        static Register min(const Register a, const Register b)
+        {
+            return _mm256_min_ps(a, b);
+        }
+
+        static Register max(const Register a, const Register b)
+        {
+            return _mm256_max_ps(a, b);
+        }
+
+        static Register abs(const Register a)
+        {
+            return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a);
+        }
+
+        static Register bitAnd(const Register a, const Register b)
+        {
+            return _mm256_and_ps(a, b);
+        }
+
+        static Register bitOr(const Register a, const Register b)
+        {
+            return _mm256_or_ps(a, b);
+        }
+
+        static Register intBitsToFloat(const Register a)
+        {
+            return _mm256_cvtepi32_ps(_mm256_castps_si256(a));
+        }
+
+        static Register floatToIntBits(const Register a)
+        {
+            return _mm256_castsi256_ps(_mm256_cvtps_epi32(a));
+        }
+
+        static Mask equal(const Register a, const Register b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+        }
+
+        static Mask notEqual(const Register a, const Register b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+        }
+
+        static Mask less(const Register a, const Register b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+        }
+
+        static Mask lessEqual(const Register a, const Register b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+        }
+
+        static Register select(const Mask mask, const Register ifTrue, const Register ifFalse)
+        {
+            return _mm256_blendv_ps(ifFalse, ifTrue, mask);
+        }
+
+        static Mask maskBroadcast(const bool value)
+        {
+            return value ? _mm256_castsi256_ps(_mm256_set1_epi32(-1)) : _mm256_setzero_ps();
+        }
+
+        static bool maskLane(const Mask mask, const size_t index)
+        {
+            return (_mm256_movemask_ps(mask) >> index & 1) != 0;
+        }
+
+        static Mask maskAnd(const Mask a, const Mask b)
+        {
+            return _mm256_and_ps(a, b);
+        }
+
+        static Mask maskOr(const Mask a, const Mask b)
+        {
+            return _mm256_or_ps(a, b);
+        }
+
+        static Mask maskXor(const Mask a, const Mask b)
+        {
+            return _mm256_xor_ps(a, b);
+        }
+
+        static Mask maskNot(const Mask a)
+        {
+            return _mm256_xor_ps(a, maskBroadcast(true));
+        }
+
+        static bool all(const Mask mask)
+        {
+            return _mm256_movemask_ps(mask) == 0xFF;
+        }
+
+        static bool any(const Mask mask)
+        {
+            return _mm256_movemask_ps(mask) != 0;
+        }
+    };
+#endif // LIBMATH_SIMD_AVX
+
+#ifdef LIBMATH_SIMD_AVX512
+    // Some operations use their full mask version - the unmasked intrinsics trigger spurious uninitialized warnings
+    // with some GCC versions
+    template <>
+    struct PacketOps<float, 16>
+    {
+        using Register = __m512;
+        using Mask = __mmask16;
+
+        static Register broadcast(const float value)
+        {
+            return _mm512_set1_ps(value);
+        }
+
+        static Register load(const float* values)
+        {
+            return _mm512_loadu_ps(values);
+        }
+
+        static void store(float* values, const Register a)
+        {
+            _mm512_storeu_ps(values, a);
+        }
+
+        static float lane(const Register a, const size_t index)
+        {
+            alignas(64) float lanes[16];
+            _mm512_store_ps(lanes, a);
+            return lanes[index];
+        }
+
+        static Register add(const Register a, const Register b)
+        {
+            return _mm512_add_ps(a, b);
+        }
+
+        static Register sub(const Register a, const Register b)
+        {
+            return _mm512_sub_ps(a, b);
+        }
+
+        static Register mul(const Register a, const Register b)
+        {
+            return _mm512_mul_ps(a, b);
+        }
+
+        static Register div(const Register a, const Register b)
+        {
+            return _mm512_div_ps(a, b);
+        }
+
+        static Register negate(const Register a)
+        {
+            return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MIN)));
+        }
+
+        static Register sqrt(const Register a)
+        {
+            return _mm512_maskz_sqrt_ps(0xFFFF, a);
+        }
+
+        static Register inverseSqrt(const Register a, const EPrecision precision)
+        {
+            if (precision == EPrecision::PRECISE)
+                return _mm512_div_ps(_mm512_set1_ps(1.f), sqrt(a));
+
+            // Subnormals are scaled by 2^24 like in the SSE/AVX versions, and 1 / sqrt(a * 2^24) = 2^-12 / sqrt(a)
+            const __mmask16 isSubnormal = _mm512_cmp_ps_mask(a, _mm512_set1_ps(FLT_MIN), _CMP_LT_OQ);
+            const __m512    scaled      = _mm512_mask_mul_ps(a, isSubnormal, a, _mm512_set1_ps(16777216.f));
+            const __m512    rescale     = _mm512_mask_blend_ps(isSubnormal, _mm512_set1_ps(1.f), _mm512_set1_ps(4096.f));
+
+            // 14 bits estimate - already more accurate than the SSE/AVX refined one for FAST
+            const __m512 estimate = _mm512_maskz_rsqrt14_ps(0xFFFF, scaled);
+
+            if (precision == EPrecision::FAST)
+                return _mm512_mul_ps(estimate, rescale);
+
+            const __m512 product = _mm512_mul_ps(_mm512_mul_ps(scaled, estimate), estimate);
+            const __m512 refined = _mm512_mul_ps(estimate,
+                _mm512_sub_ps(_mm512_set1_ps(1.5f), _mm512_mul_ps(_mm512_set1_ps(.5f), product)));
+
+            // 0 * inf is NaN for a = 0 or a = inf, for which the estimate is already exact
+            return _mm512_mul_ps(_mm512_mask_blend_ps(_mm512_cmp_ps_mask(product, product, _CMP_ORD_Q), estimate, refined), rescale);
+        }
+
+        static Register min(const Register a, const Register b)
+        {
+            return _mm512_maskz_min_ps(0xFFFF, a, b);
+        }
+
+        static Register max(const Register a, const Register b)
+        {
+            return _mm512_maskz_max_ps(0xFFFF, a, b);
+        }
+
+        static Register abs(const Register a)
+        {
+            return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MAX)));
+        }
+
+        static Register bitAnd(const Register a, const Register b)
+        {
+            return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+
+        static Register bitOr(const Register a, const Register b)
+        {
+            return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+
+        static Register intBitsToFloat(const Register a)
+        {
+            return _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_castps_si512(a));
+        }
+
+        static Register floatToIntBits(const Register a)
+        {
+            return _mm512_castsi512_ps(_mm512_maskz_cvtps_epi32(0xFFFF, a));
+        }
+
+        static Mask equal(const Register a, const Register b)
+        {
+            return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+        }
+
+        static Mask notEqual(const Register a, const Register b)
+        {
+            return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ);
+        }
+
+        static Mask less(const Register a, const Register b)
+        {
+            return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+        }
+
+        static Mask lessEqual(const Register a, const Register b)
+        {
+            return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);
+        }
+
+        static Register select(const Mask mask, const Register ifTrue, const Register ifFalse)
+        {
+            return _mm512_mask_blend_ps(mask, ifFalse, ifTrue);
+        }
+
+        static Mask maskBroadcast(const bool value)
+        {
+            return value ? static_cast<Mask>(0xFFFF) : static_cast<Mask>(0);
+        }
+
+        static bool maskLane(const Mask mask, const size_t index)
+        {
+            return (mask >> index & 1) != 0;
+        }
+
+        static Mask maskAnd(const Mask a, const Mask b)
+        {
+            return static_cast<Mask>(a & b);
+        }
+
+        static Mask maskOr(const Mask a, const Mask b)
+        {
+            return static_cast<Mask>(a | b);
+        }
+
+        static Mask maskXor(const Mask a, const Mask b)
+        {
+            return static_cast<Mask>(a ^ b);
+        }
+
+        static Mask maskNot(const Mask a)
+        {
+            return static_cast<Mask>(~a);
+        }
+
+        static bool all(const Mask mask)
+        {
+            return mask == 0xFFFF;
+        }
+
+        static bool any(const Mask mask)
+        {
+            return mask != 0;
+        }
+    };
+#endif // LIBMATH_SIMD_AVX512
+}
+
+namespace LibMath
+{
+    template <class T, size_t Size>
+    Packet<T, Size>::Packet(const T value)
+        : m_value(Details::PacketOps<T, Size>::broadcast(value))
+    {
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size>::Packet(const register_type& value)
+        : m_value(value)
+    {
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> Packet<T, Size>::load(const T* values)
+    {
+        return Packet(Details::PacketOps<T, Size>::load(values));
+    }
+
+    template <class T, size_t Size>
+    void Packet<T, Size>::store(T* values) const
+    {
+        Details::PacketOps<T, Size>::store(values, m_value);
+    }
+
+    template <class T, size_t Size>
+    T Packet<T, Size>::operator[](const size_t index) const
+    {
+        return Details::PacketOps<T, Size>::lane(m_value, index);
+    }
+
+    template <class T, size_t Size>
+    typename Packet<T, Size>::register_type Packet<T, Size>::getRegister() const
+    {
+        return m_value;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size>& Packet<T, Size>::operator+=(const Packet& other)
+    {
+        m_value = Details::PacketOps<T, Size>::add(m_value, other.m_value);
+        return *this;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size>& Packet<T, Size>::operator-=(const Packet& other)
+    {
+        m_value = Details::PacketOps<T, Size>::sub(m_value, other.m_value);
+        return *this;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size>& Packet<T, Size>::operator*=(const Packet& other)
+    {
+        m_value = Details::PacketOps<T, Size>::mul(m_value, other.m_value);
+        return *this;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size>& Packet<T, Size>::operator/=(const Packet& other)
+    {
+        m_value = Details::PacketOps<T, Size>::div(m_value, other.m_value);
+        return *this;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size>::PacketMask(const bool value)
+        : m_value(Details::PacketOps<T, Size>::maskBroadcast(value))
+    {
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size>::PacketMask(const register_type& value)
+        : m_value(value)
+    {
+    }
+
+    template <class T, size_t Size>
+    bool PacketMask<T, Size>::operator[](const size_t index) const
+    {
+        return Details::PacketOps<T, Size>::maskLane(m_value, index);
+    }
+
+    template <class T, size_t Size>
+    typename PacketMask<T, Size>::register_type PacketMask<T, Size>::getRegister() const
+    {
+        return m_value;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& packet)
+    {
+        return packet;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& packet)
+    {
+        return Packet<T, Size>(Details::PacketOps<T, Size>::negate(packet.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) += right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) -= right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) *= right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) /= right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(left) += Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(left) -= Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(left) *= Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(left) /= Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator+(const std::type_identity_t<T> left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) += right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator-(const std::type_identity_t<T> left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) -= right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator*(const std::type_identity_t<T> left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) *= right;
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> operator/(const std::type_identity_t<T> left, const Packet<T, Size>& right)
+    {
+        return Packet<T, Size>(left) /= right;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator==(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::equal(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator!=(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::notEqual(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::less(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<=(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::lessEqual(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return right < left;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>=(const Packet<T, Size>& left, const Packet<T, Size>& right)
+    {
+        return right <= left;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return left < Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator<=(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return left <= Packet<T, Size>(right);
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(right) < left;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator>=(const Packet<T, Size>& left, const std::type_identity_t<T> right)
+    {
+        return Packet<T, Size>(right) <= left;
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator&(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::maskAnd(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator|(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::maskOr(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator^(const PacketMask<T, Size>& left, const PacketMask<T, Size>& right)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::maskXor(left.getRegister(), right.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    PacketMask<T, Size> operator!(const PacketMask<T, Size>& mask)
+    {
+        return PacketMask<T, Size>(Details::PacketOps<T, Size>::maskNot(mask.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    Packet<T, Size> select(const PacketMask<T, Size>& mask, const Packet<T, Size>& ifTrue, const Packet<T, Size>& ifFalse)
+    {
+        return Packet<T, Size>(Details::PacketOps<T, Size>::select(mask.getRegister(), ifTrue.getRegister(), ifFalse.getRegister()));
+    }
+
+    template <class T, size_t Size>
+    bool all(const PacketMask<T, Size>& mask)
+    {
+        return Details::PacketOps<T, Size>::all(mask.getRegister());
+    }
+
+    template <class T, size_t Size>
+    bool any(const PacketMask<T, Size>& mask)
+    {
+        return Details::PacketOps<T, Size>::any(mask.getRegister());
+    }
+
+    namespace Details
+    {
+        template <class T, size_t Size>
+        Packet<T, Size> packSqrt(const Packet<T, Size>& a)
+        {
+            return Packet<T, Size>(PacketOps<T, Size>::sqrt(a.getRegister()));
+        }
+
+        template <class T, size_t Size>
+        Packet<T, Size> packInverseSqrt(const Packet<T, Size>& a, const EPrecision precision)
+        {
+            return Packet<T, Size>(PacketOps<T, Size>::inverseSqrt(a.getRegister(), precision));
+        }
+
+        template <class T, size_t Size>
+        Packet<T, Size> packMin(const Packet<T, Size>& a, const Packet<T, Size>& b)
+        {
+            return Packet<T, Size>(PacketOps<T, Size>::min(a.getRegister(), b.getRegister()));
+        }
+
+        template <class T, size_t Size>
+        Packet<T, Size> packMax(const Packet<T, Size>& a, const Packet<T, Size>& b)
+        {
+            return Packet<T, Size>(PacketOps<T, Size>::max(a.getRegister(), b.getRegister()));
+        }
+
+        template <class T, size_t Size>
+        Packet<T, Size> packAbs(const Packet<T, Size>& a)
+        {
+            return Packet<T, Size>(PacketOps<T, Size>::abs(a.getRegister()));
+        }
+
+        template <class T, class Mask>
+        constexpr T selectLanes(const Mask& mask, const T& ifTrue, const T& ifFalse)
+        {
+            if constexpr (IS_PACKET<T>)
+                return select(mask, ifTrue, ifFalse);
+            else
+                return mask ? ifTrue : ifFalse;
+        }
+
+        template <class T>
+        constexpr T roundLanes(const T& value)
+        {
+            // Adding 1.5 * 2^23 moves the fractional bits out of the mantissa
+            constexpr float roundingOffset = 12582912.f;
+            return (value + roundingOffset) - roundingOffset;
+        }
+
+        template <class T>
+        T bitAndLanes(const T& a, const T& b)
+        {
+            if constexpr (IS_PACKET<T>)
+                return T(PacketOps<typename T::value_type, T::SIZE>::bitAnd(a.getRegister(), b.getRegister()));
+            else
+                return std::bit_cast<T>(std::bit_cast<std::uint32_t>(a) & std::bit_cast<std::uint32_t>(b));
+        }
+
+        template <class T>
+        T bitOrLanes(const T& a, const T& b)
+        {
+            if constexpr (IS_PACKET<T>)
+                return T(PacketOps<typename T::value_type, T::SIZE>::bitOr(a.getRegister(), b.getRegister()));
+            else
+                return std::bit_cast<T>(std::bit_cast<std::uint32_t>(a) | std::bit_cast<std::uint32_t>(b));
+        }
+
+        template <class T>
+        T intBitsToFloatLanes(const T& value)
+        {
+            if constexpr (IS_PACKET<T>)
+                return T(PacketOps<typename T::value_type, T::SIZE>::intBitsToFloat(value.getRegister()));
+            else
+                return static_cast<T>(std::bit_cast<std::int32_t>(value));
+        }
+
+        template <class T>
+        T floatToIntBitsLanes(const T& value)
+        {
+            if constexpr (IS_PACKET<T>)
+                return T(PacketOps<typename T::value_type, T::SIZE>::floatToIntBits(value.getRegister()));
+#ifdef LIBMATH_SIMD_SSE
+            else
+                return std::bit_cast<T>(static_cast<std::int32_t>(_mm_cvtss_si32(_mm_set_ss(value))));
+#else
+            else
+                return std::bit_cast<T>(static_cast<std::int32_t>(std::nearbyint(value)));
+#endif // LIBMATH_SIMD_SSE
+        }
+    }
+}
+
+#endif // !__LIBMATH__PACKET_INL__
@@ -4,6 +4,7 @@
 #include <type_traits>
 
 #include "ERotationOrder.h"
+#include "Format.h"
 #include "Interpolation.h"
 
 #include "Angle/Radian.h"
@@ -12,10 +13,12 @@
 
 namespace LibMath
 {
+    // Single precision quaternions are 16 bytes aligned to be loaded in one SSE register
     template <class T>
-    class TQuaternion
+    class alignas(std::is_same_v<T, float> ? 16 : alignof(T)) TQuaternion
     {
-        static_assert(std::is_floating_point_v<T>, "Invalid quaternion - Data type should be a floating point type");
+        static_assert(std::is_floating_point_v<T> || Details::IS_PACKET<T>,
+            "Invalid quaternion - Data type should be a floating point or packet type");
 
     public:
         static constexpr TQuaternion identity();
@@ -76,18 +79,20 @@ namespace LibMath
         /**
          * \brief Creates a quaternion from the given rotation matrix
          * \tparam U The rotation matrix's data type
+         * \tparam Order The rotation matrix's storage order
          * \param rotationMatrix The rotation matrix
          */
-        template <typename U>
-        explicit constexpr TQuaternion(const TMatrix<3, 3, U>& rotationMatrix);
+        template <typename U, EMatrixOrder Order>
+        explicit constexpr TQuaternion(const TMatrix<3, 3, U, Order>& rotationMatrix);
 
         /**
          * \brief Creates a quaternion from the given rotation matrix
          * \tparam U The rotation matrix's data type
+         * \tparam Order The rotation matrix's storage order
          * \param rotationMatrix The rotation matrix
          */
-        template <typename U>
-        explicit constexpr TQuaternion(const TMatrix<4, 4, U>& rotationMatrix);
+        template <typename U, EMatrixOrder Order>
+        explicit constexpr TQuaternion(const TMatrix<4, 4, U, Order>& rotationMatrix);
 
         /**
          * \brief Creates a copy of the given quaternion
@@ -152,24 +157,38 @@ namespace LibMath
         /**
          * \brief Computes a euler representation of the quaternion (x = yaw, y = pitch, z = roll)
          * \return A euler representation of the quaternion
+         * \note Angles are scalar, so packet quaternions can't be converted
          */
-        constexpr TVector3<Radian> toYawPitchRoll() const;
+        constexpr TVector3<Radian> toYawPitchRoll() const
+            requires (!Details::IS_PACKET<T>);
 
         /**
          * \brief Computes a euler representation of the quaternion
          * \param rotationOrder The rotation application order
          * \return A euler representation of the quaternion
+         * \note Angles are scalar, so packet quaternions can't be converted
          */
-        constexpr TVector3<Radian> toEuler(ERotationOrder rotationOrder) const;
+        constexpr TVector3<Radian> toEuler(ERotationOrder rotationOrder) const
+            requires (!Details::IS_PACKET<T>);
 
         /**
          * \brief Converts the quaternion to an angle/axis representation
          * \tparam U The axis' data type
          * \param angle The output angle variable
          * \param axis The output axis variable
+         * \note Angles are scalar, so packet quaternions can't be converted
          */
         template <typename U>
-        constexpr void toAngleAxis(Radian& angle, TVector3<U>& axis) const;
+        constexpr void toAngleAxis(Radian& angle, TVector3<U>& axis) const
+            requires (!Details::IS_PACKET<T>);
+
+        /**
+         * \brief Rotates the given vector by this quaternion
+         * \param vector The vector to rotate
+         * \return The rotated vector
+         * \note The quaternion should be a unit quaternion - computes v + 2w(q x v) + 2q x (q x v) instead of q * v * q^-1
+         */
+        constexpr TVector3<T> rotate(const TVector3<T>& vector) const;
 
         /**
          * \brief Extracts the vector part of the quaternion
@@ -445,6 +464,17 @@ namespace LibMath
     template <class T, class U>
     constexpr TQuaternion<T> operator*(TQuaternion<T> left, const TQuaternion<U>& right);
 
+    /**
+     * \brief Rotates the given vector by the given unit quaternion
+     * \tparam T The quaternion's data type
+     * \tparam U The vector's data type
+     * \param quat The rotation quaternion. Should be a unit quaternion
+     * \param vector The vector to rotate
+     * \return The rotated vector
+     */
+    template <class T, class U>
+    constexpr TVector3<U> operator*(const TQuaternion<T>& quat, const TVector3<U>& vector);
+
     /**
      * \brief Divides the left quaternion by the right one
      * \tparam T The left quaternion's data type
@@ -531,6 +561,27 @@ namespace LibMath
     template <class T>
     std::istream& operator>>(std::istream& stream, TQuaternion<T>& quat);
 
+    /**
+     * \brief Writes the quaternion's string representation to the given buffer without allocating
+     * \tparam T The quaternion's data type
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param quat The quaternion to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TQuaternion<T>& quat);
+
+    /**
+     * \brief Parses a quaternion from the start of the given text (e.g. "{1, 2.5, -3, 0.5}")
+     * \tparam T The quaternion's data type
+     * \param text The text to parse
+     * \param quat The output quaternion. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    template <class T>
+    std::from_chars_result parse(std::string_view text, TQuaternion<T>& quat);
+
 #define QUAT_ALIAS_IMPL(DataType, Alias)                               \
     using Alias = TQuaternion<DataType>;                               \
                                                                        \
@@ -559,7 +610,25 @@ namespace LibMath
 
     QUAT_ALIAS_IMPL(float, Quaternion);
     QUAT_ALIAS_IMPL(double, QuaternionD);
+
+    static_assert(std::is_trivially_copyable_v<Quaternion> && std::is_standard_layout_v<Quaternion>,
+        "Invalid Quaternion - should be trivially copyable and standard layout");
+}
+
+#ifdef __cpp_lib_format
+namespace std
+{
+    /**
+     * \brief Formats quaternions like string(). The format specification applies to each component (e.g. "{:.2f}")
+     */
+    template <class T>
+    struct formatter<LibMath::TQuaternion<T>, char> : LibMath::Details::TComponentsFormatter<T>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::TQuaternion<T>& quat, FormatContext& context) const;
+    };
 }
+#endif // __cpp_lib_format
 
 #include "Quaternion.inl"
 
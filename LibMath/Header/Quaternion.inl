@@ -1,9 +1,35 @@
 #ifndef __LIBMATH__QUATERNION_INL__
 #define __LIBMATH__QUATERNION_INL__
 
+#include <type_traits>
+
 #include "Quaternion.h"
+#include "Simd.h"
 #include "Trigonometry.h"
 
+#ifdef LIBMATH_SIMD_SSE
+namespace LibMath::Details
+{
+    /**
+     * \brief Computes the Hamilton product of two quaternions stored as x y z w.
+     * Products are accumulated in the same order as the generic implementation, which makes the results bit-identical to it
+     */
+    inline __m128 quaternionProduct(const __m128 left, const __m128 right)
+    {
+        const __m128 rightWZYX = _mm_xor_ps(_mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.f, -0.f, 0.f, -0.f));
+        const __m128 rightZWXY = _mm_xor_ps(_mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.f, 0.f, -0.f, -0.f));
+        const __m128 rightYXWZ = _mm_xor_ps(_mm_shuffle_ps(right, right, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f));
+
+        __m128 result = _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 3, 3, 3)), right);
+        result        = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(0, 0, 0, 0)), rightWZYX));
+        result        = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(1, 1, 1, 1)), rightZWXY));
+        result        = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 2, 2, 2)), rightYXWZ));
+
+        return result;
+    }
+}
+#endif // LIBMATH_SIMD_SSE
+
 namespace LibMath
 {
     template <class T>
@@ -35,25 +61,21 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>::TQuaternion(Radian angle, TVector3<U> axis)
     {
-        angle /= 2;
-        axis = axis.normalized() * sin(angle);
+        const SinCos halfAngle = sinCos(angle / 2);
+        axis = axis.normalized() * halfAngle.m_sin;
 
         m_x = axis.m_x;
         m_y = axis.m_y;
         m_z = axis.m_z;
-        m_w = cos(angle);
+        m_w = halfAngle.m_cos;
     }
 
     template <class T>
-    constexpr TQuaternion<T>::TQuaternion(Radian yaw, Radian pitch, Radian roll)
+    constexpr TQuaternion<T>::TQuaternion(const Radian yaw, const Radian pitch, const Radian roll)
     {
-        T cosYaw = cos(yaw /= 2);
-        T cosPitch = cos(pitch /= 2);
-        T cosRoll = cos(roll /= 2);
-
-        T sinYaw = sin(yaw);
-        T sinPitch = sin(pitch);
-        T sinRoll = sin(roll);
+        const auto [sinYaw, cosYaw] = sinCos(yaw / 2);
+        const auto [sinPitch, cosPitch] = sinCos(pitch / 2);
+        const auto [sinRoll, cosRoll] = sinCos(roll / 2);
 
         m_x = cosYaw * sinPitch * cosRoll + sinYaw * cosPitch * sinRoll;
         m_y = sinYaw * cosPitch * cosRoll - cosYaw * sinPitch * sinRoll;
@@ -68,8 +90,8 @@ namespace LibMath
     }
 
     template <class T>
-    template <typename U>
-    constexpr TQuaternion<T>::TQuaternion(const TMatrix<3, 3, U>& rotationMatrix)
+    template <typename U, EMatrixOrder Order>
+    constexpr TQuaternion<T>::TQuaternion(const TMatrix<3, 3, U, Order>& rotationMatrix)
     {
         T traceW = static_cast<T>(rotationMatrix(0, 0) + rotationMatrix(1, 1) + rotationMatrix(2, 2));
         T traceX = static_cast<T>(rotationMatrix(0, 0) - rotationMatrix(1, 1) - rotationMatrix(2, 2));
@@ -79,39 +101,66 @@ namespace LibMath
         T maxVal = squareRoot(maxTrace + static_cast<T>(1)) * static_cast<T>(.5);
         T multiplier = static_cast<T>(.25) / maxVal;
 
-        if (floatEquals(traceW, maxTrace))
+        const T xDiff = multiplier * static_cast<T>(rotationMatrix(2, 1) - rotationMatrix(1, 2));
+        const T yDiff = multiplier * static_cast<T>(rotationMatrix(0, 2) - rotationMatrix(2, 0));
+        const T zDiff = multiplier * static_cast<T>(rotationMatrix(1, 0) - rotationMatrix(0, 1));
+        const T xySum = multiplier * static_cast<T>(rotationMatrix(0, 1) + rotationMatrix(1, 0));
+        const T xzSum = multiplier * static_cast<T>(rotationMatrix(0, 2) + rotationMatrix(2, 0));
+        const T yzSum = multiplier * static_cast<T>(rotationMatrix(1, 2) + rotationMatrix(2, 1));
+
+        if constexpr (Details::IS_PACKET<T>)
+        {
+            // Each lane picks the formula of its own largest trace - W is applied last to win ties like in the scalar version
+            const auto pick = [this](const auto& isLargest, const T& w, const T& x, const T& y, const T& z)
+            {
+                m_w = select(isLargest, w, m_w);
+                m_x = select(isLargest, x, m_x);
+                m_y = select(isLargest, y, m_y);
+                m_z = select(isLargest, z, m_z);
+            };
+
+            m_w = zDiff;
+            m_x = xzSum;
+            m_y = yzSum;
+            m_z = maxVal;
+
+            pick(traceY >= maxTrace, yDiff, xySum, maxVal, yzSum);
+            pick(traceX >= maxTrace, xDiff, maxVal, xySum, xzSum);
+            pick(traceW >= maxTrace, maxVal, xDiff, yDiff, zDiff);
+        }
+        else if (floatEquals(traceW, maxTrace))
         {
             m_w = maxVal;
-            m_x = multiplier * static_cast<T>(rotationMatrix(2, 1) - rotationMatrix(1, 2));
-            m_y = multiplier * static_cast<T>(rotationMatrix(0, 2) - rotationMatrix(2, 0));
-            m_z = multiplier * static_cast<T>(rotationMatrix(1, 0) - rotationMatrix(0, 1));
+            m_x = xDiff;
+            m_y = yDiff;
+            m_z = zDiff;
         }
         else if (floatEquals(traceX, maxTrace))
         {
-            m_w = multiplier * static_cast<T>(rotationMatrix(2, 1) - rotationMatrix(1, 2));
+            m_w = xDiff;
             m_x = maxVal;
-            m_y = multiplier * static_cast<T>(rotationMatrix(0, 1) + rotationMatrix(1, 0));
-            m_z = multiplier * static_cast<T>(rotationMatrix(0, 2) + rotationMatrix(2, 0));
+            m_y = xySum;
+            m_z = xzSum;
         }
         else if (floatEquals(traceY, maxTrace))
         {
-            m_w = multiplier * static_cast<T>(rotationMatrix(0, 2) - rotationMatrix(2, 1));
-            m_x = multiplier * static_cast<T>(rotationMatrix(0, 1) + rotationMatrix(1, 0));
+            m_w = yDiff;
+            m_x = xySum;
             m_y = maxVal;
-            m_z = multiplier * static_cast<T>(rotationMatrix(1, 2) + rotationMatrix(2, 1));
+            m_z = yzSum;
         }
         else
         {
-            m_w = multiplier * static_cast<T>(rotationMatrix(1, 0) - rotationMatrix(0, 1));
-            m_x = multiplier * static_cast<T>(rotationMatrix(0, 2) + rotationMatrix(2, 0));
-            m_y = multiplier * static_cast<T>(rotationMatrix(1, 2) + rotationMatrix(2, 1));
+            m_w = zDiff;
+            m_x = xzSum;
+            m_y = yzSum;
             m_z = maxVal;
         }
     }
 
     template <class T>
-    template <typename U>
-    constexpr TQuaternion<T>::TQuaternion(const TMatrix<4, 4, U>& rotationMatrix)
+    template <typename U, EMatrixOrder Order>
+    constexpr TQuaternion<T>::TQuaternion(const TMatrix<4, 4, U, Order>& rotationMatrix)
         : TQuaternion(rotationMatrix.minor(3, 3))
     {
     }
@@ -134,8 +183,11 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator=(const TQuaternion<U>& other)
     {
-        if (this == reinterpret_cast<const TQuaternion*>(&other))
-            return *this;
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (this == &other)
+                return *this;
+        }
 
         m_x = static_cast<T>(other.m_x);
         m_y = static_cast<T>(other.m_y);
@@ -149,8 +201,11 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator=(TQuaternion<U>&& other) noexcept
     {
-        if (this == reinterpret_cast<const TQuaternion*>(&other))
-            return *this;
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (this == &other)
+                return *this;
+        }
 
         m_x = static_cast<T>(other.m_x);
         m_y = static_cast<T>(other.m_y);
@@ -197,17 +252,36 @@ namespace LibMath
     template <class U>
     constexpr TQuaternion<T> TQuaternion<T>::fromTo(const TVector3<U>& from, const TVector3<U>& to)
     {
-        if (from == -to)
-            return TQuaternion(0, from.m_y + from.m_z, -from.m_x, -from.m_x).normalized();
+        if constexpr (Details::IS_PACKET<U>)
+        {
+            // from == -to is checked lane by lane, the opposite lanes get a half turn around a perpendicular axis
+            const auto isOpposite = Details::floatEqualLanes(from.m_x, -to.m_x) & Details::floatEqualLanes(from.m_y, -to.m_y)
+                & Details::floatEqualLanes(from.m_z, -to.m_z);
+
+            const TQuaternion halfTurn = TQuaternion(0, from.m_y + from.m_z, -from.m_x, -from.m_x).normalized();
+            const TQuaternion rotation = TQuaternion{
+                squareRoot(from.magnitudeSquared() * to.magnitudeSquared()) + from.dot(to),
+                from.cross(to)
+            }.normalized();
+
+            return TQuaternion(select(isOpposite, halfTurn.m_w, rotation.m_w), select(isOpposite, halfTurn.m_x, rotation.m_x),
+                select(isOpposite, halfTurn.m_y, rotation.m_y), select(isOpposite, halfTurn.m_z, rotation.m_z));
+        }
+        else
+        {
+            if (from == -to)
+                return TQuaternion(0, from.m_y + from.m_z, -from.m_x, -from.m_x).normalized();
 
-        return TQuaternion{
-            squareRoot(from.magnitudeSquared() * to.magnitudeSquared()) + from.dot(to),
-            from.cross(to)
-        }.normalized();
+            return TQuaternion{
+                squareRoot(from.magnitudeSquared() * to.magnitudeSquared()) + from.dot(to),
+                from.cross(to)
+            }.normalized();
+        }
     }
 
     template <class T>
     constexpr TVector3<Radian> TQuaternion<T>::toYawPitchRoll() const
+        requires (!Details::IS_PACKET<T>)
     {
         Radian yaw = asin(clamp(static_cast<T>(-2) * (m_x * m_z - m_w * m_y), static_cast<T>(-1), static_cast<T>(1)));
         Radian roll = atan(static_cast<T>(2) * (m_x * m_y + m_w * m_z), m_w * m_w + m_x * m_x - m_y * m_y - m_z * m_z);
@@ -227,6 +301,7 @@ namespace LibMath
 
     template <class T>
     constexpr TVector3<Radian> TQuaternion<T>::toEuler(const ERotationOrder rotationOrder) const
+        requires (!Details::IS_PACKET<T>)
     {
         return LibMath::toEuler(rotation(*this), rotationOrder);
     }
@@ -234,12 +309,23 @@ namespace LibMath
     template <class T>
     template <typename U>
     constexpr void TQuaternion<T>::toAngleAxis(Radian& angle, TVector3<U>& axis) const
+        requires (!Details::IS_PACKET<T>)
     {
         const Radian halfAngle = acos(m_w);
         axis = TVector3<U>(*this) / static_cast<U>(sin(halfAngle));
         angle = halfAngle * 2.f;
     }
 
+    template <class T>
+    constexpr TVector3<T> TQuaternion<T>::rotate(const TVector3<T>& vector) const
+    {
+        // v + 2w(q x v) + 2q x (q x v) = v + w * t + q x t with t = 2(q x v)
+        const TVector3<T> axis = *this;
+        const TVector3<T> t    = axis.cross(vector) * static_cast<T>(2);
+
+        return vector + t * m_w + axis.cross(t);
+    }
+
     template <class T>
     constexpr TQuaternion<T>::operator TVector3<T>() const
     {
@@ -302,6 +388,17 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator+=(const TQuaternion<U>& other)
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                _mm_store_ps(&m_x, _mm_add_ps(_mm_load_ps(&m_x), _mm_load_ps(&other.m_x)));
+                return *this;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         m_x = static_cast<T>(m_x + other.m_x);
         m_y = static_cast<T>(m_y + other.m_y);
         m_z = static_cast<T>(m_z + other.m_z);
@@ -314,6 +411,17 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator-=(const TQuaternion<U>& other)
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                _mm_store_ps(&m_x, _mm_sub_ps(_mm_load_ps(&m_x), _mm_load_ps(&other.m_x)));
+                return *this;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         m_x = static_cast<T>(m_x - other.m_x);
         m_y = static_cast<T>(m_y - other.m_y);
         m_z = static_cast<T>(m_z - other.m_z);
@@ -326,6 +434,17 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator*=(const TQuaternion<U>& other)
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                _mm_store_ps(&m_x, Details::quaternionProduct(_mm_load_ps(&m_x), _mm_load_ps(&other.m_x)));
+                return *this;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         const T a = m_x, b = m_y, c = m_z, s = m_w;
 
         m_w = static_cast<T>(s * other.m_w - a * other.m_x - b * other.m_y - c * other.m_z);
@@ -347,7 +466,7 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator+=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
         m_w = static_cast<T>(m_w + value);
 
@@ -358,7 +477,7 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator-=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
         m_w = static_cast<T>(m_w - value);
 
@@ -369,7 +488,18 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator*=(U scalar)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
+
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<std::common_type_t<T, U>, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                _mm_store_ps(&m_x, _mm_mul_ps(_mm_load_ps(&m_x), _mm_set1_ps(static_cast<T>(scalar))));
+                return *this;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
 
         m_x = static_cast<T>(m_x * scalar);
         m_y = static_cast<T>(m_y * scalar);
@@ -383,7 +513,18 @@ namespace LibMath
     template <typename U>
     constexpr TQuaternion<T>& TQuaternion<T>::operator/=(U scalar)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
+
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<std::common_type_t<T, U>, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                _mm_store_ps(&m_x, _mm_div_ps(_mm_load_ps(&m_x), _mm_set1_ps(static_cast<T>(scalar))));
+                return *this;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
 
         m_x = static_cast<T>(m_x / scalar);
         m_y = static_cast<T>(m_y / scalar);
@@ -420,6 +561,17 @@ namespace LibMath
     template <class T>
     constexpr T TQuaternion<T>::magnitudeSquared() const
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const __m128 values = _mm_load_ps(&m_x);
+                return Details::dot4(values, values);
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w;
     }
 
@@ -427,6 +579,16 @@ namespace LibMath
     template <typename U>
     constexpr T TQuaternion<T>::dot(const TQuaternion<U>& other) const
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Details::dot4(_mm_load_ps(&m_x), _mm_load_ps(&other.m_x));
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         return static_cast<T>(this->m_x * other.m_x +
             this->m_y * other.m_y +
             this->m_z * other.m_z +
@@ -436,6 +598,18 @@ namespace LibMath
     template <class T>
     constexpr TQuaternion<T> TQuaternion<T>::conjugate() const
     {
+#ifdef LIBMATH_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                TQuaternion conjugate;
+                _mm_store_ps(&conjugate.m_x, _mm_xor_ps(_mm_load_ps(&m_x), _mm_setr_ps(-0.f, -0.f, -0.f, 0.f)));
+                return conjugate;
+            }
+        }
+#endif // LIBMATH_SIMD_SSE
+
         return TQuaternion(m_w, -TVector3<T>(*this));
     }
 
@@ -449,34 +623,38 @@ namespace LibMath
     template <class T>
     constexpr void TQuaternion<T>::normalize()
     {
-        *this /= magnitude();
+        *this *= inverseSquareRoot(magnitudeSquared(), EPrecision::BALANCED);
     }
 
     template <class T>
     constexpr TQuaternion<T> TQuaternion<T>::normalized() const
     {
-        return *this / magnitude();
+        return *this * inverseSquareRoot(magnitudeSquared(), EPrecision::BALANCED);
     }
 
     template <class T>
     std::string TQuaternion<T>::string() const
     {
-        std::ostringstream oss;
+        char buffer[4 * Details::MAX_COMPONENT_CHARS + 5];
 
-        oss << "{" << this->m_x << "," << this->m_y << "," << this->m_z << "," << this->m_w << "}";
-
-        return oss.str();
+        const std::to_chars_result result = formatTo(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, result.ptr);
     }
 
     template <class T>
     std::string TQuaternion<T>::stringLong() const
     {
-        std::ostringstream oss;
-
-        oss << "Quaternion{ x:" << this->m_x << ", y:" << this->m_y << ", z:"
-            << this->m_z << ", w:" << this->m_w << " }";
+        std::string str = "Quaternion{ x:";
+        Details::appendComponent(str, this->m_x);
+        str += ", y:";
+        Details::appendComponent(str, this->m_y);
+        str += ", z:";
+        Details::appendComponent(str, this->m_z);
+        str += ", w:";
+        Details::appendComponent(str, this->m_w);
+        str += " }";
 
-        return oss.str();
+        return str;
     }
 
     template <class T, class U>
@@ -542,6 +720,12 @@ namespace LibMath
         return left *= right;
     }
 
+    template <class T, class U>
+    constexpr TVector3<U> operator*(const TQuaternion<T>& quat, const TVector3<U>& vector)
+    {
+        return quat.rotate(vector);
+    }
+
     template <class T, class U>
     constexpr TQuaternion<T> operator/(TQuaternion<T> left, const TQuaternion<U>& right)
     {
@@ -591,35 +775,48 @@ namespace LibMath
 
         std::getline(stream, line, '}');
 
-        int    component = 0;
-        size_t valStart = 0;
+        T values[4];
 
-        do
-        {
-            if (valStart == std::string::npos)
-                break;
+        if (Details::parseComponentList(line.data(), line.data() + line.size(), values, 4).ec == std::errc())
+            quat = TQuaternion<T>(values[3], values[0], values[1], values[2]);
+        else
+            quat = TQuaternion<T>::identity();
 
-            if (line[valStart] == '{' || std::isspace(line[valStart]))
-            {
-                valStart++;
-                continue;
-            }
+        return stream;
+    }
+
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TQuaternion<T>& quat)
+    {
+        const T values[] = { quat.m_x, quat.m_y, quat.m_z, quat.m_w };
+        return Details::formatComponents(first, last, values, 4);
+    }
 
-            if (line[valStart] != '-' && !std::isdigit(line[valStart]))
-                break;
+    template <class T>
+    std::from_chars_result parse(const std::string_view text, TQuaternion<T>& quat)
+    {
+        T values[4];
 
-            quat[component] = std::stof(line.substr(valStart));
+        const std::from_chars_result result = Details::parseComponents(text.data(), text.data() + text.size(), values, 4);
 
-            valStart = line.find(',', valStart) + 1;
-            component++;
-        }
-        while (component < 4 && valStart != 0);
+        if (result.ec == std::errc())
+            quat = TQuaternion<T>(values[3], values[0], values[1], values[2]);
 
-        if (component != 4)
-            quat = TQuaternion<T>::identity();
+        return result;
+    }
+}
 
-        return stream;
+#ifdef __cpp_lib_format
+namespace std
+{
+    template <class T>
+    template <class FormatContext>
+    auto formatter<LibMath::TQuaternion<T>, char>::format(const LibMath::TQuaternion<T>& quat, FormatContext& context) const
+    {
+        const T values[] = { quat.m_x, quat.m_y, quat.m_z, quat.m_w };
+        return this->formatComponents(values, 4, context);
     }
 }
+#endif // __cpp_lib_format
 
 #endif // !__LIBMATH__QUATERNION_INL__
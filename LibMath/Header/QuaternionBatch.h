@@ -0,0 +1,35 @@
+#ifndef __LIBMATH__QUATERNIONBATCH_H__
+#define __LIBMATH__QUATERNIONBATCH_H__
+
+#include <span>
+
+#include "EExecutionPolicy.h"
+#include "Quaternion.h"
+
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+    /**
+     * \brief Rotates the given vectors by the given unit quaternion (i.e. out[i] = quaternion.rotate(vectors[i]))
+     * \param quaternion The rotation quaternion. Should be a unit quaternion
+     * \param vectors The vectors to rotate
+     * \param out The rotated vectors. Should have the same size as the source vectors. Can be the source vectors
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void rotateVectors(const Quaternion& quaternion, std::span<const Vector3> vectors, std::span<Vector3> out,
+                              EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Rotates the given vectors in place by the given unit quaternion
+     * \param quaternion The rotation quaternion. Should be a unit quaternion
+     * \param vectors The vectors to rotate
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void rotateVectors(const Quaternion& quaternion, std::span<Vector3> vectors,
+                              EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+}
+
+#include "QuaternionBatch.inl"
+
+#endif // !__LIBMATH__QUATERNIONBATCH_H__
@@ -0,0 +1,70 @@
+#ifndef __LIBMATH__QUATERNIONBATCH_INL__
+#define __LIBMATH__QUATERNIONBATCH_INL__
+
+#include <cassert>
+
+#include "Batch.h"
+#include "QuaternionBatch.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        /**
+         * \brief Rotates the vectors in [begin, end)
+         */
+        inline void rotateRange(const Quaternion& quaternion, const Vector3* vectors, Vector3* out, size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            static_assert(sizeof(Vector3) == 3 * sizeof(float), "Invalid Vector3 - should be tightly packed");
+
+            // Work on 4 vectors at once in SoA form, with the same operations as TQuaternion::rotate
+            const __m128 qx  = _mm_set1_ps(quaternion.m_x);
+            const __m128 qy  = _mm_set1_ps(quaternion.m_y);
+            const __m128 qz  = _mm_set1_ps(quaternion.m_z);
+            const __m128 qw  = _mm_set1_ps(quaternion.m_w);
+            const __m128 two = _mm_set1_ps(2.f);
+
+            for (; begin + 4 <= end; begin += 4)
+            {
+                __m128 xs, ys, zs;
+                loadDeinterleaved3(&vectors[begin].m_x, xs, ys, zs);
+
+                // t = 2(q x v)
+                const __m128 tx = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(qy, zs), _mm_mul_ps(qz, ys)), two);
+                const __m128 ty = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(qz, xs), _mm_mul_ps(qx, zs)), two);
+                const __m128 tz = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(qx, ys), _mm_mul_ps(qy, xs)), two);
+
+                // v + w * t + q x t
+                xs = _mm_add_ps(_mm_add_ps(xs, _mm_mul_ps(tx, qw)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+                ys = _mm_add_ps(_mm_add_ps(ys, _mm_mul_ps(ty, qw)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+                zs = _mm_add_ps(_mm_add_ps(zs, _mm_mul_ps(tz, qw)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+
+                storeInterleaved3(&out[begin].m_x, xs, ys, zs);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                out[begin] = quaternion.rotate(vectors[begin]);
+        }
+    }
+
+    inline void rotateVectors(const Quaternion& quaternion, const std::span<const Vector3> vectors, const std::span<Vector3> out,
+                              const EExecutionPolicy policy)
+    {
+        assert(vectors.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::forEachRange(out.size(), policy, [&quaternion, vectors = vectors.data(), out = out.data()](const size_t begin, const size_t end)
+        {
+            Details::rotateRange(quaternion, vectors, out, begin, end);
+        });
+    }
+
+    inline void rotateVectors(const Quaternion& quaternion, const std::span<Vector3> vectors, const EExecutionPolicy policy)
+    {
+        rotateVectors(quaternion, std::span<const Vector3>(vectors), vectors, policy);
+    }
+}
+
+#endif // !__LIBMATH__QUATERNIONBATCH_INL__
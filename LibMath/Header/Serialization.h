@@ -0,0 +1,182 @@
+#ifndef __LIBMATH__SERIALIZATION_H__
+#define __LIBMATH__SERIALIZATION_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Angle.h"
+#include "EBinaryEncoding.h"
+#include "Quaternion.h"
+
+#include "Geometry/BoundingBox.h"
+#include "Geometry/BoundingSphere.h"
+
+#include "Matrix/TMatrix.h"
+
+#include "Vector/Vector2.h"
+#include "Vector/Vector3.h"
+#include "Vector/Vector4.h"
+
+/*
+ * Fixed layout binary format. A stream starts with an 8 bytes header :
+ * - the "LMBF" magic
+ * - the format's version, as a little-endian uint16
+ * - the stream's EBinaryEncoding, as a uint8
+ * - a reserved byte (0)
+ * followed by the written values, without any padding. Values are stored as their float components in declaration order
+ * (quaternions as x, y, z, w and matrices row by row whatever their storage order), as little-endian floats in RAW
+ * mode or as little-endian half precision floats in QUANTIZED mode. In QUANTIZED mode, unit quaternions are stored as
+ * snorm16 instead, which keeps their error below 1.6e-5 per component. Integers are always stored as little-endian raw
+ * bytes.
+ * On little-endian hosts, RAW spans of types whose memory layout matches the stored one (e.g. Vector3, Quaternion,
+ * row major matrices and BoundingBox) are copied with a single memcpy.
+ */
+
+namespace LibMath
+{
+    constexpr uint16_t BINARY_FORMAT_VERSION = 1;
+
+    /**
+     * \brief A transform's local position, rotation and scale - the binary format's TRS record
+     */
+    struct TransformRecord
+    {
+        Vector3    m_position;
+        Quaternion m_rotation = Quaternion::identity();
+        Vector3    m_scale = Vector3::one();
+    };
+
+    /**
+     * \brief Gets the number of bytes used to store the given number of values
+     * \tparam T The values' type
+     * \param count The number of values
+     * \param encoding The stream's encoding
+     * \return The values' size in bytes
+     */
+    template <class T>
+    constexpr size_t getBinarySize(size_t count = 1, EBinaryEncoding encoding = EBinaryEncoding::RAW);
+
+    /**
+     * \brief Writes values to a caller provided buffer in the LibMath binary format
+     */
+    class BinaryWriter
+    {
+    public:
+        /**
+         * \brief Creates a writer outputting to the given buffer
+         * \param buffer The output buffer
+         * \param encoding How floats are stored
+         */
+        explicit BinaryWriter(std::span<std::byte> buffer, EBinaryEncoding encoding = EBinaryEncoding::RAW);
+
+        /**
+         * \brief Writes the format's header with the writer's encoding
+         * \return True if the header was written. False if the buffer is too small
+         */
+        bool writeHeader();
+
+        /**
+         * \brief Writes the given value
+         * \param value The value to write
+         * \return True if the value was written. False, and nothing is written, if the buffer is too small
+         */
+        template <class T>
+        bool write(const T& value);
+
+        /**
+         * \brief Writes the given values
+         * \param values The values to write
+         * \return True if the values were written. False, and nothing is written, if the buffer is too small
+         */
+        template <class T>
+        bool writeArray(std::span<const T> values);
+
+        /**
+         * \brief Gets the writer's encoding
+         */
+        EBinaryEncoding getEncoding() const;
+
+        /**
+         * \brief Gets the number of written bytes
+         */
+        size_t getOffset() const;
+
+        /**
+         * \brief Gets the written part of the buffer
+         */
+        std::span<std::byte> getWritten() const;
+
+    private:
+        std::span<std::byte> m_buffer;
+        size_t               m_offset = 0;
+        EBinaryEncoding      m_encoding;
+    };
+
+    /**
+     * \brief Reads values written in the LibMath binary format
+     */
+    class BinaryReader
+    {
+    public:
+        /**
+         * \brief Creates a reader reading from the given data
+         * \param data The data to read
+         * \param encoding How floats are stored. Replaced by the header's encoding when calling readHeader
+         */
+        explicit BinaryReader(std::span<const std::byte> data, EBinaryEncoding encoding = EBinaryEncoding::RAW);
+
+        /**
+         * \brief Reads and validates the format's header, and uses its encoding for the next values
+         * \return True if the header is valid. False, and nothing is read, if the magic doesn't match, the version is newer
+         * than BINARY_FORMAT_VERSION, the encoding is unknown or there isn't enough data
+         */
+        bool readHeader();
+
+        /**
+         * \brief Reads a value
+         * \param value The read value
+         * \return True if the value was read. False, and the value is left unchanged, if there isn't enough data
+         */
+        template <class T>
+        bool read(T& value);
+
+        /**
+         * \brief Reads values until the output is full
+         * \param out The read values
+         * \return True if the values were read. False, and the values are left unchanged, if there isn't enough data
+         */
+        template <class T>
+        bool readArray(std::span<T> out);
+
+        /**
+         * \brief Gets the reader's encoding
+         */
+        EBinaryEncoding getEncoding() const;
+
+        /**
+         * \brief Gets the header's version, or BINARY_FORMAT_VERSION if no header was read
+         */
+        uint16_t getVersion() const;
+
+        /**
+         * \brief Gets the number of read bytes
+         */
+        size_t getOffset() const;
+
+        /**
+         * \brief Gets the number of bytes left to read
+         */
+        size_t getRemaining() const;
+
+    private:
+        std::span<const std::byte> m_data;
+        size_t                     m_offset = 0;
+        EBinaryEncoding            m_encoding;
+        uint16_t                   m_version = BINARY_FORMAT_VERSION;
+    };
+}
+
+#include "Serialization.inl"
+
+#endif // !__LIBMATH__SERIALIZATION_H__
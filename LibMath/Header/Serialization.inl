@@ -0,0 +1,630 @@
+#ifndef __LIBMATH__SERIALIZATION_INL__
+#define __LIBMATH__SERIALIZATION_INL__
+
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <type_traits>
+
+#include "Serialization.h"
+
+#include "Vector/PackedVector.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        constexpr std::byte BINARY_MAGIC[] = { std::byte{ 'L' }, std::byte{ 'M' }, std::byte{ 'B' }, std::byte{ 'F' } };
+        constexpr size_t    BINARY_HEADER_SIZE = 8;
+
+        // Number of floats converted at once by the non memcpy paths - keeps the staging buffers on the stack
+        constexpr size_t BINARY_CHUNK_FLOATS = 1024;
+
+        constexpr bool IS_LITTLE_ENDIAN = std::endian::native == std::endian::little;
+
+        template <class T>
+        concept BinaryInteger = std::integral<T> && !std::same_as<T, bool>;
+
+        /**
+         * \brief Describes how a type's floats are stored
+         * \tparam FloatCount The number of stored floats
+         * \tparam UnitOffset The index of the first float stored as snorm16 in QUANTIZED mode
+         * \tparam UnitCount The number of floats stored as snorm16 in QUANTIZED mode
+         * \tparam IsMemoryLayout Whether the type's memory is exactly its floats in stored order
+         */
+        template <size_t FloatCount, size_t UnitOffset = 0, size_t UnitCount = 0, bool IsMemoryLayout = true>
+        struct TBinaryLayoutBase
+        {
+            static constexpr size_t FLOAT_COUNT      = FloatCount;
+            static constexpr size_t UNIT_OFFSET      = UnitOffset;
+            static constexpr size_t UNIT_COUNT       = UnitCount;
+            static constexpr bool   IS_MEMORY_LAYOUT = IsMemoryLayout;
+        };
+
+        template <class T>
+        struct BinaryLayout;
+
+        template <>
+        struct BinaryLayout<float> : TBinaryLayoutBase<1>
+        {
+            static void store(const float value, float* out)
+            {
+                out[0] = value;
+            }
+
+            static void load(const float* values, float& out)
+            {
+                out = values[0];
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Radian> : TBinaryLayoutBase<1>
+        {
+            static void store(const Radian& value, float* out)
+            {
+                out[0] = value.raw();
+            }
+
+            static void load(const float* values, Radian& out)
+            {
+                out = Radian(values[0]);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Degree> : TBinaryLayoutBase<1>
+        {
+            static void store(const Degree& value, float* out)
+            {
+                out[0] = value.raw();
+            }
+
+            static void load(const float* values, Degree& out)
+            {
+                out = Degree(values[0]);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Vector2> : TBinaryLayoutBase<2>
+        {
+            static void store(const Vector2& value, float* out)
+            {
+                out[0] = value.m_x;
+                out[1] = value.m_y;
+            }
+
+            static void load(const float* values, Vector2& out)
+            {
+                out = Vector2(values[0], values[1]);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Vector3> : TBinaryLayoutBase<3>
+        {
+            static void store(const Vector3& value, float* out)
+            {
+                out[0] = value.m_x;
+                out[1] = value.m_y;
+                out[2] = value.m_z;
+            }
+
+            static void load(const float* values, Vector3& out)
+            {
+                out = Vector3(values[0], values[1], values[2]);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Vector4> : TBinaryLayoutBase<4>
+        {
+            static void store(const Vector4& value, float* out)
+            {
+                out[0] = value.m_x;
+                out[1] = value.m_y;
+                out[2] = value.m_z;
+                out[3] = value.m_w;
+            }
+
+            static void load(const float* values, Vector4& out)
+            {
+                out = Vector4(values[0], values[1], values[2], values[3]);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<Quaternion> : TBinaryLayoutBase<4, 0, 4>
+        {
+            static void store(const Quaternion& value, float* out)
+            {
+                out[0] = value.m_x;
+                out[1] = value.m_y;
+                out[2] = value.m_z;
+                out[3] = value.m_w;
+            }
+
+            static void load(const float* values, Quaternion& out)
+            {
+                out = Quaternion(values[3], values[0], values[1], values[2]);
+            }
+        };
+
+        template <length_t Rows, length_t Cols, EMatrixOrder Order>
+        struct BinaryLayout<TMatrix<Rows, Cols, float, Order>>
+            : TBinaryLayoutBase<static_cast<size_t>(Rows) * Cols, 0, 0, Order == EMatrixOrder::ROW_MAJOR>
+        {
+            static void store(const TMatrix<Rows, Cols, float, Order>& value, float* out)
+            {
+                for (length_t row = 0; row < Rows; row++)
+                {
+                    for (length_t column = 0; column < Cols; column++)
+                        out[row * Cols + column] = value(row, column);
+                }
+            }
+
+            static void load(const float* values, TMatrix<Rows, Cols, float, Order>& out)
+            {
+                for (length_t row = 0; row < Rows; row++)
+                {
+                    for (length_t column = 0; column < Cols; column++)
+                        out(row, column) = values[row * Cols + column];
+                }
+            }
+        };
+
+        template <>
+        struct BinaryLayout<BoundingBox> : TBinaryLayoutBase<6>
+        {
+            static void store(const BoundingBox& value, float* out)
+            {
+                BinaryLayout<Vector3>::store(value.m_min, out);
+                BinaryLayout<Vector3>::store(value.m_max, out + 3);
+            }
+
+            static void load(const float* values, BoundingBox& out)
+            {
+                BinaryLayout<Vector3>::load(values, out.m_min);
+                BinaryLayout<Vector3>::load(values + 3, out.m_max);
+            }
+        };
+
+        template <>
+        struct BinaryLayout<BoundingSphere> : TBinaryLayoutBase<4>
+        {
+            static void store(const BoundingSphere& value, float* out)
+            {
+                BinaryLayout<Vector3>::store(value.m_center, out);
+                out[3] = value.m_radius;
+            }
+
+            static void load(const float* values, BoundingSphere& out)
+            {
+                BinaryLayout<Vector3>::load(values, out.m_center);
+                out.m_radius = values[3];
+            }
+        };
+
+        // The quaternion's alignment pads the record, so it is always gathered
+        template <>
+        struct BinaryLayout<TransformRecord> : TBinaryLayoutBase<10, 3, 4, false>
+        {
+            static void store(const TransformRecord& value, float* out)
+            {
+                BinaryLayout<Vector3>::store(value.m_position, out);
+                BinaryLayout<Quaternion>::store(value.m_rotation, out + 3);
+                BinaryLayout<Vector3>::store(value.m_scale, out + 7);
+            }
+
+            static void load(const float* values, TransformRecord& out)
+            {
+                BinaryLayout<Vector3>::load(values, out.m_position);
+                BinaryLayout<Quaternion>::load(values + 3, out.m_rotation);
+                BinaryLayout<Vector3>::load(values + 7, out.m_scale);
+            }
+        };
+
+        template <class T>
+        constexpr bool IS_BINARY_MEMORY_LAYOUT = BinaryLayout<T>::IS_MEMORY_LAYOUT
+            && sizeof(T) == BinaryLayout<T>::FLOAT_COUNT * sizeof(float);
+
+        // Number of values converted at once, at least one for the types having more than BINARY_CHUNK_FLOATS floats
+        template <class T>
+        constexpr size_t BINARY_CHUNK_VALUES = BINARY_CHUNK_FLOATS / BinaryLayout<T>::FLOAT_COUNT > 0
+            ? BINARY_CHUNK_FLOATS / BinaryLayout<T>::FLOAT_COUNT : 1;
+
+        template <BinaryInteger T>
+        void writeBinaryIntegers(const T* values, std::byte* out, const size_t count)
+        {
+            if constexpr (IS_LITTLE_ENDIAN)
+            {
+                std::memcpy(out, values, count * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    const auto bits = static_cast<std::make_unsigned_t<T>>(values[i]);
+
+                    for (size_t byte = 0; byte < sizeof(T); byte++)
+                        out[i * sizeof(T) + byte] = static_cast<std::byte>(bits >> byte * 8 & 0xFF);
+                }
+            }
+        }
+
+        template <BinaryInteger T>
+        void readBinaryIntegers(const std::byte* data, T* out, const size_t count)
+        {
+            if constexpr (IS_LITTLE_ENDIAN)
+            {
+                std::memcpy(out, data, count * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    std::make_unsigned_t<T> bits = 0;
+
+                    for (size_t byte = 0; byte < sizeof(T); byte++)
+                        bits |= static_cast<std::make_unsigned_t<T>>(static_cast<uint8_t>(data[i * sizeof(T) + byte])) << byte * 8;
+
+                    out[i] = static_cast<T>(bits);
+                }
+            }
+        }
+
+        /**
+         * \brief Reverses the bytes of count 16 or 32 bits values - only used on big-endian hosts
+         */
+        template <class UIntT>
+        void swapBytes(UIntT* values, const size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                UIntT swapped = 0;
+
+                for (size_t byte = 0; byte < sizeof(UIntT); byte++)
+                    swapped |= static_cast<UIntT>((values[i] >> byte * 8 & 0xFF) << (sizeof(UIntT) - 1 - byte) * 8);
+
+                values[i] = swapped;
+            }
+        }
+
+        /**
+         * \brief Converts the floats of count values of T (at most BINARY_CHUNK_VALUES) to their QUANTIZED representation
+         */
+        template <class T>
+        void quantizeFloats(const float* floats, uint16_t* out, const size_t count)
+        {
+            using Layout = BinaryLayout<T>;
+
+            if constexpr (Layout::UNIT_COUNT == Layout::FLOAT_COUNT)
+            {
+                floatsToNormalized(floats, reinterpret_cast<int16_t*>(out), count * Layout::FLOAT_COUNT);
+            }
+            else
+            {
+                floatsToHalves(floats, out, count * Layout::FLOAT_COUNT);
+
+                if constexpr (Layout::UNIT_COUNT != 0)
+                {
+                    // Gather the unit floats so they are converted in bulk too
+                    float   units[BINARY_CHUNK_VALUES<T> * Layout::UNIT_COUNT] = {};
+                    int16_t normalized[BINARY_CHUNK_VALUES<T> * Layout::UNIT_COUNT];
+
+                    for (size_t i = 0; i < count * Layout::UNIT_COUNT; i++)
+                        units[i] = floats[i / Layout::UNIT_COUNT * Layout::FLOAT_COUNT + Layout::UNIT_OFFSET + i % Layout::UNIT_COUNT];
+
+                    floatsToNormalized(units, normalized, count * Layout::UNIT_COUNT);
+
+                    for (size_t i = 0; i < count * Layout::UNIT_COUNT; i++)
+                        out[i / Layout::UNIT_COUNT * Layout::FLOAT_COUNT + Layout::UNIT_OFFSET + i % Layout::UNIT_COUNT] = static_cast<uint16_t>(normalized[i]);
+                }
+            }
+        }
+
+        /**
+         * \brief Converts count values of T (at most BINARY_CHUNK_VALUES) from their QUANTIZED representation to floats
+         */
+        template <class T>
+        void dequantizeFloats(const uint16_t* values, float* out, const size_t count)
+        {
+            using Layout = BinaryLayout<T>;
+
+            if constexpr (Layout::UNIT_COUNT == Layout::FLOAT_COUNT)
+            {
+                normalizedToFloats(reinterpret_cast<const int16_t*>(values), out, count * Layout::FLOAT_COUNT);
+            }
+            else
+            {
+                halvesToFloats(values, out, count * Layout::FLOAT_COUNT);
+
+                if constexpr (Layout::UNIT_COUNT != 0)
+                {
+                    int16_t normalized[BINARY_CHUNK_VALUES<T> * Layout::UNIT_COUNT] = {};
+                    float   units[BINARY_CHUNK_VALUES<T> * Layout::UNIT_COUNT];
+
+                    for (size_t i = 0; i < count * Layout::UNIT_COUNT; i++)
+                        normalized[i] = static_cast<int16_t>(values[i / Layout::UNIT_COUNT * Layout::FLOAT_COUNT + Layout::UNIT_OFFSET + i % Layout::UNIT_COUNT]);
+
+                    normalizedToFloats(normalized, units, count * Layout::UNIT_COUNT);
+
+                    for (size_t i = 0; i < count * Layout::UNIT_COUNT; i++)
+                        out[i / Layout::UNIT_COUNT * Layout::FLOAT_COUNT + Layout::UNIT_OFFSET + i % Layout::UNIT_COUNT] = units[i];
+                }
+            }
+        }
+
+        template <class T>
+        void writeBinaryValues(const T* values, std::byte* out, const size_t count, const EBinaryEncoding encoding)
+        {
+            using Layout = BinaryLayout<T>;
+
+            if constexpr (IS_LITTLE_ENDIAN && IS_BINARY_MEMORY_LAYOUT<T>)
+            {
+                if (encoding == EBinaryEncoding::RAW)
+                {
+                    std::memcpy(out, static_cast<const void*>(values), count * sizeof(T));
+                    return;
+                }
+            }
+
+            constexpr size_t chunkSize = BINARY_CHUNK_VALUES<T>;
+
+            float    staging[chunkSize * Layout::FLOAT_COUNT];
+            uint16_t quantized[chunkSize * Layout::FLOAT_COUNT];
+
+            for (size_t begin = 0; begin < count; begin += chunkSize)
+            {
+                const size_t chunkCount = min(chunkSize, count - begin);
+                const size_t floatCount = chunkCount * Layout::FLOAT_COUNT;
+                const float* floats     = staging;
+
+                if constexpr (IS_BINARY_MEMORY_LAYOUT<T>)
+                {
+                    floats = reinterpret_cast<const float*>(values + begin);
+                }
+                else
+                {
+                    for (size_t i = 0; i < chunkCount; i++)
+                        Layout::store(values[begin + i], staging + i * Layout::FLOAT_COUNT);
+                }
+
+                if (encoding == EBinaryEncoding::RAW)
+                {
+                    if constexpr (IS_LITTLE_ENDIAN)
+                    {
+                        std::memcpy(out, floats, floatCount * sizeof(float));
+                    }
+                    else
+                    {
+                        uint32_t bits[chunkSize * Layout::FLOAT_COUNT];
+                        std::memcpy(bits, floats, floatCount * sizeof(float));
+                        swapBytes(bits, floatCount);
+                        std::memcpy(out, bits, floatCount * sizeof(float));
+                    }
+
+                    out += floatCount * sizeof(float);
+                }
+                else
+                {
+                    quantizeFloats<T>(floats, quantized, chunkCount);
+
+                    if constexpr (!IS_LITTLE_ENDIAN)
+                        swapBytes(quantized, floatCount);
+
+                    std::memcpy(out, quantized, floatCount * sizeof(uint16_t));
+                    out += floatCount * sizeof(uint16_t);
+                }
+            }
+        }
+
+        template <class T>
+        void readBinaryValues(const std::byte* data, T* out, const size_t count, const EBinaryEncoding encoding)
+        {
+            using Layout = BinaryLayout<T>;
+
+            if constexpr (IS_LITTLE_ENDIAN && IS_BINARY_MEMORY_LAYOUT<T>)
+            {
+                if (encoding == EBinaryEncoding::RAW)
+                {
+                    // The memory layout matches - the stored floats are the values' bytes
+                    std::memcpy(static_cast<void*>(out), data, count * sizeof(T));
+                    return;
+                }
+            }
+
+            constexpr size_t chunkSize = BINARY_CHUNK_VALUES<T>;
+
+            float    staging[chunkSize * Layout::FLOAT_COUNT];
+            uint16_t quantized[chunkSize * Layout::FLOAT_COUNT];
+
+            for (size_t begin = 0; begin < count; begin += chunkSize)
+            {
+                const size_t chunkCount = min(chunkSize, count - begin);
+                const size_t floatCount = chunkCount * Layout::FLOAT_COUNT;
+                float*       floats     = staging;
+
+                if constexpr (IS_BINARY_MEMORY_LAYOUT<T>)
+                    floats = reinterpret_cast<float*>(out + begin);
+
+                if (encoding == EBinaryEncoding::RAW)
+                {
+                    if constexpr (IS_LITTLE_ENDIAN)
+                    {
+                        std::memcpy(floats, data, floatCount * sizeof(float));
+                    }
+                    else
+                    {
+                        uint32_t bits[chunkSize * Layout::FLOAT_COUNT];
+                        std::memcpy(bits, data, floatCount * sizeof(float));
+                        swapBytes(bits, floatCount);
+                        std::memcpy(floats, bits, floatCount * sizeof(float));
+                    }
+
+                    data += floatCount * sizeof(float);
+                }
+                else
+                {
+                    std::memcpy(quantized, data, floatCount * sizeof(uint16_t));
+
+                    if constexpr (!IS_LITTLE_ENDIAN)
+                        swapBytes(quantized, floatCount);
+
+                    dequantizeFloats<T>(quantized, floats, chunkCount);
+                    data += floatCount * sizeof(uint16_t);
+                }
+
+                if constexpr (!IS_BINARY_MEMORY_LAYOUT<T>)
+                {
+                    for (size_t i = 0; i < chunkCount; i++)
+                        Layout::load(staging + i * Layout::FLOAT_COUNT, out[begin + i]);
+                }
+            }
+        }
+    }
+
+    template <class T>
+    constexpr size_t getBinarySize(const size_t count, const EBinaryEncoding encoding)
+    {
+        if constexpr (Details::BinaryInteger<T>)
+            return count * sizeof(T);
+        else
+            return count * Details::BinaryLayout<T>::FLOAT_COUNT * (encoding == EBinaryEncoding::QUANTIZED ? sizeof(uint16_t) : sizeof(float));
+    }
+
+    inline BinaryWriter::BinaryWriter(const std::span<std::byte> buffer, const EBinaryEncoding encoding)
+        : m_buffer(buffer), m_encoding(encoding)
+    {
+    }
+
+    inline bool BinaryWriter::writeHeader()
+    {
+        if (m_buffer.size() - m_offset < Details::BINARY_HEADER_SIZE)
+            return false;
+
+        constexpr uint16_t version = BINARY_FORMAT_VERSION;
+
+        std::byte* out = m_buffer.data() + m_offset;
+        std::memcpy(out, Details::BINARY_MAGIC, sizeof(Details::BINARY_MAGIC));
+        Details::writeBinaryIntegers(&version, out + 4, 1);
+        out[6] = static_cast<std::byte>(m_encoding);
+        out[7] = std::byte{ 0 };
+
+        m_offset += Details::BINARY_HEADER_SIZE;
+        return true;
+    }
+
+    template <class T>
+    bool BinaryWriter::write(const T& value)
+    {
+        return writeArray(std::span<const T>(&value, 1));
+    }
+
+    template <class T>
+    bool BinaryWriter::writeArray(const std::span<const T> values)
+    {
+        const size_t size = getBinarySize<T>(values.size(), m_encoding);
+
+        if (m_buffer.size() - m_offset < size)
+            return false;
+
+        if constexpr (Details::BinaryInteger<T>)
+            Details::writeBinaryIntegers(values.data(), m_buffer.data() + m_offset, values.size());
+        else
+            Details::writeBinaryValues(values.data(), m_buffer.data() + m_offset, values.size(), m_encoding);
+
+        m_offset += size;
+        return true;
+    }
+
+    inline EBinaryEncoding BinaryWriter::getEncoding() const
+    {
+        return m_encoding;
+    }
+
+    inline size_t BinaryWriter::getOffset() const
+    {
+        return m_offset;
+    }
+
+    inline std::span<std::byte> BinaryWriter::getWritten() const
+    {
+        return m_buffer.first(m_offset);
+    }
+
+    inline BinaryReader::BinaryReader(const std::span<const std::byte> data, const EBinaryEncoding encoding)
+        : m_data(data), m_encoding(encoding)
+    {
+    }
+
+    inline bool BinaryReader::readHeader()
+    {
+        if (getRemaining() < Details::BINARY_HEADER_SIZE)
+            return false;
+
+        const std::byte* data = m_data.data() + m_offset;
+
+        if (std::memcmp(data, Details::BINARY_MAGIC, sizeof(Details::BINARY_MAGIC)) != 0)
+            return false;
+
+        uint16_t version;
+        Details::readBinaryIntegers(data + 4, &version, 1);
+
+        const auto encoding = static_cast<EBinaryEncoding>(data[6]);
+
+        if (version > BINARY_FORMAT_VERSION || (encoding != EBinaryEncoding::RAW && encoding != EBinaryEncoding::QUANTIZED))
+            return false;
+
+        m_version  = version;
+        m_encoding = encoding;
+        m_offset += Details::BINARY_HEADER_SIZE;
+        return true;
+    }
+
+    template <class T>
+    bool BinaryReader::read(T& value)
+    {
+        return readArray(std::span<T>(&value, 1));
+    }
+
+    template <class T>
+    bool BinaryReader::readArray(const std::span<T> out)
+    {
+        const size_t size = getBinarySize<T>(out.size(), m_encoding);
+
+        if (getRemaining() < size)
+            return false;
+
+        if constexpr (Details::BinaryInteger<T>)
+            Details::readBinaryIntegers(m_data.data() + m_offset, out.data(), out.size());
+        else
+            Details::readBinaryValues(m_data.data() + m_offset, out.data(), out.size(), m_encoding);
+
+        m_offset += size;
+        return true;
+    }
+
+    inline EBinaryEncoding BinaryReader::getEncoding() const
+    {
+        return m_encoding;
+    }
+
+    inline uint16_t BinaryReader::getVersion() const
+    {
+        return m_version;
+    }
+
+    inline size_t BinaryReader::getOffset() const
+    {
+        return m_offset;
+    }
+
+    inline size_t BinaryReader::getRemaining() const
+    {
+        return m_data.size() - m_offset;
+    }
+}
+
+#endif // !__LIBMATH__SERIALIZATION_INL__
@@ -0,0 +1,384 @@
+#ifndef __LIBMATH__SIMD_H__
+#define __LIBMATH__SIMD_H__
+
+/*
+ * Detects the SIMD instruction sets available to the compiler and exposes them through the following macros :
+ * - LIBMATH_SIMD_SSE : SSE is available (always the case on x64 targets)
+ * - LIBMATH_SIMD_SSE2 : SSE2 is available (always the case on x64 targets)
+ * - LIBMATH_SIMD_AVX : AVX is available (e.g. /arch:AVX or -mavx)
+ * - LIBMATH_SIMD_AVX512 : AVX-512 foundation instructions are available (e.g. /arch:AVX512 or -mavx512f)
+ * - LIBMATH_SIMD_F16C : half precision conversion instructions are available (e.g. /arch:AVX2 or -mf16c)
+ * - LIBMATH_SIMD_BMI2 : 64 bits bit deposit/extract instructions are available (e.g. /arch:AVX2 or -mbmi2 on x64 targets)
+ *
+ * Define LIBMATH_FORCE_SCALAR before including any LibMath header to disable every SIMD code path
+ * and fall back to the generic (scalar) implementations.
+ */
+
+#ifndef LIBMATH_FORCE_SCALAR
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define LIBMATH_SIMD_SSE
+#endif
+
+#if defined(LIBMATH_SIMD_SSE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LIBMATH_SIMD_SSE2
+#endif
+
+#if defined(LIBMATH_SIMD_SSE2) && defined(__AVX__)
+#define LIBMATH_SIMD_AVX
+#endif
+
+#if defined(LIBMATH_SIMD_AVX) && defined(__AVX512F__)
+#define LIBMATH_SIMD_AVX512
+#endif
+
+#if defined(LIBMATH_SIMD_AVX) && (defined(__F16C__) || defined(__AVX2__))
+#define LIBMATH_SIMD_F16C
+#endif
+
+#if (defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))) && (defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64))
+#define LIBMATH_SIMD_BMI2
+#endif
+
+#endif // !LIBMATH_FORCE_SCALAR
+
+#if defined(LIBMATH_SIMD_AVX) || defined(LIBMATH_SIMD_BMI2)
+#include <immintrin.h>
+#elif defined(LIBMATH_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(LIBMATH_SIMD_SSE)
+#include <xmmintrin.h>
+#endif
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+#include "EPrecision.h"
+
+namespace LibMath::Details
+{
+    /*
+     * Widest float register available, used by the stream kernels. Kernels are written once against the pack* functions and
+     * instantiated both for FloatPack (main loop) and float (remaining elements), so both paths compute the same operations.
+     */
+#if defined(LIBMATH_SIMD_AVX)
+    using FloatPack = __m256;
+#elif defined(LIBMATH_SIMD_SSE)
+    using FloatPack = __m128;
+#else
+    using FloatPack = float;
+#endif
+
+    constexpr size_t FLOAT_PACK_SIZE = sizeof(FloatPack) / sizeof(float);
+
+    template <class Pack>
+    Pack loadPack(const float* values);
+
+    template <class Pack>
+    Pack broadcastPack(float value);
+
+    template <>
+    inline float loadPack<float>(const float* values)
+    {
+        return *values;
+    }
+
+    template <>
+    inline float broadcastPack<float>(const float value)
+    {
+        return value;
+    }
+
+    inline void storePack(float* values, const float pack)
+    {
+        *values = pack;
+    }
+
+    inline float packAdd(const float a, const float b)
+    {
+        return a + b;
+    }
+
+    inline float packSub(const float a, const float b)
+    {
+        return a - b;
+    }
+
+    inline float packMul(const float a, const float b)
+    {
+        return a * b;
+    }
+
+    inline float packDiv(const float a, const float b)
+    {
+        return a / b;
+    }
+
+    inline float packSqrt(const float a)
+    {
+#ifdef LIBMATH_SIMD_SSE
+        // sqrtss directly - std::sqrt adds a branch to set errno for negative values
+        return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(a)));
+#else
+        return std::sqrt(a);
+#endif
+    }
+
+    inline float packMin(const float a, const float b)
+    {
+        return a < b ? a : b;
+    }
+
+    inline float packMax(const float a, const float b)
+    {
+        return a > b ? a : b;
+    }
+
+#if defined(LIBMATH_SIMD_AVX)
+    template <>
+    inline __m256 loadPack<__m256>(const float* values)
+    {
+        return _mm256_loadu_ps(values);
+    }
+
+    template <>
+    inline __m256 broadcastPack<__m256>(const float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    inline void storePack(float* values, const __m256 pack)
+    {
+        _mm256_storeu_ps(values, pack);
+    }
+
+    inline __m256 packAdd(const __m256 a, const __m256 b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    inline __m256 packSub(const __m256 a, const __m256 b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+
+    inline __m256 packMul(const __m256 a, const __m256 b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    inline __m256 packDiv(const __m256 a, const __m256 b)
+    {
+        return _mm256_div_ps(a, b);
+    }
+
+    inline __m256 packSqrt(const __m256 a)
+    {
+        return _mm256_sqrt_ps(a);
+    }
+
+    // Same semantics as the scalar versions (the second operand is returned when the comparison fails, e.g. for NaNs)
+    inline __m256 packMin(const __m256 a, const __m256 b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+
+    inline __m256 packMax(const __m256 a, const __m256 b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+#elif defined(LIBMATH_SIMD_SSE)
+    template <>
+    inline __m128 loadPack<__m128>(const float* values)
+    {
+        return _mm_loadu_ps(values);
+    }
+
+    template <>
+    inline __m128 broadcastPack<__m128>(const float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    inline void storePack(float* values, const __m128 pack)
+    {
+        _mm_storeu_ps(values, pack);
+    }
+
+    inline __m128 packAdd(const __m128 a, const __m128 b)
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    inline __m128 packSub(const __m128 a, const __m128 b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    inline __m128 packMul(const __m128 a, const __m128 b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    inline __m128 packDiv(const __m128 a, const __m128 b)
+    {
+        return _mm_div_ps(a, b);
+    }
+
+    inline __m128 packSqrt(const __m128 a)
+    {
+        return _mm_sqrt_ps(a);
+    }
+
+    // Same semantics as the scalar versions (the second operand is returned when the comparison fails, e.g. for NaNs)
+    inline __m128 packMin(const __m128 a, const __m128 b)
+    {
+        return _mm_min_ps(a, b);
+    }
+
+    inline __m128 packMax(const __m128 a, const __m128 b)
+    {
+        return _mm_max_ps(a, b);
+    }
+#endif
+
+#ifdef LIBMATH_SIMD_SSE
+    /**
+     * \brief Computes 1 / sqrt(a) for each element of the given pack with the given precision
+     * \note The FAST and BALANCED tiers return +inf for 0 and 0 for +inf, like the PRECISE tier
+     */
+    inline __m128 packInverseSqrt(const __m128 a, const EPrecision precision)
+    {
+        if (precision == EPrecision::PRECISE)
+            return _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(a));
+
+        // rsqrt gives +inf for subnormals - they are scaled by 2^24, and 1 / sqrt(a * 2^24) = 2^-12 / sqrt(a)
+        const __m128 isSubnormal = _mm_cmplt_ps(a, _mm_set1_ps(FLT_MIN));
+        const __m128 scaled      = _mm_mul_ps(a, _mm_or_ps(_mm_and_ps(isSubnormal, _mm_set1_ps(16777216.f)),
+            _mm_andnot_ps(isSubnormal, _mm_set1_ps(1.f))));
+        const __m128 rescale     = _mm_or_ps(_mm_and_ps(isSubnormal, _mm_set1_ps(4096.f)), _mm_andnot_ps(isSubnormal, _mm_set1_ps(1.f)));
+
+        const __m128 estimate = _mm_rsqrt_ps(scaled);
+
+        if (precision == EPrecision::FAST)
+            return _mm_mul_ps(estimate, rescale);
+
+        // Newton-Raphson step - y' = y * (1.5 - .5 * a * y * y)
+        const __m128 product = _mm_mul_ps(_mm_mul_ps(scaled, estimate), estimate);
+        const __m128 refined = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_set1_ps(.5f), product)));
+
+        // 0 * inf is NaN for a = 0 or a = inf, for which the estimate is already exact
+        const __m128 isValid = _mm_cmpord_ps(product, product);
+        return _mm_mul_ps(_mm_or_ps(_mm_and_ps(isValid, refined), _mm_andnot_ps(isValid, estimate)), rescale);
+    }
+#endif
+
+#ifdef LIBMATH_SIMD_AVX
+    inline __m256 packInverseSqrt(const __m256 a, const EPrecision precision)
+    {
+        if (precision == EPrecision::PRECISE)
+            return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(a));
+
+        const __m256 isSubnormal = _mm256_cmp_ps(a, _mm256_set1_ps(FLT_MIN), _CMP_LT_OQ);
+        const __m256 scaled      = _mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.f), _mm256_set1_ps(16777216.f), isSubnormal));
+        const __m256 rescale     = _mm256_blendv_ps(_mm256_set1_ps(1.f), _mm256_set1_ps(4096.f), isSubnormal);
+
+        const __m256 estimate = _mm256_rsqrt_ps(scaled);
+
+        if (precision == EPrecision::FAST)
+            return _mm256_mul_ps(estimate, rescale);
+
+        const __m256 product = _mm256_mul_ps(_mm256_mul_ps(scaled, estimate), estimate);
+        const __m256 refined = _mm256_mul_ps(estimate,
+            _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_set1_ps(.5f), product)));
+
+        const __m256 isValid = _mm256_cmp_ps(product, product, _CMP_ORD_Q);
+        return _mm256_mul_ps(_mm256_blendv_ps(estimate, refined, isValid), rescale);
+    }
+#endif
+
+    inline float packInverseSqrt(const float a, const EPrecision precision)
+    {
+#ifdef LIBMATH_SIMD_SSE
+        // Same estimate as the packed versions so stream remainders match the main loop
+        if (precision != EPrecision::PRECISE)
+            return _mm_cvtss_f32(packInverseSqrt(_mm_set_ss(a), precision));
+#else
+        static_cast<void>(precision);
+#endif
+
+        return 1.f / packSqrt(a);
+    }
+
+    /**
+     * \brief Calls func.template operator()<FloatPack>(index) for each full pack of [0, count)
+     * then func.template operator()<float>(index) for each remaining element
+     */
+    template <class Func>
+    void forEachPack(const size_t count, Func&& func)
+    {
+        size_t index = 0;
+
+        if constexpr (FLOAT_PACK_SIZE > 1)
+        {
+            for (; index + FLOAT_PACK_SIZE <= count; index += FLOAT_PACK_SIZE)
+                func.template operator()<FloatPack>(index);
+        }
+
+        for (; index < count; index++)
+            func.template operator()<float>(index);
+    }
+
+#ifdef LIBMATH_SIMD_SSE
+    /**
+     * \brief Computes a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w, summed in that order like the scalar implementations
+     */
+    inline float dot4(const __m128 a, const __m128 b)
+    {
+        const __m128 products = _mm_mul_ps(a, b);
+
+        __m128 sum = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+        sum        = _mm_add_ss(sum, _mm_movehl_ps(products, products));
+        sum        = _mm_add_ss(sum, _mm_shuffle_ps(products, products, _MM_SHUFFLE(3, 3, 3, 3)));
+
+        return _mm_cvtss_f32(sum);
+    }
+
+    /**
+     * \brief Loads 4 consecutive 3D vectors (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3
+     */
+    inline void loadDeinterleaved3(const float* values, __m128& xs, __m128& ys, __m128& zs)
+    {
+        const __m128 first  = _mm_loadu_ps(values);
+        const __m128 second = _mm_loadu_ps(values + 4);
+        const __m128 third  = _mm_loadu_ps(values + 8);
+
+        const __m128 yzLow  = _mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 0, 2, 1));
+        const __m128 xyHigh = _mm_shuffle_ps(second, third, _MM_SHUFFLE(2, 1, 3, 2));
+
+        xs = _mm_shuffle_ps(first, xyHigh, _MM_SHUFFLE(2, 0, 3, 0));
+        ys = _mm_shuffle_ps(yzLow, xyHigh, _MM_SHUFFLE(3, 1, 2, 0));
+        zs = _mm_shuffle_ps(yzLow, third, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    /**
+     * \brief Stores the given x, y and z components of 4 3D vectors as 4 consecutive 3D vectors
+     */
+    inline void storeInterleaved3(float* values, const __m128 xs, const __m128 ys, const __m128 zs)
+    {
+        const __m128 xxyy0 = _mm_shuffle_ps(xs, ys, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 zzxx0 = _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0));
+        const __m128 yyzz1 = _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 xxyy2 = _mm_shuffle_ps(xs, ys, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 zzxx2 = _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(3, 3, 2, 2));
+        const __m128 yyzz3 = _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(3, 3, 3, 3));
+
+        _mm_storeu_ps(values, _mm_shuffle_ps(xxyy0, zzxx0, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(values + 4, _mm_shuffle_ps(yyzz1, xxyy2, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(values + 8, _mm_shuffle_ps(zzxx2, yyzz3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#endif // LIBMATH_SIMD_SSE
+}
+
+#endif // !__LIBMATH__SIMD_H__
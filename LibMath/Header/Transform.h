@@ -438,12 +438,15 @@ namespace LibMath
 
         /**
          * \brief Extracts the position, rotation and scale from the given transformation matrix
+         * \tparam Order The transformation matrix's storage order
          * \param matrix The transformation matrix to decompose
          * \param position The vector in which the position should be extracted
          * \param rotation The quaternion in which the rotation should be extracted
          * \param scale The vector in which the scale should be extracted
          */
-        static inline void decomposeMatrix(const Matrix4x4& matrix, Vector3& position, Quaternion& rotation, Vector3& scale);
+        template <EMatrixOrder Order>
+        static inline void decomposeMatrix(const TMatrix<4, 4, float, Order>& matrix, Vector3& position, Quaternion& rotation,
+                                           Vector3& scale);
 
     protected:
         /**
@@ -504,12 +504,26 @@ namespace LibMath
 
     inline Matrix4x4 Transform::generateMatrix(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
     {
-        return translation(position)
-            * LibMath::rotation(rotation)
-            * scaling(scale);
+        // Equivalent to translation(position) * rotation(rotation) * scaling(scale) without the matrix products
+        Matrix4x4 matrix = LibMath::rotation(rotation);
+
+        for (length_t row = 0; row < 3; row++)
+        {
+            matrix(row, 0) *= scale.m_x;
+            matrix(row, 1) *= scale.m_y;
+            matrix(row, 2) *= scale.m_z;
+        }
+
+        matrix(0, 3) = position.m_x;
+        matrix(1, 3) = position.m_y;
+        matrix(2, 3) = position.m_z;
+
+        return matrix;
     }
 
-    inline void Transform::decomposeMatrix(const Matrix4x4& matrix, Vector3& position, Quaternion& rotation, Vector3& scale)
+    template <EMatrixOrder Order>
+    inline void Transform::decomposeMatrix(const TMatrix<4, 4, float, Order>& matrix, Vector3& position, Quaternion& rotation,
+                                           Vector3& scale)
     {
         position.m_x = matrix(0, 3);
         position.m_y = matrix(1, 3);
@@ -590,7 +604,7 @@ namespace LibMath
 
     inline void Transform::updateLocalMatrix()
     {
-        m_matrix = m_parent ? m_parent->m_worldMatrix.inverse() * m_worldMatrix : m_worldMatrix;
+        m_matrix = m_parent ? m_parent->m_worldMatrix.inverseAffine() * m_worldMatrix : m_worldMatrix;
         decomposeMatrix(m_matrix, m_position, m_rotation, m_scale);
 
         onChange();
@@ -0,0 +1,91 @@
+#ifndef __LIBMATH__TRIGTABLE_H__
+#define __LIBMATH__TRIGTABLE_H__
+
+#include <cstddef>
+
+#include "ETableInterpolation.h"
+#include "Trigonometry.h"
+
+#include "Angle/Radian.h"
+
+namespace LibMath
+{
+    /**
+     * \brief Sine and cosine lookups in a single table of sines sampled over one period. The cosine reads the same table
+     * a quarter period further. Meant for code that calls trigonometry very often and can tolerate a few 1e-5 of error:
+     * - LINEAR: max error of ~(2pi / Resolution)^2 / 8 - e.g. ~7.5e-5 for 256 entries, ~4.7e-6 for 1024
+     * - NEAREST: max error of ~pi / Resolution
+     * Angles are scaled to entries without being wrapped first, which adds ~6e-8 * |angle| of error (e.g. 6e-5 at 1000
+     * radians). Large angles should be wrapped beforehand.
+     * The table can either be a constexpr variable (built at compile time) or the shared instance returned by get()
+     * (built on first use). Like Trigonometry.h, angles beyond +/-8192 radians and non-finite ones use the standard library.
+     * Small tables stay in the L1 cache and are the fastest option. Large tables pay for cache misses when the angles
+     * are scattered, which can make them slower than the polynomials (cf. Trigonometry_Benchmark)
+     * \tparam Resolution The number of entries per period. Should be a power of 2
+     * \tparam Interpolation How the values between the entries are computed
+     */
+    template <size_t Resolution, ETableInterpolation Interpolation = ETableInterpolation::LINEAR>
+    class TrigTable
+    {
+        static_assert(Resolution >= 4 && (Resolution & (Resolution - 1)) == 0, "Invalid trig table - Resolution should be a power of 2");
+        static_assert(Resolution <= (1 << 20), "Invalid trig table - Resolution should be at most 2^20");
+
+    public:
+        static constexpr size_t RESOLUTION = Resolution;
+
+        /**
+         * \brief Fills the table. Can be evaluated at compile time
+         */
+        constexpr TrigTable();
+
+        /**
+         * \brief Gets the shared table, filled on first use
+         * \return The shared table
+         */
+        static const TrigTable& get();
+
+        /**
+         * \brief Looks up the sine of the given angle
+         * \param angle The angle
+         * \return The angle's approximate sine
+         */
+        constexpr float sin(const Radian& angle) const;
+
+        /**
+         * \brief Looks up the cosine of the given angle
+         * \param angle The angle
+         * \return The angle's approximate cosine
+         */
+        constexpr float cos(const Radian& angle) const;
+
+        /**
+         * \brief Looks up both the sine and the cosine of the given angle from a single index computation
+         * \param angle The angle
+         * \return The angle's approximate sine and cosine
+         */
+        constexpr SinCos sinCos(const Radian& angle) const;
+
+        // Raw angle overloads - the angle is in radians
+        constexpr float  sin(float angle) const;
+        constexpr float  cos(float angle) const;
+        constexpr SinCos sinCos(float angle) const;
+
+    private:
+        /**
+         * \brief Looks up the sine at the given position, in entries
+         * \param index The integer part of the position
+         * \param fraction The fractional part of the position, in [0, 1[
+         * \param phase The offset to add to the index, in entries
+         */
+        constexpr float lookup(size_t index, float fraction, size_t phase) const;
+
+        static constexpr float ENTRIES_PER_RADIAN = static_cast<float>(static_cast<double>(Resolution) / 6.28318530717958647692);
+
+        // One more entry than the resolution so the interpolation never wraps
+        float m_values[Resolution + 1];
+    };
+}
+
+#include "TrigTable.inl"
+
+#endif // !__LIBMATH__TRIGTABLE_H__
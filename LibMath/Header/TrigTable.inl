@@ -0,0 +1,128 @@
+#ifndef __LIBMATH__TRIGTABLE_INL__
+#define __LIBMATH__TRIGTABLE_INL__
+
+#include "TrigTable.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        /**
+         * \brief Splits the given angle's position in a trig table into an entry index and a fraction
+         * \param angle The angle in radians. Should be reducible - cf. canReduceAngle
+         * \param entriesPerRadian The table's number of entries per radian
+         * \param index The output index. Negative positions wrap around, only the index's low bits are meaningful
+         * \param fraction The output fraction, in [0, 1[
+         */
+        constexpr void tablePosition(const float angle, const float entriesPerRadian, size_t& index, float& fraction)
+        {
+            const float position  = angle * entriesPerRadian;
+            int         truncated = static_cast<int>(position);
+
+            if (static_cast<float>(truncated) > position)
+                truncated--;
+
+            index    = static_cast<size_t>(truncated);
+            fraction = position - static_cast<float>(truncated);
+        }
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr TrigTable<Resolution, Interpolation>::TrigTable()
+        : m_values{}
+    {
+        constexpr size_t quarter = Resolution / 4;
+        constexpr double step    = 6.28318530717958647692 / static_cast<double>(Resolution);
+
+        // Only the first quarter is computed - the sine's symmetries give the others exactly.
+        // The constant evaluation series is also used at runtime so both tables are identical
+        for (size_t i = 0; i <= quarter; i++)
+            m_values[i] = static_cast<float>(Details::sinCosSeries(static_cast<double>(i) * step, false));
+
+        for (size_t i = quarter + 1; i <= 2 * quarter; i++)
+            m_values[i] = m_values[2 * quarter - i];
+
+        for (size_t i = 2 * quarter + 1; i < Resolution; i++)
+            m_values[i] = -m_values[i - 2 * quarter];
+
+        m_values[Resolution] = m_values[0];
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    const TrigTable<Resolution, Interpolation>& TrigTable<Resolution, Interpolation>::get()
+    {
+        static const TrigTable table;
+        return table;
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr float TrigTable<Resolution, Interpolation>::sin(const Radian& angle) const
+    {
+        return sin(angle.raw());
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr float TrigTable<Resolution, Interpolation>::cos(const Radian& angle) const
+    {
+        return cos(angle.raw());
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr SinCos TrigTable<Resolution, Interpolation>::sinCos(const Radian& angle) const
+    {
+        return sinCos(angle.raw());
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr float TrigTable<Resolution, Interpolation>::sin(const float angle) const
+    {
+        if (!Details::canReduceAngle(angle))
+            return LibMath::sin(angle, EPrecision::PRECISE);
+
+        size_t index;
+        float  fraction;
+        Details::tablePosition(angle, ENTRIES_PER_RADIAN, index, fraction);
+
+        return lookup(index, fraction, 0);
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr float TrigTable<Resolution, Interpolation>::cos(const float angle) const
+    {
+        if (!Details::canReduceAngle(angle))
+            return LibMath::cos(angle, EPrecision::PRECISE);
+
+        size_t index;
+        float  fraction;
+        Details::tablePosition(angle, ENTRIES_PER_RADIAN, index, fraction);
+
+        // cos(x) = sin(x + pi/2)
+        return lookup(index, fraction, Resolution / 4);
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr SinCos TrigTable<Resolution, Interpolation>::sinCos(const float angle) const
+    {
+        if (!Details::canReduceAngle(angle))
+            return LibMath::sinCos(angle, EPrecision::PRECISE);
+
+        size_t index;
+        float  fraction;
+        Details::tablePosition(angle, ENTRIES_PER_RADIAN, index, fraction);
+
+        return { lookup(index, fraction, 0), lookup(index, fraction, Resolution / 4) };
+    }
+
+    template <size_t Resolution, ETableInterpolation Interpolation>
+    constexpr float TrigTable<Resolution, Interpolation>::lookup(const size_t index, const float fraction, const size_t phase) const
+    {
+        const size_t entry = (index + phase) & (Resolution - 1);
+
+        if constexpr (Interpolation == ETableInterpolation::NEAREST)
+            return m_values[fraction < .5f ? entry : entry + 1];
+        else
+            return m_values[entry] + (m_values[entry + 1] - m_values[entry]) * fraction;
+    }
+}
+
+#endif // !__LIBMATH__TRIGTABLE_INL__
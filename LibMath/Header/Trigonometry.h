@@ -1,18 +1,52 @@
 #ifndef __LIBMATH__TRIGONOMETRY_H__
 #define __LIBMATH__TRIGONOMETRY_H__
 
+#include "EPrecision.h"
+
 namespace LibMath
 {
     class Radian;
 
+    /**
+     * \brief The sine and cosine of an angle
+     */
+    struct SinCos
+    {
+        float m_sin;
+        float m_cos;
+    };
+
     inline constexpr float g_pi = 3.14159265358979323846264338327950288f; // useful constant pi -> 3.141592...
     inline constexpr float g_rad2Deg = 180.f / g_pi;
     inline constexpr float g_deg2Rad = g_pi / 180.f;
 
-    inline float sin(const Radian& angle); // float result = sin(Radian{0.5});		// 0.479426
-    inline float cos(const Radian& angle); // float result = sin(Degree{45});		// 0.707107			// this make use implicit conversion
-    inline float tan(const Radian& angle);
+    /*
+     * The angles are used as is - they aren't wrapped on each call. PRECISE uses the standard library while FAST and
+     * BALANCED reduce the angle to [-pi/4, pi/4] and evaluate minimax polynomials:
+     * - FAST: max error of ~1.2e-5
+     * - BALANCED: max error of ~1.2e-7 (a few ulps)
+     * Angles beyond +/-8192 radians (and non-finite ones) always use the standard library.
+     * Every function of this file can also be evaluated at compile time, from double precision series.
+     */
+    constexpr float sin(const Radian& angle, EPrecision precision = EPrecision::PRECISE); // float result = sin(Radian{0.5});		// 0.479426
+    constexpr float cos(const Radian& angle, EPrecision precision = EPrecision::PRECISE); // float result = sin(Degree{45});		// 0.707107			// this make use implicit conversion
+    constexpr float tan(const Radian& angle, EPrecision precision = EPrecision::PRECISE);
     // float result = sin(0.5_rad);			// 0.479426			// this make use user defined litteral from bellow
+
+    /**
+     * \brief Computes the sine and cosine of the given angle from a single range reduction
+     * \param angle The angle
+     * \param precision The accuracy/speed trade-off of the computation
+     * \return The angle's sine and cosine
+     */
+    constexpr SinCos sinCos(const Radian& angle, EPrecision precision = EPrecision::PRECISE);
+
+    // Raw angle overloads - the angle is in radians, e.g. the raw value of an already wrapped Radian
+    constexpr float  sin(float angle, EPrecision precision);
+    constexpr float  cos(float angle, EPrecision precision);
+    constexpr float  tan(float angle, EPrecision precision);
+    constexpr SinCos sinCos(float angle, EPrecision precision);
+
     constexpr Radian asin(float val);        // Radian angle = asin(0.479426);		// Radian{0.500001}
     constexpr Radian acos(float val);        // Degree angle = acos(0.707107);		// Degree{44.99998}	// this make use implicit conversion
     constexpr Radian atan(float val);        // Radian angle = atan(0.546302);		// Radian{0.500000}
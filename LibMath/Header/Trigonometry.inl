@@ -2,6 +2,8 @@
 #define __LIBMATH__TRIGONOMETRY_INL__
 
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 #include "Trigonometry.h"
 
@@ -9,38 +11,324 @@
 
 namespace LibMath
 {
-    inline float sin(const Radian& angle)
+    namespace Details
     {
-        return sinf(angle.radian());
+        /**
+         * \brief Computes the sine or cosine of an angle in [-pi, pi] from its Taylor series.
+         * Only meant for constant evaluation - the runtime path uses the standard library
+         * \param value The angle in radians
+         * \param isCosine Whether the cosine should be computed instead of the sine
+         * \return The angle's sine or cosine
+         */
+        constexpr double sinCosSeries(const double value, const bool isCosine)
+        {
+            const double valueSqr = value * value;
+
+            double term   = isCosine ? 1. : value;
+            double result = term;
+
+            // The terms of both series are below double precision long before pi^31 / 31!
+            for (int i = isCosine ? 1 : 2; i < 32; i += 2)
+            {
+                term *= -valueSqr / static_cast<double>(i * (i + 1));
+                result += term;
+            }
+
+            return result;
+        }
+
+        /**
+         * \brief Computes the square root of a positive value by Newton iterations on its mantissa.
+         * Only meant for constant evaluation
+         * \param value The value whose square root should be computed
+         * \return The value's square root
+         */
+        constexpr double squareRootSeries(double value)
+        {
+            if (value != value || value < 0.)
+                return std::numeric_limits<double>::quiet_NaN();
+
+            if (value == 0. || value > std::numeric_limits<double>::max())
+                return value;
+
+            // Scale the value to [0.25, 1[ by powers of 4 so a few iterations from 1 are enough
+            double scale = 1.;
+
+            for (; value >= 1.; value *= .25)
+                scale *= 2.;
+
+            for (; value < .25; value *= 4.)
+                scale *= .5;
+
+            double root = 1.;
+
+            for (int i = 0; i < 6; i++)
+                root = .5 * (root + value / root);
+
+            return root * scale;
+        }
+
+        /**
+         * \brief Computes the arc tangent of a value in [-tan(pi/8), tan(pi/8)] from its Taylor series.
+         * Only meant for constant evaluation
+         * \param value The tangent of the angle to find
+         * \return The value's arc tangent
+         */
+        constexpr double atanSeries(const double value)
+        {
+            const double valueSqr = value * value;
+
+            double power  = value;
+            double result = value;
+
+            // tan(pi/8)^83 / 83 is below double precision
+            for (int i = 3; i < 84; i += 2)
+            {
+                power *= -valueSqr;
+                result += power / static_cast<double>(i);
+            }
+
+            return result;
+        }
+
+        /**
+         * \brief Computes the arc tangent of a value, reduced to atanSeries' range.
+         * Only meant for constant evaluation
+         * \param value The tangent of the angle to find
+         * \return The value's arc tangent, in [-pi/2, pi/2]
+         */
+        constexpr double atanValue(const double value)
+        {
+            constexpr double halfPi      = 1.57079632679489661923;
+            constexpr double quarterPi   = .785398163397448309616;
+            constexpr double tanEighthPi = .414213562373095048802;
+
+            if (value < 0.)
+                return -atanValue(-value);
+
+            // atan(x) = pi/2 - atan(1/x) and atan(x) = pi/4 + atan((x - 1) / (x + 1))
+            if (value > 1.)
+                return halfPi - atanValue(1. / value);
+
+            if (value > tanEighthPi)
+                return quarterPi + atanSeries((value - 1.) / (value + 1.));
+
+            return atanSeries(value);
+        }
+
+        /**
+         * \brief Computes the angle of the (x, y) coordinates. Only meant for constant evaluation
+         * \param y The coordinates' y component
+         * \param x The coordinates' x component
+         * \return The coordinates' angle, in [-pi, pi]
+         */
+        constexpr double atanValue(const double y, const double x)
+        {
+            constexpr double pi     = 3.14159265358979323846;
+            constexpr double halfPi = 1.57079632679489661923;
+
+            if (x > 0.)
+                return atanValue(y / x);
+
+            if (x < 0.)
+                return y < 0. ? atanValue(y / x) - pi : atanValue(y / x) + pi;
+
+            if (x == 0.)
+                return y > 0. ? halfPi : y < 0. ? -halfPi : 0.;
+
+            return x; // NaN
+        }
+
+        /**
+         * \brief Computes the arc sine or arc cosine of a value in [-1, 1]. Only meant for constant evaluation
+         * \param value The sine or cosine of the angle to find
+         * \param isCosine Whether the arc cosine should be computed instead of the arc sine
+         * \return The value's arc sine or arc cosine. NaN outside of [-1, 1]
+         */
+        constexpr double asinAcosValue(const double value, const bool isCosine)
+        {
+            if (!(value >= -1. && value <= 1.))
+                return std::numeric_limits<double>::quiet_NaN();
+
+            // The other side of the right triangle, computed as (1 - x)(1 + x) to stay accurate close to +/-1
+            const double side = squareRootSeries((1. - value) * (1. + value));
+            return isCosine ? atanValue(side, value) : atanValue(value, side);
+        }
+
+        // Largest angle for which the quadrant reduction below keeps the polynomials' accuracy
+        inline constexpr float MAX_REDUCED_ANGLE = 8192.f;
+
+        /**
+         * \brief Checks whether the given angle can be reduced by polynomialSinCos
+         * \param angle The angle in radians
+         * \return True if the angle is finite and small enough. False otherwise
+         */
+        constexpr bool canReduceAngle(const float angle)
+        {
+            // Also false for NaN
+            return abs(angle) <= MAX_REDUCED_ANGLE;
+        }
+
+        /**
+         * \brief Computes the sine and cosine of an angle by reducing it to [-pi/4, pi/4] around the closest multiple of
+         * pi/2 (Cody-Waite reduction), then evaluating minimax polynomials of the precision's degree.
+         * The angle should be reducible - cf. canReduceAngle
+         * \param angle The angle in radians
+         * \param precision The polynomials' precision. FAST or BALANCED
+         * \return The angle's sine and cosine
+         */
+        constexpr SinCos polynomialSinCos(const float angle, const EPrecision precision)
+        {
+            constexpr float twoOverPi = 0.636619772367581343f;
+
+            // pi/2 split so that the products of the first parts by the quadrant (< 2^13) are exact
+            constexpr float halfPi1 = 1.5703125f;
+            constexpr float halfPi2 = 4.837512969970703125e-4f;
+            constexpr float halfPi3 = 7.54978995489188216e-8f;
+            constexpr float halfPi23 = 4.8382679489661923e-4f; // halfPi2 + halfPi3 rounded to a float
+
+            const float scaled   = angle * twoOverPi;
+            const int   quadrant = static_cast<int>(scaled + (scaled < 0.f ? -.5f : .5f));
+            const auto  offset   = static_cast<float>(quadrant);
+
+            const float reduced = precision == EPrecision::FAST
+                                      ? angle - offset * halfPi1 - offset * halfPi23
+                                      : angle - offset * halfPi1 - offset * halfPi2 - offset * halfPi3;
+
+            const float reducedSqr = reduced * reduced;
+            float       sine, cosine;
+
+            if (precision == EPrecision::FAST)
+            {
+                sine = reduced + reduced * reducedSqr * (-1.6663458534e-1f + reducedSqr * 8.1646087438e-3f);
+                cosine = 1.f + reducedSqr * (-4.9977630707e-1f + reducedSqr * 4.0488935841e-2f);
+            }
+            else
+            {
+                sine = reduced + reduced * reducedSqr * (-1.6666654674e-1f + reducedSqr *
+                    (8.3321009531e-3f + reducedSqr * -1.9503963126e-4f));
+                cosine = 1.f + reducedSqr * (-4.9999892337e-1f + reducedSqr *
+                    (4.1655600696e-2f + reducedSqr * -1.3585843887e-3f));
+            }
+
+            // sin(x + q * pi/2) and cos(x + q * pi/2) from the quadrant's rotation
+            if (quadrant & 1)
+            {
+                const float tmp = sine;
+                sine = cosine;
+                cosine = tmp;
+            }
+
+            if (quadrant & 2)
+                sine = -sine;
+
+            if ((quadrant + 1) & 2)
+                cosine = -cosine;
+
+            return { sine, cosine };
+        }
+    }
+
+    constexpr float sin(const Radian& angle, const EPrecision precision)
+    {
+        return sin(angle.raw(), precision);
+    }
+
+    constexpr float cos(const Radian& angle, const EPrecision precision)
+    {
+        return cos(angle.raw(), precision);
+    }
+
+    constexpr float tan(const Radian& angle, const EPrecision precision)
+    {
+        return tan(angle.raw(), precision);
+    }
+
+    constexpr SinCos sinCos(const Radian& angle, const EPrecision precision)
+    {
+        return sinCos(angle.raw(), precision);
+    }
+
+    constexpr float sin(const float angle, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+            return static_cast<float>(Details::sinCosSeries(Radian(angle).radian(), false));
+
+        if (precision == EPrecision::PRECISE || !Details::canReduceAngle(angle))
+            return sinf(angle);
+
+        return Details::polynomialSinCos(angle, precision).m_sin;
     }
 
-    inline float cos(const Radian& angle)
+    constexpr float cos(const float angle, const EPrecision precision)
     {
-        return cosf(angle.radian());
+        if (std::is_constant_evaluated())
+            return static_cast<float>(Details::sinCosSeries(Radian(angle).radian(), true));
+
+        if (precision == EPrecision::PRECISE || !Details::canReduceAngle(angle))
+            return cosf(angle);
+
+        return Details::polynomialSinCos(angle, precision).m_cos;
     }
 
-    inline float tan(const Radian& angle)
+    constexpr float tan(const float angle, const EPrecision precision)
     {
-        return tanf(angle.radian());
+        if (std::is_constant_evaluated())
+        {
+            const double radian = Radian(angle).radian();
+            return static_cast<float>(Details::sinCosSeries(radian, false) / Details::sinCosSeries(radian, true));
+        }
+
+        if (precision == EPrecision::PRECISE || !Details::canReduceAngle(angle))
+            return tanf(angle);
+
+        const SinCos sinCos = Details::polynomialSinCos(angle, precision);
+        return sinCos.m_sin / sinCos.m_cos;
+    }
+
+    constexpr SinCos sinCos(const float angle, const EPrecision precision)
+    {
+        if (std::is_constant_evaluated())
+        {
+            const double radian = Radian(angle).radian();
+            return { static_cast<float>(Details::sinCosSeries(radian, false)), static_cast<float>(Details::sinCosSeries(radian, true)) };
+        }
+
+        if (precision == EPrecision::PRECISE || !Details::canReduceAngle(angle))
+            return { sinf(angle), cosf(angle) };
+
+        return Details::polynomialSinCos(angle, precision);
     }
 
     constexpr Radian asin(const float val)
     {
+        if (std::is_constant_evaluated())
+            return Radian(static_cast<float>(Details::asinAcosValue(val, false)));
+
         return Radian(asinf(val));
     }
 
     constexpr Radian acos(const float val)
     {
+        if (std::is_constant_evaluated())
+            return Radian(static_cast<float>(Details::asinAcosValue(val, true)));
+
         return Radian(acosf(val));
     }
 
     constexpr Radian atan(const float val)
     {
+        if (std::is_constant_evaluated())
+            return Radian(static_cast<float>(Details::atanValue(val)));
+
         return Radian(atanf(val));
     }
 
     constexpr Radian atan(const float y, const float x)
     {
+        if (std::is_constant_evaluated())
+            return Radian(static_cast<float>(Details::atanValue(y, x)));
+
         return Radian(atan2f(y, x));
     }
 }
@@ -0,0 +1,104 @@
+#ifndef __LIBMATH__TRIGONOMETRYBATCH_H__
+#define __LIBMATH__TRIGONOMETRYBATCH_H__
+
+#include <span>
+
+#include "EExecutionPolicy.h"
+
+#include "Angle/Radian.h"
+
+/*
+ * Batch versions of the Trigonometry.h functions. The angles are reduced once to [-pi/4, pi/4] and every function is
+ * evaluated with minimax polynomials on the widest available packet, instead of one standard library call per element.
+ * Maximum errors, measured against the exact result :
+ * - sin, cos, sinCos : 2 ulp for angles in [-pi, pi], 1.2e-7 absolute error up to +/-8192 radians.
+ *   Larger or non finite angles fall back to the standard library
+ * - asin : 3 ulp, acos : 2 ulp for values in [-1, 1]. Other values give NaN like the standard library
+ * - atan : 4 ulp for finite coordinates. Signed zeros are not distinguished - atan(+/-0, -0) is 0 instead of +/-pi.
+ *   Infinite or NaN coordinates fall back to the standard library
+ */
+
+namespace LibMath
+{
+    /**
+     * \brief Computes the sine of each of the given angles (i.e. out[i] = sin(angles[i]))
+     * \param angles The angles in radians
+     * \param out The angles' sines. Should have the same size as the angles. Can be the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void sin(std::span<const float> angles, std::span<float> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the sine of each of the given angles (i.e. out[i] = sin(angles[i]))
+     * \param angles The angles
+     * \param out The angles' sines. Should have the same size as the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void sin(std::span<const Radian> angles, std::span<float> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the cosine of each of the given angles (i.e. out[i] = cos(angles[i]))
+     * \param angles The angles in radians
+     * \param out The angles' cosines. Should have the same size as the angles. Can be the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void cos(std::span<const float> angles, std::span<float> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the cosine of each of the given angles (i.e. out[i] = cos(angles[i]))
+     * \param angles The angles
+     * \param out The angles' cosines. Should have the same size as the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void cos(std::span<const Radian> angles, std::span<float> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes both the sine and the cosine of each of the given angles
+     * \param angles The angles in radians
+     * \param sines The angles' sines. Should have the same size as the angles. Can be the angles
+     * \param cosines The angles' cosines. Should have the same size as the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void sinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines,
+                       EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes both the sine and the cosine of each of the given angles
+     * \param angles The angles
+     * \param sines The angles' sines. Should have the same size as the angles
+     * \param cosines The angles' cosines. Should have the same size as the angles
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void sinCos(std::span<const Radian> angles, std::span<float> sines, std::span<float> cosines,
+                       EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the arc sine of each of the given values (i.e. out[i] = asin(values[i]))
+     * \param values The sines of the angles to find
+     * \param out The values' arc sines, in [-pi/2, pi/2]. Should have the same size as the values
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void asin(std::span<const float> values, std::span<Radian> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the arc cosine of each of the given values (i.e. out[i] = acos(values[i]))
+     * \param values The cosines of the angles to find
+     * \param out The values' arc cosines, in [0, pi]. Should have the same size as the values
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void acos(std::span<const float> values, std::span<Radian> out, EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+
+    /**
+     * \brief Computes the angle of each of the given (x, y) coordinates (i.e. out[i] = atan(ys[i], xs[i]))
+     * \param ys The coordinates' y components
+     * \param xs The coordinates' x components. Should have the same size as the y components
+     * \param out The coordinates' angles, in [-pi, pi]. Should have the same size as the coordinates
+     * \param policy Whether large batches should be split across threads or not
+     */
+    inline void atan(std::span<const float> ys, std::span<const float> xs, std::span<Radian> out,
+                     EExecutionPolicy policy = EExecutionPolicy::SEQUENTIAL);
+}
+
+#include "TrigonometryBatch.inl"
+
+#endif // !__LIBMATH__TRIGONOMETRYBATCH_H__
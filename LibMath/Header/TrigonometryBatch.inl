@@ -0,0 +1,372 @@
+#ifndef __LIBMATH__TRIGONOMETRYBATCH_INL__
+#define __LIBMATH__TRIGONOMETRYBATCH_INL__
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "Arithmetic.h"
+#include "Batch.h"
+#include "Packet.h"
+#include "Simd.h"
+#include "Trigonometry.h"
+#include "TrigonometryBatch.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        static_assert(sizeof(Radian) == sizeof(float) && std::is_standard_layout_v<Radian> && std::is_trivially_copyable_v<Radian>,
+                      "Invalid Radian - should only hold its float value");
+
+        /**
+         * \brief Computes the sine and cosine of angles below MAX_REDUCED_ANGLE with the same reduction as
+         * polynomialSinCos, followed by a branchless quadrant fix-up
+         */
+        template <class T>
+        void batchSinCos(const T& angle, T& sine, T& cosine)
+        {
+            constexpr float twoOverPi = 0.636619772367581343f;
+            constexpr float halfPi1   = 1.5703125f;
+            constexpr float halfPi2   = 4.837512969970703125e-4f;
+            constexpr float halfPi3   = 7.54978995489188216e-8f;
+
+            const T quadrant   = roundLanes(angle * twoOverPi);
+            const T reduced    = angle - quadrant * halfPi1 - quadrant * halfPi2 - quadrant * halfPi3;
+            const T reducedSqr = reduced * reduced;
+
+            T sinPoly = reduced + reduced * reducedSqr * (-1.6666654674e-1f + reducedSqr *
+                (8.3321009531e-3f + reducedSqr * -1.9503963126e-4f));
+            const T cosPoly = 1.f + reducedSqr * (-4.9999892337e-1f + reducedSqr *
+                (4.1655600696e-2f + reducedSqr * -1.3585843887e-3f));
+
+            // -0 + (-0 * 0 * negative) is +0 - keep the reduced angle's zero so sin(-0) stays -0
+            sinPoly = selectLanes(reduced == T(0.f), reduced, sinPoly);
+
+            // quadrant / 4 - round(quadrant / 4) is 0, .25, +/-.5 or -.25 for quadrant % 4 = 0, 1, 2 or 3
+            const T    quarter      = quadrant * .25f;
+            const T    fraction     = quarter - roundLanes(quarter);
+            const auto isOdd        = (abs(fraction) > .125f) & (abs(fraction) < .375f);
+            const auto negateSine   = (fraction < -.125f) | (fraction > .375f);
+            const auto negateCosine = (fraction > .125f) | (fraction < -.375f);
+
+            sine   = selectLanes(isOdd, cosPoly, sinPoly);
+            cosine = selectLanes(isOdd, sinPoly, cosPoly);
+            sine   = selectLanes(negateSine, -sine, sine);
+            cosine = selectLanes(negateCosine, -cosine, cosine);
+        }
+
+        /**
+         * \brief Computes the arc sine of |value| in [0, 1], from the polynomial on [0, 0.5] and
+         * asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)) above
+         * \param absValue The absolute value of the sine
+         * \param isLarge Whether the absolute value is above 0.5. The returned value is then asin(sqrt((1 - x) / 2))
+         */
+        template <class T, class Mask>
+        T batchAsinCore(const T& absValue, const Mask& isLarge)
+        {
+            const T value    = selectLanes(isLarge, squareRoot((1.f - absValue) * .5f), absValue);
+            const T valueSqr = value * value;
+
+            return value + value * valueSqr * (1.6666752422e-1f + valueSqr * (7.4953002686e-2f + valueSqr *
+                (4.5470025998e-2f + valueSqr * (2.4181311049e-2f + valueSqr * 4.2163199048e-2f))));
+        }
+
+        template <class T>
+        T batchAsin(const T& value)
+        {
+            constexpr float halfPi = 1.57079632679489662f;
+
+            const T    absValue = abs(value);
+            const auto isLarge  = absValue > .5f;
+            const T    core     = batchAsinCore(absValue, isLarge);
+            const T    result   = selectLanes(isLarge, halfPi - (core + core), core);
+
+            return selectLanes(value < 0.f, -result, result);
+        }
+
+        template <class T>
+        T batchAcos(const T& value)
+        {
+            constexpr float pi     = 3.14159265358979324f;
+            constexpr float halfPi = 1.57079632679489662f;
+
+            const T    absValue = abs(value);
+            const auto isLarge  = absValue > .5f;
+            const auto negative = value < 0.f;
+            const T    core     = batchAsinCore(absValue, isLarge);
+
+            // acos(x) = 2 * asin(sqrt((1 - x) / 2)) above 0.5, pi/2 - asin(x) below
+            const T large = core + core;
+            return selectLanes(isLarge, selectLanes(negative, pi - large, large),
+                               halfPi - selectLanes(negative, -core, core));
+        }
+
+        template <class T>
+        T batchAtan(const T& y, const T& x)
+        {
+            constexpr float pi          = 3.14159265358979324f;
+            constexpr float halfPi      = 1.57079632679489662f;
+            constexpr float quarterPi   = .785398163397448310f;
+            constexpr float tanEighthPi = .414213562373095049f;
+
+            // Reduce to atan(ratio) with ratio in [0, 1], then to [-tan(pi/8), tan(pi/8)] around 0 or pi/4
+            const T absX    = abs(x);
+            const T absY    = abs(y);
+            const T largest = max(absX, absY);
+            const T ratio   = selectLanes(largest > 0.f, min(absX, absY) / largest, T(0.f));
+
+            const auto isLarge    = ratio > tanEighthPi;
+            const T    reduced    = selectLanes(isLarge, (ratio - 1.f) / (ratio + 1.f), ratio);
+            const T    offset     = selectLanes(isLarge, T(quarterPi), T(0.f));
+            const T    reducedSqr = reduced * reduced;
+
+            T result = offset + reduced + reduced * reducedSqr * (-3.33329491539e-1f + reducedSqr *
+                (1.99777106478e-1f + reducedSqr * (-1.38776856032e-1f + reducedSqr * 8.05374449538e-2f)));
+
+            result = selectLanes(absY > absX, halfPi - result, result);
+            result = selectLanes(x < 0.f, pi - result, result);
+            return selectLanes(y < 0.f, -result, result);
+        }
+
+        /**
+         * \brief Computes the sine and cosine of the element at the given index
+         * \param sines The output sines. Skipped if null
+         * \param cosines The output cosines. Skipped if null
+         */
+        inline void sinCosElement(const float* angles, float* sines, float* cosines, const size_t index)
+        {
+            const float angle = angles[index];
+            float       sine, cosine;
+
+            if (canReduceAngle(angle))
+            {
+                batchSinCos(angle, sine, cosine);
+            }
+            else
+            {
+                sine   = sinf(angle);
+                cosine = cosf(angle);
+            }
+
+            if (sines)
+                sines[index] = sine;
+
+            if (cosines)
+                cosines[index] = cosine;
+        }
+
+        /**
+         * \brief Computes the sines and/or cosines of the angles in [begin, end)
+         * \param sines The output sines. Skipped if null
+         * \param cosines The output cosines. Skipped if null
+         */
+        inline void sinCosRange(const float* angles, float* sines, float* cosines, size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            for (; begin + BatchPacket::SIZE <= end; begin += BatchPacket::SIZE)
+            {
+                const BatchPacket angle = BatchPacket::load(angles + begin);
+
+                // Large or non finite angles need the standard library's reduction
+                if (!all(abs(angle) <= MAX_REDUCED_ANGLE))
+                {
+                    for (size_t i = begin; i < begin + BatchPacket::SIZE; i++)
+                        sinCosElement(angles, sines, cosines, i);
+
+                    continue;
+                }
+
+                BatchPacket sine, cosine;
+                batchSinCos(angle, sine, cosine);
+
+                if (sines)
+                    sine.store(sines + begin);
+
+                if (cosines)
+                    cosine.store(cosines + begin);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                sinCosElement(angles, sines, cosines, begin);
+        }
+
+        /**
+         * \brief Computes the arc sine or arc cosine of the element at the given index
+         */
+        inline void asinAcosElement(const float* values, float* out, const bool isCosine, const size_t index)
+        {
+            const float value = values[index];
+
+            // Also true for NaN
+            if (!(abs(value) <= 1.f))
+                out[index] = isCosine ? acosf(value) : asinf(value);
+            else
+                out[index] = isCosine ? batchAcos(value) : batchAsin(value);
+        }
+
+        /**
+         * \brief Computes the arc sines or arc cosines of the values in [begin, end)
+         */
+        inline void asinAcosRange(const float* values, float* out, const bool isCosine, size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            for (; begin + BatchPacket::SIZE <= end; begin += BatchPacket::SIZE)
+            {
+                const BatchPacket value = BatchPacket::load(values + begin);
+
+                if (!all(abs(value) <= 1.f))
+                {
+                    for (size_t i = begin; i < begin + BatchPacket::SIZE; i++)
+                        asinAcosElement(values, out, isCosine, i);
+
+                    continue;
+                }
+
+                (isCosine ? batchAcos(value) : batchAsin(value)).store(out + begin);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                asinAcosElement(values, out, isCosine, begin);
+        }
+
+        /**
+         * \brief Computes the angle of the coordinates at the given index
+         */
+        inline void atanElement(const float* ys, const float* xs, float* out, const size_t index)
+        {
+            constexpr float maxFloat = std::numeric_limits<float>::max();
+
+            const float y = ys[index];
+            const float x = xs[index];
+
+            if (abs(x) <= maxFloat && abs(y) <= maxFloat)
+                out[index] = batchAtan(y, x);
+            else
+                out[index] = atan2f(y, x);
+        }
+
+        /**
+         * \brief Computes the angles of the coordinates in [begin, end)
+         */
+        inline void atanRange(const float* ys, const float* xs, float* out, size_t begin, const size_t end)
+        {
+#ifdef LIBMATH_SIMD_SSE
+            constexpr float maxFloat = std::numeric_limits<float>::max();
+
+            for (; begin + BatchPacket::SIZE <= end; begin += BatchPacket::SIZE)
+            {
+                const BatchPacket y = BatchPacket::load(ys + begin);
+                const BatchPacket x = BatchPacket::load(xs + begin);
+
+                // Infinite and NaN coordinates follow the standard library's rules
+                if (!all((abs(x) <= maxFloat) & (abs(y) <= maxFloat)))
+                {
+                    for (size_t i = begin; i < begin + BatchPacket::SIZE; i++)
+                        atanElement(ys, xs, out, i);
+
+                    continue;
+                }
+
+                batchAtan(y, x).store(out + begin);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; begin < end; begin++)
+                atanElement(ys, xs, out, begin);
+        }
+
+        inline const float* rawAngles(const std::span<const Radian> angles)
+        {
+            return reinterpret_cast<const float*>(angles.data());
+        }
+
+        inline float* rawAngles(const std::span<Radian> angles)
+        {
+            return reinterpret_cast<float*>(angles.data());
+        }
+
+        inline void sinCosBatch(const float* angles, float* sines, float* cosines, const size_t count, const EExecutionPolicy policy)
+        {
+            forEachRange(count, policy, [angles, sines, cosines](const size_t begin, const size_t end)
+            {
+                sinCosRange(angles, sines, cosines, begin, end);
+            });
+        }
+
+        inline void asinAcosBatch(const std::span<const float> values, const std::span<Radian> out, const bool isCosine,
+                                  const EExecutionPolicy policy)
+        {
+            assert(values.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+            forEachRange(out.size(), policy, [values = values.data(), out = rawAngles(out), isCosine](const size_t begin, const size_t end)
+            {
+                asinAcosRange(values, out, isCosine, begin, end);
+            });
+        }
+    }
+
+    inline void sin(const std::span<const float> angles, const std::span<float> out, const EExecutionPolicy policy)
+    {
+        assert(angles.size() == out.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(angles.data(), out.data(), nullptr, out.size(), policy);
+    }
+
+    inline void sin(const std::span<const Radian> angles, const std::span<float> out, const EExecutionPolicy policy)
+    {
+        assert(angles.size() == out.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(Details::rawAngles(angles), out.data(), nullptr, out.size(), policy);
+    }
+
+    inline void cos(const std::span<const float> angles, const std::span<float> out, const EExecutionPolicy policy)
+    {
+        assert(angles.size() == out.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(angles.data(), nullptr, out.data(), out.size(), policy);
+    }
+
+    inline void cos(const std::span<const Radian> angles, const std::span<float> out, const EExecutionPolicy policy)
+    {
+        assert(angles.size() == out.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(Details::rawAngles(angles), nullptr, out.data(), out.size(), policy);
+    }
+
+    inline void sinCos(const std::span<const float> angles, const std::span<float> sines, const std::span<float> cosines,
+                       const EExecutionPolicy policy)
+    {
+        assert(angles.size() == sines.size() && angles.size() == cosines.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(angles.data(), sines.data(), cosines.data(), angles.size(), policy);
+    }
+
+    inline void sinCos(const std::span<const Radian> angles, const std::span<float> sines, const std::span<float> cosines,
+                       const EExecutionPolicy policy)
+    {
+        assert(angles.size() == sines.size() && angles.size() == cosines.size() && "Invalid batch - source and output sizes differ");
+        Details::sinCosBatch(Details::rawAngles(angles), sines.data(), cosines.data(), angles.size(), policy);
+    }
+
+    inline void asin(const std::span<const float> values, const std::span<Radian> out, const EExecutionPolicy policy)
+    {
+        Details::asinAcosBatch(values, out, false, policy);
+    }
+
+    inline void acos(const std::span<const float> values, const std::span<Radian> out, const EExecutionPolicy policy)
+    {
+        Details::asinAcosBatch(values, out, true, policy);
+    }
+
+    inline void atan(const std::span<const float> ys, const std::span<const float> xs, const std::span<Radian> out,
+                     const EExecutionPolicy policy)
+    {
+        assert(ys.size() == xs.size() && ys.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::forEachRange(out.size(), policy, [ys = ys.data(), xs = xs.data(), out = Details::rawAngles(out)](const size_t begin, const size_t end)
+        {
+            Details::atanRange(ys, xs, out, begin, end);
+        });
+    }
+}
+
+#endif // !__LIBMATH__TRIGONOMETRYBATCH_INL__
@@ -0,0 +1,194 @@
+#ifndef __LIBMATH__VECTOR__PACKEDVECTOR_H__
+#define __LIBMATH__VECTOR__PACKEDVECTOR_H__
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "Vector/Vector3.h"
+#include "Vector/Vector4.h"
+
+namespace LibMath
+{
+    /**
+     * \brief Converts a float to the closest half precision float (IEEE 754 binary16, rounded to nearest even)
+     * \param value The value to convert
+     * \return The half precision float's bits
+     * \note Magnitudes of 65520 and above become infinities and magnitudes below 2^-25 become zeros
+     */
+    inline uint16_t floatToHalf(float value);
+
+    /**
+     * \brief Converts a half precision float to a float. The conversion is exact
+     * \param half The half precision float's bits
+     * \return The converted value
+     */
+    inline float halfToFloat(uint16_t half);
+
+    /**
+     * \brief Vector stored as half precision floats - halves the memory footprint of a float vector
+     * \tparam Size The vector's number of components (3 or 4)
+     * \note Relative error of at most 2^-11 (~4.9e-4) for magnitudes in [2^-14, 65504] and absolute error of at most
+     * 2^-25 (~3e-8) below. Larger magnitudes are stored as infinities
+     */
+    template <size_t Size>
+    class THalfVector
+    {
+        static_assert(Size == 3 || Size == 4, "Invalid half vector - should have 3 or 4 components");
+
+    public:
+        using vector_type = std::conditional_t<Size == 3, Vector3, Vector4>;
+
+        /**
+         * \brief Creates a zero vector
+         */
+        THalfVector() = default;
+
+        /**
+         * \brief Creates a half precision copy of the given vector
+         * \param vector The vector to pack
+         */
+        explicit THalfVector(const vector_type& vector);
+
+        /**
+         * \brief Converts the vector back to single precision
+         * \return The unpacked vector
+         */
+        vector_type unpack() const;
+
+        /**
+         * \brief Packs the given vectors
+         * \param vectors The vectors to pack
+         * \param out The packed vectors. Should have the same size as the source vectors
+         */
+        static void pack(std::span<const vector_type> vectors, std::span<THalfVector> out);
+
+        /**
+         * \brief Unpacks the given vectors
+         * \param packed The vectors to unpack
+         * \param out The unpacked vectors. Should have the same size as the packed vectors
+         */
+        static void unpack(std::span<const THalfVector> packed, std::span<vector_type> out);
+
+        uint16_t m_values[Size] = {};
+    };
+
+    /**
+     * \brief Vector stored as fixed point integers - the integer type's range maps to [-1, 1] for signed types (snorm)
+     * or [0, 1] for unsigned types (unorm)
+     * \tparam IntT The components' integer type (8 or 16 bits)
+     * \tparam Size The vector's number of components (3 or 4)
+     * \note Components are clamped to the range then rounded to the nearest step - an absolute error of at most
+     * 1 / (2 * max(IntT)) : ~3.9e-3 for snorm8, ~2e-3 for unorm8, ~1.5e-5 for snorm16 and ~7.6e-6 for unorm16.
+     * The range's bounds and 0 are stored exactly. NaNs are stored as 1
+     */
+    template <class IntT, size_t Size>
+    class TNormalizedVector
+    {
+        static_assert(std::is_integral_v<IntT> && sizeof(IntT) <= 2, "Invalid normalized vector - should store 8 or 16 bits integers");
+        static_assert(Size == 3 || Size == 4, "Invalid normalized vector - should have 3 or 4 components");
+
+    public:
+        using vector_type = std::conditional_t<Size == 3, Vector3, Vector4>;
+
+        /**
+         * \brief Creates a zero vector
+         */
+        TNormalizedVector() = default;
+
+        /**
+         * \brief Creates a fixed point copy of the given vector
+         * \param vector The vector to pack
+         */
+        explicit TNormalizedVector(const vector_type& vector);
+
+        /**
+         * \brief Converts the vector back to floating point
+         * \return The unpacked vector
+         */
+        vector_type unpack() const;
+
+        /**
+         * \brief Packs the given vectors
+         * \param vectors The vectors to pack
+         * \param out The packed vectors. Should have the same size as the source vectors
+         */
+        static void pack(std::span<const vector_type> vectors, std::span<TNormalizedVector> out);
+
+        /**
+         * \brief Unpacks the given vectors
+         * \param packed The vectors to unpack
+         * \param out The unpacked vectors. Should have the same size as the packed vectors
+         */
+        static void unpack(std::span<const TNormalizedVector> packed, std::span<vector_type> out);
+
+        IntT m_values[Size] = {};
+    };
+
+    /**
+     * \brief Unit 3D vector stored in 32 bits - the vector is projected onto an octahedron whose lower half is folded onto
+     * the upper one, and the resulting 2D coordinates are stored as 2 snorm16
+     * \note Unpacked vectors are unit vectors, with an angular error of at most 7e-5 radians (~0.004 degrees).
+     * Packed vectors don't need to be normalized but shouldn't be zero vectors
+     */
+    class Vector3Octahedral
+    {
+    public:
+        using vector_type = Vector3;
+
+        /**
+         * \brief Creates a packed forward (0, 0, 1) vector
+         */
+        Vector3Octahedral() = default;
+
+        /**
+         * \brief Creates an octahedral copy of the given vector's direction
+         * \param vector The vector to pack
+         */
+        explicit Vector3Octahedral(const Vector3& vector);
+
+        /**
+         * \brief Converts the vector back to a unit Vector3
+         * \return The unpacked unit vector
+         */
+        Vector3 unpack() const;
+
+        /**
+         * \brief Packs the given vectors
+         * \param vectors The vectors to pack
+         * \param out The packed vectors. Should have the same size as the source vectors
+         */
+        static void pack(std::span<const Vector3> vectors, std::span<Vector3Octahedral> out);
+
+        /**
+         * \brief Unpacks the given vectors
+         * \param packed The vectors to unpack
+         * \param out The unpacked vectors. Should have the same size as the packed vectors
+         */
+        static void unpack(std::span<const Vector3Octahedral> packed, std::span<Vector3> out);
+
+        int16_t m_x = 0;
+        int16_t m_y = 0;
+    };
+
+    using Vector3Half = THalfVector<3>;
+    using Vector4Half = THalfVector<4>;
+
+    using Vector3Snorm8 = TNormalizedVector<int8_t, 3>;
+    using Vector4Snorm8 = TNormalizedVector<int8_t, 4>;
+
+    using Vector3Snorm16 = TNormalizedVector<int16_t, 3>;
+    using Vector4Snorm16 = TNormalizedVector<int16_t, 4>;
+
+    using Vector3Unorm16 = TNormalizedVector<uint16_t, 3>;
+    using Vector4Unorm16 = TNormalizedVector<uint16_t, 4>;
+
+    static_assert(sizeof(Vector3Half) == 6 && sizeof(Vector4Half) == 8, "Invalid half vector - should be tightly packed");
+    static_assert(sizeof(Vector3Snorm8) == 3 && sizeof(Vector4Snorm8) == 4, "Invalid snorm8 vector - should be tightly packed");
+    static_assert(sizeof(Vector3Snorm16) == 6 && sizeof(Vector4Unorm16) == 8, "Invalid 16 bits vector - should be tightly packed");
+    static_assert(sizeof(Vector3Octahedral) == 4, "Invalid octahedral vector - should be 32 bits");
+}
+
+#include "Vector/PackedVector.inl"
+
+#endif // !__LIBMATH__VECTOR__PACKEDVECTOR_H__
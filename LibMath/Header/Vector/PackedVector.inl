@@ -0,0 +1,465 @@
+#ifndef __LIBMATH__VECTOR__PACKEDVECTOR_INL__
+#define __LIBMATH__VECTOR__PACKEDVECTOR_INL__
+
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "Simd.h"
+#include "Vector/PackedVector.h"
+
+namespace LibMath
+{
+    // adapted from https://gist.github.com/rygorous/2156668 (float_to_half_fast3_rtne)
+    inline uint16_t floatToHalf(const float value)
+    {
+        constexpr uint32_t infinityBits    = 255u << 23;
+        constexpr uint32_t halfOverflow    = (127u + 16u) << 23; // 2^16 - rounds to infinity from 65520 up
+        constexpr uint32_t halfNormalMin   = 113u << 23;         // 2^-14
+        constexpr uint32_t subnormalMagic  = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t       bits = std::bit_cast<uint32_t>(value);
+        const uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint32_t half;
+
+        if (bits >= halfOverflow)
+        {
+            half = bits > infinityBits ? 0x7E00u : 0x7C00u; // NaN (quiet) or infinity
+        }
+        else if (bits < halfNormalMin)
+        {
+            // Let the float addition round the mantissa into the subnormal half's bits
+            const float rounded = std::bit_cast<float>(bits) + std::bit_cast<float>(subnormalMagic);
+            half                = std::bit_cast<uint32_t>(rounded) - subnormalMagic;
+        }
+        else
+        {
+            // Rebias the exponent and round the mantissa to nearest even
+            const uint32_t isMantissaOdd = (bits >> 13) & 1u;
+            bits += ((15u - 127u) << 23) + 0xFFFu + isMantissaOdd;
+            half = bits >> 13;
+        }
+
+        return static_cast<uint16_t>(half | sign >> 16);
+    }
+
+    // adapted from https://gist.github.com/rygorous/2144712 (half_to_float)
+    inline float halfToFloat(const uint16_t half)
+    {
+        constexpr uint32_t exponentMask   = 0x7C00u << 13;
+        constexpr uint32_t subnormalMagic = 113u << 23;
+
+        uint32_t       bits     = (half & 0x7FFFu) << 13;
+        const uint32_t exponent = bits & exponentMask;
+        bits += (127u - 15u) << 23;
+
+        if (exponent == exponentMask)
+        {
+            bits += (128u - 16u) << 23; // infinity or NaN
+        }
+        else if (exponent == 0)
+        {
+            // Zero or subnormal - renormalize
+            bits += 1u << 23;
+            bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(subnormalMagic));
+        }
+
+        return std::bit_cast<float>(bits | static_cast<uint32_t>(half & 0x8000u) << 16);
+    }
+
+    namespace Details
+    {
+        /**
+         * \brief Converts count floats to half precision floats
+         */
+        inline void floatsToHalves(const float* values, uint16_t* out, const size_t count)
+        {
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_F16C
+            for (; index + 8 <= count; index += 8)
+            {
+                const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(values + index), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), halves);
+            }
+#endif // LIBMATH_SIMD_F16C
+
+            for (; index < count; index++)
+                out[index] = floatToHalf(values[index]);
+        }
+
+        /**
+         * \brief Converts count half precision floats to floats
+         */
+        inline void halvesToFloats(const uint16_t* values, float* out, const size_t count)
+        {
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_F16C
+            for (; index + 8 <= count; index += 8)
+            {
+                const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+                _mm256_storeu_ps(out + index, _mm256_cvtph_ps(halves));
+            }
+#endif // LIBMATH_SIMD_F16C
+
+            for (; index < count; index++)
+                out[index] = halfToFloat(values[index]);
+        }
+
+        template <class IntT>
+        constexpr float NORMALIZED_SCALE = static_cast<float>(std::numeric_limits<IntT>::max());
+
+        template <class IntT>
+        constexpr float NORMALIZED_MIN = std::is_signed_v<IntT> ? -1.f : 0.f;
+
+        template <class IntT>
+        IntT encodeNormalized(const float value)
+        {
+            // lrint rounds to nearest even like the SIMD conversion
+            return static_cast<IntT>(std::lrint(clamp(value, NORMALIZED_MIN<IntT>, 1.f) * NORMALIZED_SCALE<IntT>));
+        }
+
+        template <class IntT>
+        float decodeNormalized(const IntT value)
+        {
+            // Signed types have one more negative value than positive ones, which also maps to -1
+            return max(static_cast<float>(value) / NORMALIZED_SCALE<IntT>, NORMALIZED_MIN<IntT>);
+        }
+
+#ifdef LIBMATH_SIMD_SSE2
+        /**
+         * \brief Clamps, scales and rounds 8 floats then converts them to IntT, saturated to its range
+         * \return The converted values, in the low 8 (8 bits integers) or 16 bytes (16 bits integers)
+         */
+        template <class IntT>
+        __m128i encodeNormalized8(__m128 low, __m128 high)
+        {
+            const __m128 minValue = _mm_set1_ps(NORMALIZED_MIN<IntT>);
+            const __m128 one      = _mm_set1_ps(1.f);
+            const __m128 scale    = _mm_set1_ps(NORMALIZED_SCALE<IntT>);
+
+            // min returns its second operand for NaNs, like the scalar clamp
+            low  = _mm_mul_ps(_mm_max_ps(_mm_min_ps(low, one), minValue), scale);
+            high = _mm_mul_ps(_mm_max_ps(_mm_min_ps(high, one), minValue), scale);
+
+            const __m128i lowInts  = _mm_cvtps_epi32(low);
+            const __m128i highInts = _mm_cvtps_epi32(high);
+
+            if constexpr (std::is_same_v<IntT, uint16_t>)
+            {
+                // No unsigned saturating pack before SSE4.1 - offset to the signed range and back
+                const __m128i offset = _mm_set1_epi32(32768);
+                const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(lowInts, offset), _mm_sub_epi32(highInts, offset));
+                return _mm_xor_si128(packed, _mm_set1_epi16(static_cast<short>(0x8000)));
+            }
+            else
+            {
+                const __m128i packed = _mm_packs_epi32(lowInts, highInts);
+
+                if constexpr (std::is_same_v<IntT, int8_t>)
+                    return _mm_packs_epi16(packed, packed);
+                else if constexpr (std::is_same_v<IntT, uint8_t>)
+                    return _mm_packus_epi16(packed, packed);
+                else
+                    return packed;
+            }
+        }
+
+        /**
+         * \brief Loads 8 IntT values and converts them back to floats
+         */
+        template <class IntT>
+        void decodeNormalized8(const IntT* values, __m128& low, __m128& high)
+        {
+            __m128i ints16;
+
+            if constexpr (sizeof(IntT) == 1)
+            {
+                const __m128i ints8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+
+                if constexpr (std::is_signed_v<IntT>)
+                    ints16 = _mm_srai_epi16(_mm_unpacklo_epi8(ints8, ints8), 8);
+                else
+                    ints16 = _mm_unpacklo_epi8(ints8, _mm_setzero_si128());
+            }
+            else
+            {
+                ints16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+            }
+
+            __m128i lowInts, highInts;
+
+            if constexpr (std::is_signed_v<IntT>)
+            {
+                lowInts  = _mm_srai_epi32(_mm_unpacklo_epi16(ints16, ints16), 16);
+                highInts = _mm_srai_epi32(_mm_unpackhi_epi16(ints16, ints16), 16);
+            }
+            else
+            {
+                lowInts  = _mm_unpacklo_epi16(ints16, _mm_setzero_si128());
+                highInts = _mm_unpackhi_epi16(ints16, _mm_setzero_si128());
+            }
+
+            const __m128 minValue = _mm_set1_ps(NORMALIZED_MIN<IntT>);
+            const __m128 scale    = _mm_set1_ps(NORMALIZED_SCALE<IntT>);
+
+            low  = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(lowInts), scale), minValue);
+            high = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(highInts), scale), minValue);
+        }
+#endif // LIBMATH_SIMD_SSE2
+
+        /**
+         * \brief Converts count floats to normalized integers
+         */
+        template <class IntT>
+        void floatsToNormalized(const float* values, IntT* out, const size_t count)
+        {
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE2
+            for (; index + 8 <= count; index += 8)
+            {
+                const __m128i packed = encodeNormalized8<IntT>(_mm_loadu_ps(values + index), _mm_loadu_ps(values + index + 4));
+
+                if constexpr (sizeof(IntT) == 1)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + index), packed);
+                else
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), packed);
+            }
+#endif // LIBMATH_SIMD_SSE2
+
+            for (; index < count; index++)
+                out[index] = encodeNormalized<IntT>(values[index]);
+        }
+
+        /**
+         * \brief Converts count normalized integers to floats
+         */
+        template <class IntT>
+        void normalizedToFloats(const IntT* values, float* out, const size_t count)
+        {
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE2
+            for (; index + 8 <= count; index += 8)
+            {
+                __m128 low, high;
+                decodeNormalized8(values + index, low, high);
+
+                _mm_storeu_ps(out + index, low);
+                _mm_storeu_ps(out + index + 4, high);
+            }
+#endif // LIBMATH_SIMD_SSE2
+
+            for (; index < count; index++)
+                out[index] = decodeNormalized(values[index]);
+        }
+    }
+
+    template <size_t Size>
+    THalfVector<Size>::THalfVector(const vector_type& vector)
+    {
+        Details::floatsToHalves(&vector.m_x, m_values, Size);
+    }
+
+    template <size_t Size>
+    typename THalfVector<Size>::vector_type THalfVector<Size>::unpack() const
+    {
+        vector_type vector;
+        Details::halvesToFloats(m_values, &vector.m_x, Size);
+        return vector;
+    }
+
+    template <size_t Size>
+    void THalfVector<Size>::pack(const std::span<const vector_type> vectors, const std::span<THalfVector> out)
+    {
+        static_assert(sizeof(vector_type) == Size * sizeof(float), "Invalid vector - should be tightly packed");
+        assert(vectors.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::floatsToHalves(reinterpret_cast<const float*>(vectors.data()), reinterpret_cast<uint16_t*>(out.data()),
+                                out.size() * Size);
+    }
+
+    template <size_t Size>
+    void THalfVector<Size>::unpack(const std::span<const THalfVector> packed, const std::span<vector_type> out)
+    {
+        static_assert(sizeof(vector_type) == Size * sizeof(float), "Invalid vector - should be tightly packed");
+        assert(packed.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::halvesToFloats(reinterpret_cast<const uint16_t*>(packed.data()), reinterpret_cast<float*>(out.data()),
+                                out.size() * Size);
+    }
+
+    template <class IntT, size_t Size>
+    TNormalizedVector<IntT, Size>::TNormalizedVector(const vector_type& vector)
+    {
+        const float* values = &vector.m_x;
+
+        for (size_t i = 0; i < Size; i++)
+            m_values[i] = Details::encodeNormalized<IntT>(values[i]);
+    }
+
+    template <class IntT, size_t Size>
+    typename TNormalizedVector<IntT, Size>::vector_type TNormalizedVector<IntT, Size>::unpack() const
+    {
+        vector_type vector;
+        float*      values = &vector.m_x;
+
+        for (size_t i = 0; i < Size; i++)
+            values[i] = Details::decodeNormalized(m_values[i]);
+
+        return vector;
+    }
+
+    template <class IntT, size_t Size>
+    void TNormalizedVector<IntT, Size>::pack(const std::span<const vector_type> vectors, const std::span<TNormalizedVector> out)
+    {
+        static_assert(sizeof(vector_type) == Size * sizeof(float), "Invalid vector - should be tightly packed");
+        assert(vectors.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::floatsToNormalized(reinterpret_cast<const float*>(vectors.data()), reinterpret_cast<IntT*>(out.data()),
+                                    out.size() * Size);
+    }
+
+    template <class IntT, size_t Size>
+    void TNormalizedVector<IntT, Size>::unpack(const std::span<const TNormalizedVector> packed, const std::span<vector_type> out)
+    {
+        static_assert(sizeof(vector_type) == Size * sizeof(float), "Invalid vector - should be tightly packed");
+        assert(packed.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        Details::normalizedToFloats(reinterpret_cast<const IntT*>(packed.data()), reinterpret_cast<float*>(out.data()),
+                                    out.size() * Size);
+    }
+
+    // cf. "A Survey of Efficient Representations for Independent Unit Vectors" (Cigolle et al. 2014)
+    inline Vector3Octahedral::Vector3Octahedral(const Vector3& vector)
+    {
+        // Project onto the octahedron |x| + |y| + |z| = 1 then fold the lower half over the upper one
+        const float l1Norm = abs(vector.m_x) + abs(vector.m_y) + abs(vector.m_z);
+
+        float x = vector.m_x / l1Norm;
+        float y = vector.m_y / l1Norm;
+
+        if (vector.m_z < 0.f)
+        {
+            const float foldedX = (1.f - abs(y)) * sign(x);
+            y                   = (1.f - abs(x)) * sign(y);
+            x                   = foldedX;
+        }
+
+        m_x = Details::encodeNormalized<int16_t>(x);
+        m_y = Details::encodeNormalized<int16_t>(y);
+    }
+
+    inline Vector3 Vector3Octahedral::unpack() const
+    {
+        float       x = Details::decodeNormalized(m_x);
+        float       y = Details::decodeNormalized(m_y);
+        const float z = 1.f - abs(x) - abs(y);
+
+        // Unfold the lower half - branchless form of x = (1 - |y|) * sign(x) for z < 0
+        const float fold = max(-z, 0.f);
+        x += x >= 0.f ? -fold : fold;
+        y += y >= 0.f ? -fold : fold;
+
+        return Vector3(x, y, z).normalized();
+    }
+
+    inline void Vector3Octahedral::pack(const std::span<const Vector3> vectors, const std::span<Vector3Octahedral> out)
+    {
+        assert(vectors.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE2
+        static_assert(sizeof(Vector3) == 3 * sizeof(float), "Invalid Vector3 - should be tightly packed");
+
+        // Same operations as the constructor, on 4 vectors at once in SoA form
+        const __m128 absMask  = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 zero     = _mm_setzero_ps();
+        const __m128 one      = _mm_set1_ps(1.f);
+        const __m128 minusOne = _mm_set1_ps(-1.f);
+
+        const auto signOf = [zero, one, minusOne](const __m128 values)
+        {
+            const __m128 isNegative = _mm_cmplt_ps(values, zero);
+            return _mm_or_ps(_mm_and_ps(isNegative, minusOne), _mm_andnot_ps(isNegative, one));
+        };
+
+        for (; index + 4 <= out.size(); index += 4)
+        {
+            __m128 xs, ys, zs;
+            Details::loadDeinterleaved3(&vectors[index].m_x, xs, ys, zs);
+
+            const __m128 l1Norm = _mm_add_ps(_mm_add_ps(_mm_and_ps(xs, absMask), _mm_and_ps(ys, absMask)), _mm_and_ps(zs, absMask));
+
+            xs = _mm_div_ps(xs, l1Norm);
+            ys = _mm_div_ps(ys, l1Norm);
+
+            const __m128 foldedX    = _mm_mul_ps(_mm_sub_ps(one, _mm_and_ps(ys, absMask)), signOf(xs));
+            const __m128 foldedY    = _mm_mul_ps(_mm_sub_ps(one, _mm_and_ps(xs, absMask)), signOf(ys));
+            const __m128 isLowerHalf = _mm_cmplt_ps(zs, zero);
+
+            xs = _mm_or_ps(_mm_and_ps(isLowerHalf, foldedX), _mm_andnot_ps(isLowerHalf, xs));
+            ys = _mm_or_ps(_mm_and_ps(isLowerHalf, foldedY), _mm_andnot_ps(isLowerHalf, ys));
+
+            // x0 y0 x1 y1 | x2 y2 x3 y3
+            const __m128i packed = Details::encodeNormalized8<int16_t>(_mm_unpacklo_ps(xs, ys), _mm_unpackhi_ps(xs, ys));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[index].m_x), packed);
+        }
+#endif // LIBMATH_SIMD_SSE2
+
+        for (; index < out.size(); index++)
+            out[index] = Vector3Octahedral(vectors[index]);
+    }
+
+    inline void Vector3Octahedral::unpack(const std::span<const Vector3Octahedral> packed, const std::span<Vector3> out)
+    {
+        assert(packed.size() == out.size() && "Invalid batch - source and output sizes differ");
+
+        size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE2
+        static_assert(sizeof(Vector3) == 3 * sizeof(float), "Invalid Vector3 - should be tightly packed");
+
+        // Same operations as unpack(), on 4 vectors at once in SoA form
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 zero    = _mm_setzero_ps();
+        const __m128 one     = _mm_set1_ps(1.f);
+
+        for (; index + 4 <= out.size(); index += 4)
+        {
+            // x0 y0 x1 y1 | x2 y2 x3 y3
+            __m128 low, high;
+            Details::decodeNormalized8(&packed[index].m_x, low, high);
+
+            __m128       xs = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128       ys = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 zs = _mm_sub_ps(_mm_sub_ps(one, _mm_and_ps(xs, absMask)), _mm_and_ps(ys, absMask));
+
+            const __m128 fold = _mm_max_ps(_mm_sub_ps(zero, zs), zero);
+
+            const __m128 isXPositive = _mm_cmpge_ps(xs, zero);
+            const __m128 isYPositive = _mm_cmpge_ps(ys, zero);
+            const __m128 negatedFold = _mm_sub_ps(zero, fold);
+
+            xs = _mm_add_ps(xs, _mm_or_ps(_mm_and_ps(isXPositive, negatedFold), _mm_andnot_ps(isXPositive, fold)));
+            ys = _mm_add_ps(ys, _mm_or_ps(_mm_and_ps(isYPositive, negatedFold), _mm_andnot_ps(isYPositive, fold)));
+
+            const __m128 magnitudeSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys)), _mm_mul_ps(zs, zs));
+            const __m128 scale            = Details::packInverseSqrt(magnitudeSquared, EPrecision::BALANCED);
+
+            Details::storeInterleaved3(&out[index].m_x, _mm_mul_ps(xs, scale), _mm_mul_ps(ys, scale), _mm_mul_ps(zs, scale));
+        }
+#endif // LIBMATH_SIMD_SSE2
+
+        for (; index < out.size(); index++)
+            out[index] = packed[index].unpack();
+    }
+}
+
+#endif // !__LIBMATH__VECTOR__PACKEDVECTOR_INL__
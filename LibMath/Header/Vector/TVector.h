@@ -0,0 +1,536 @@
+#ifndef __LIBMATH__VECTOR__TVECTOR_H__
+#define __LIBMATH__VECTOR__TVECTOR_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Arithmetic.h"
+#include "Hash.h"
+#include "Simd.h"
+
+/*
+ * Size-generic core of TVector2, TVector3 and TVector4. The vector classes keep their named m_x, m_y, m_z and m_w
+ * members and forward their component-wise operations to the functions below, which are unrolled at compile time for
+ * the vector's size. Operations written here (including their SIMD versions) apply to the three sizes at once.
+ */
+
+namespace LibMath
+{
+    template <class T>
+    class TVector2;
+
+    template <class T>
+    class TVector3;
+
+    template <class T>
+    class TVector4;
+
+    namespace Details
+    {
+        template <size_t Size, class T>
+        struct VectorType;
+
+        template <class T>
+        struct VectorType<2, T>
+        {
+            using type = TVector2<T>;
+        };
+
+        template <class T>
+        struct VectorType<3, T>
+        {
+            using type = TVector3<T>;
+        };
+
+        template <class T>
+        struct VectorType<4, T>
+        {
+            using type = TVector4<T>;
+        };
+
+        /**
+         * \brief Gives the value type and number of components of the vector classes. Empty for any other type
+         */
+        template <class T>
+        struct VectorTraits
+        {
+        };
+
+        template <class T>
+        struct VectorTraits<TVector2<T>>
+        {
+            using value_type = T;
+            static constexpr size_t size = 2;
+        };
+
+        template <class T>
+        struct VectorTraits<TVector3<T>>
+        {
+            using value_type = T;
+            static constexpr size_t size = 3;
+        };
+
+        template <class T>
+        struct VectorTraits<TVector4<T>>
+        {
+            using value_type = T;
+            static constexpr size_t size = 4;
+        };
+    }
+
+    /**
+     * \brief The vector class with the given number of components - e.g. TVector<3, float> is TVector3<float>
+     * \tparam Size The vector's number of components (2, 3 or 4)
+     * \tparam T The vector's data type
+     */
+    template <size_t Size, class T>
+    using TVector = typename Details::VectorType<Size, T>::type;
+
+    namespace Details
+    {
+        template <class VectorT>
+        constexpr size_t VECTOR_SIZE = VectorTraits<std::remove_cvref_t<VectorT>>::size;
+
+        template <class VectorT>
+        using vector_value_t = typename VectorTraits<std::remove_cvref_t<VectorT>>::value_type;
+
+        // Whether the given vectors map onto a single SSE register
+        template <class VectorT, class OtherT = VectorT>
+        constexpr bool IS_SIMD_VECTOR = VECTOR_SIZE<VectorT> == 4 && std::is_same_v<vector_value_t<VectorT>, float>
+            && std::is_same_v<vector_value_t<OtherT>, float>;
+
+        /**
+         * \brief Gets the vector's component at the given index (0 for m_x, 1 for m_y...)
+         */
+        template <size_t Index, class VectorT>
+        constexpr auto& component(VectorT& vector)
+        {
+            static_assert(Index < VECTOR_SIZE<VectorT>, "Invalid component index");
+
+            if constexpr (Index == 0)
+                return vector.m_x;
+            else if constexpr (Index == 1)
+                return vector.m_y;
+            else if constexpr (Index == 2)
+                return vector.m_z;
+            else
+                return vector.m_w;
+        }
+
+        template <class Func, size_t... Indices>
+        constexpr void unrollComponents(Func&& func, std::index_sequence<Indices...>)
+        {
+            (func(std::integral_constant<size_t, Indices>()), ...);
+        }
+
+        /**
+         * \brief Calls func(std::integral_constant<size_t, Index>) for each of the vector's component indices
+         */
+        template <class VectorT, class Func>
+        constexpr void forEachComponent(Func&& func)
+        {
+            unrollComponents(std::forward<Func>(func), std::make_index_sequence<VECTOR_SIZE<VectorT>>());
+        }
+
+        template <class VectorT, class Func, size_t... Indices>
+        constexpr auto sumComponents(Func&& func, std::index_sequence<Indices...>)
+        {
+            // Left fold - the terms are summed in the same order as x + y + z + w
+            return (... + func(std::integral_constant<size_t, Indices>()));
+        }
+
+        /**
+         * \brief Sums func(std::integral_constant<size_t, Index>) over the vector's component indices
+         */
+        template <class VectorT, class Func>
+        constexpr auto sumComponents(Func&& func)
+        {
+            return sumComponents<VectorT>(std::forward<Func>(func), std::make_index_sequence<VECTOR_SIZE<VectorT>>());
+        }
+
+        /**
+         * \brief Builds a vector from func(components...) applied to the given vectors' components
+         */
+        template <class VectorT, class Func, class... Vectors>
+        constexpr VectorT mapComponents(Func&& func, const Vectors&... vectors)
+        {
+            VectorT out;
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(out) = func(component<index>(vectors)...);
+            });
+
+            return out;
+        }
+
+        /**
+         * \brief Checks whether func(components...) is true for all the given vectors' components
+         */
+        template <class VectorT, class Func, class... Vectors>
+        constexpr bool allComponents(Func&& func, const Vectors&... vectors)
+        {
+            bool result = true;
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                result = result && func(component<index>(vectors)...);
+            });
+
+            return result;
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr void assignComponents(VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) = static_cast<T>(component<index>(other));
+            });
+        }
+
+        template <class VectorT>
+        constexpr void copyComponents(const VectorT& vector, vector_value_t<VectorT>* out)
+        {
+            forEachComponent<VectorT>([&](auto index)
+            {
+                out[index] = component<index>(vector);
+            });
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr void addComponents(VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_add_ps(_mm_load_ps(&vector.m_x), _mm_load_ps(&other.m_x)));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) += static_cast<T>(component<index>(other));
+            });
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr void subtractComponents(VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_sub_ps(_mm_load_ps(&vector.m_x), _mm_load_ps(&other.m_x)));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) -= static_cast<T>(component<index>(other));
+            });
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr void multiplyComponents(VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_mul_ps(_mm_load_ps(&vector.m_x), _mm_load_ps(&other.m_x)));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) = static_cast<T>(component<index>(vector) * component<index>(other));
+            });
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr void divideComponents(VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_div_ps(_mm_load_ps(&vector.m_x), _mm_load_ps(&other.m_x)));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) = static_cast<T>(component<index>(vector) / component<index>(other));
+            });
+        }
+
+        template <class VectorT, class U>
+        constexpr void addScalar(VectorT& vector, const U value)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_add_ps(_mm_load_ps(&vector.m_x), _mm_set1_ps(static_cast<T>(value))));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) += static_cast<T>(value);
+            });
+        }
+
+        template <class VectorT, class U>
+        constexpr void subtractScalar(VectorT& vector, const U value)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_sub_ps(_mm_load_ps(&vector.m_x), _mm_set1_ps(static_cast<T>(value))));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) -= static_cast<T>(value);
+            });
+        }
+
+        template <class VectorT, class U>
+        constexpr void multiplyScalar(VectorT& vector, const U value)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            // The scalar versions multiply in the common type - only use SSE when it is float
+            if constexpr (IS_SIMD_VECTOR<VectorT> && std::is_same_v<std::common_type_t<T, U>, float>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_mul_ps(_mm_load_ps(&vector.m_x), _mm_set1_ps(static_cast<T>(value))));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) = static_cast<T>(component<index>(vector) * value);
+            });
+        }
+
+        template <class VectorT, class U>
+        constexpr void divideScalar(VectorT& vector, const U value)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT> && std::is_same_v<std::common_type_t<T, U>, float>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    _mm_store_ps(&vector.m_x, _mm_div_ps(_mm_load_ps(&vector.m_x), _mm_set1_ps(static_cast<T>(value))));
+                    return;
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(vector) = static_cast<T>(component<index>(vector) / value);
+            });
+        }
+
+        template <class VectorT>
+        constexpr VectorT negateComponents(const VectorT& vector)
+        {
+            VectorT out;
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                component<index>(out) = -component<index>(vector);
+            });
+
+            return out;
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr vector_value_t<VectorT> dotComponents(const VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                    return dot4(_mm_load_ps(&vector.m_x), _mm_load_ps(&other.m_x));
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            return static_cast<T>(sumComponents<VectorT>([&](auto index)
+            {
+                return component<index>(vector) * component<index>(other);
+            }));
+        }
+
+        template <class VectorT>
+        constexpr vector_value_t<VectorT> magnitudeSquaredComponents(const VectorT& vector)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const __m128 values = _mm_load_ps(&vector.m_x);
+                    return dot4(values, values);
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            return static_cast<T>(sumComponents<VectorT>([&](auto index)
+            {
+                return component<index>(vector) * component<index>(vector);
+            }));
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr vector_value_t<VectorT> distanceSquaredComponents(const VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+#ifdef LIBMATH_SIMD_SSE
+            if constexpr (IS_SIMD_VECTOR<VectorT, OtherT>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const __m128 distance = _mm_sub_ps(_mm_load_ps(&other.m_x), _mm_load_ps(&vector.m_x));
+                    return dot4(distance, distance);
+                }
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            return static_cast<T>(sumComponents<VectorT>([&](auto index)
+            {
+                const T distance = static_cast<T>(component<index>(other) - component<index>(vector));
+                return distance * distance;
+            }));
+        }
+
+        template <class VectorT, class OtherT>
+        constexpr bool componentsEqual(const VectorT& vector, const OtherT& other)
+        {
+            using T = vector_value_t<VectorT>;
+
+            return allComponents<VectorT>([](const T left, const auto right)
+            {
+                return floatEquals(left, static_cast<T>(right));
+            }, vector, other);
+        }
+
+        template <class VectorT>
+        constexpr uint64_t hashComponents(const VectorT& vector)
+        {
+            uint64_t seed = 0;
+
+            forEachComponent<VectorT>([&](auto index)
+            {
+                seed = hashCombine(seed, component<index>(vector));
+            });
+
+            return seed;
+        }
+    }
+}
+
+/**
+ * \brief Defines the given vector alias along with its component-wise clamp, snap, isInRange, min and max specializations
+ */
+#define VECTOR_ALIAS_IMPL(Size, DataType, Alias)                                                                \
+    using Alias = TVector<Size, DataType>;                                                                      \
+                                                                                                                \
+    template <>                                                                                                 \
+    inline Alias clamp<Alias>(const Alias value, const Alias a, const Alias b)                                  \
+    {                                                                                                           \
+        return Details::mapComponents<Alias>([](const DataType x, const DataType low, const DataType high)      \
+        {                                                                                                       \
+            return clamp(x, low, high);                                                                         \
+        }, value, a, b);                                                                                        \
+    }                                                                                                           \
+                                                                                                                \
+    template <>                                                                                                 \
+    inline Alias snap<Alias>(const Alias value, const Alias a, const Alias b)                                   \
+    {                                                                                                           \
+        return Details::mapComponents<Alias>([](const DataType x, const DataType low, const DataType high)      \
+        {                                                                                                       \
+            return snap(x, low, high);                                                                          \
+        }, value, a, b);                                                                                        \
+    }                                                                                                           \
+                                                                                                                \
+    template <>                                                                                                 \
+    constexpr bool isInRange<Alias>(const Alias value, const Alias a, const Alias b)                            \
+    {                                                                                                           \
+        return Details::allComponents<Alias>([](const DataType x, const DataType low, const DataType high)      \
+        {                                                                                                       \
+            return isInRange(x, low, high);                                                                     \
+        }, value, a, b);                                                                                        \
+    }                                                                                                           \
+                                                                                                                \
+    template <>                                                                                                 \
+    inline Alias min<Alias>(const Alias a, const Alias b)                                                       \
+    {                                                                                                           \
+        return Details::mapComponents<Alias>([](const DataType left, const DataType right)                      \
+        {                                                                                                       \
+            return min(left, right);                                                                            \
+        }, a, b);                                                                                               \
+    }                                                                                                           \
+                                                                                                                \
+    template <>                                                                                                 \
+    inline Alias max<Alias>(const Alias a, const Alias b)                                                       \
+    {                                                                                                           \
+        return Details::mapComponents<Alias>([](const DataType left, const DataType right)                      \
+        {                                                                                                       \
+            return max(left, right);                                                                            \
+        }, a, b);                                                                                               \
+    }
+
+#endif // !__LIBMATH__VECTOR__TVECTOR_H__
@@ -4,9 +4,12 @@
 #include <string>
 
 #include "Arithmetic.h"
+#include "Format.h"
+#include "Hash.h"
 
 #include "Angle/Radian.h"
 
+#include "Vector/TVector.h"
 #include "Vector/Vector3.h"
 
 namespace LibMath
@@ -14,7 +17,7 @@ namespace LibMath
     template <class T>
     class TVector2
     {
-        static_assert(std::is_arithmetic_v<T>, "Invalid vector - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<T>, "Invalid vector - Data type should be an arithmetic or packet type");
 
     public:
         /**
@@ -265,7 +268,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is greater than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is greater than the other's. False otherwise
+         * \return True if this vector's magnitude is greater than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isLongerThan(const TVector2<U>& other) const;
@@ -274,7 +277,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is smaller than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is smaller than the other's. False otherwise
+         * \return True if this vector's magnitude is smaller than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isShorterThan(const TVector2<U>& other) const;
@@ -382,7 +385,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater magnitude. False otherwise
+     * \return True if the left vector has a greater magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>(const TVector2<T>& left, const TVector2<U>& right);
@@ -393,7 +396,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller magnitude. False otherwise
+     * \return True if the left vector has a smaller magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<(const TVector2<T>& left, const TVector2<U>& right);
@@ -404,7 +407,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater or equal magnitude. False otherwise
+     * \return True if the left vector has a greater or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>=(const TVector2<T>& left, const TVector2<U>& right);
@@ -415,7 +418,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller or equal magnitude. False otherwise
+     * \return True if the left vector has a smaller or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<=(const TVector2<T>& left, const TVector2<U>& right);
@@ -481,7 +484,7 @@ namespace LibMath
      * \param vector The vector to add the value to
      * \return The vector with the value added to all its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator+(TVector2<T> vector, U value);
 
     /**
@@ -492,7 +495,7 @@ namespace LibMath
      * \param vector The vector to subtract the value from
      * \return The vector with the value subtracted from all of its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator-(TVector2<T> vector, U value);
 
     /**
@@ -503,7 +506,7 @@ namespace LibMath
      * \param scalar The scalar to multiply by
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator*(TVector2<T> vector, U scalar);
 
     /**
@@ -514,7 +517,7 @@ namespace LibMath
      * \param vector The vector to multiply
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<U> operator*(U scalar, TVector2<T> vector);
 
     /**
@@ -525,7 +528,7 @@ namespace LibMath
      * \param vector The vector to divide
      * \return The vector divided by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator/(TVector2<T> vector, U scalar);
 
     /**
@@ -548,59 +551,61 @@ namespace LibMath
     template <class T>
     std::istream& operator>>(std::istream& stream, TVector2<T>& vector);
 
-#define VEC2_ALIAS_IMPL(DataType, Alias)                                             \
-    using Alias = TVector2<DataType>;                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias clamp<Alias>(const Alias value, const Alias a, const Alias b)       \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            clamp(value.m_x, a.m_x, b.m_x),                                          \
-            clamp(value.m_y, a.m_y, b.m_y)                                           \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias snap<Alias>(const Alias value, const Alias a, const Alias b)        \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            snap(value.m_x, a.m_x, b.m_x),                                           \
-            snap(value.m_y, a.m_y, b.m_y)                                            \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    constexpr bool isInRange<Alias>(const Alias value, const Alias a, const Alias b) \
-    {                                                                                \
-        return isInRange(value.m_x, a.m_x, b.m_x)                                    \
-            && isInRange(value.m_y, a.m_y, b.m_y);                                   \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias min<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            min(a.m_x, b.m_x),                                                       \
-            min(a.m_y, b.m_y)                                                        \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias max<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            max(a.m_x, b.m_x),                                                       \
-            max(a.m_y, b.m_y)                                                        \
-        };                                                                           \
-    }
-
-    VEC2_ALIAS_IMPL(float, Vector2F)
-    VEC2_ALIAS_IMPL(double, Vector2D)
-    VEC2_ALIAS_IMPL(int, Vector2I)
-    VEC2_ALIAS_IMPL(long, Vector2L)
+    /**
+     * \brief Writes the vector's string representation to the given buffer without allocating
+     * \tparam T The vector's data type
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param vector The vector to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector2<T>& vector);
+
+    /**
+     * \brief Parses a vector from the start of the given text (e.g. "{1, 2.5}")
+     * \tparam T The vector's data type
+     * \param text The text to parse
+     * \param vector The output vector. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    template <class T>
+    std::from_chars_result parse(std::string_view text, TVector2<T>& vector);
+
+    VECTOR_ALIAS_IMPL(2, float, Vector2F)
+    VECTOR_ALIAS_IMPL(2, double, Vector2D)
+    VECTOR_ALIAS_IMPL(2, int, Vector2I)
+    VECTOR_ALIAS_IMPL(2, long, Vector2L)
     using Vector2 = TVector2<float>;
+
+    static_assert(std::is_trivially_copyable_v<Vector2> && std::is_standard_layout_v<Vector2>,
+        "Invalid Vector2 - should be trivially copyable and standard layout");
+}
+
+namespace std
+{
+    /**
+     * \brief Hashes integer vectors component-wise (e.g. to use grid cells as unordered container keys)
+     * \note Floating point vectors aren't hashable - their approximate operator== can't be matched by a consistent hash
+     */
+    template <class T>
+        requires std::is_integral_v<T>
+    struct hash<LibMath::TVector2<T>>
+    {
+        size_t operator()(const LibMath::TVector2<T>& vector) const noexcept;
+    };
+
+#ifdef __cpp_lib_format
+    /**
+     * \brief Formats vectors like string(). The format specification applies to each component (e.g. "{:.2f}")
+     */
+    template <class T>
+    struct formatter<LibMath::TVector2<T>, char> : LibMath::Details::TComponentsFormatter<T>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::TVector2<T>& vector, FormatContext& context) const;
+    };
+#endif // __cpp_lib_format
 }
 
 #include "Vector/Vector2.inl"
@@ -2,6 +2,7 @@
 #define __LIBMATH__VECTOR__VECTOR2_INL__
 
 #include <sstream>
+#include <type_traits>
 
 #include "Trigonometry.h"
 
@@ -81,12 +82,13 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator=(const TVector2<U>& other)
     {
-        if (reinterpret_cast<const TVector2*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -94,12 +96,13 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator=(TVector2<U>&& other) noexcept
     {
-        if (reinterpret_cast<const TVector2*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -131,9 +134,7 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator+=(const TVector2<U>& other)
     {
-        this->m_x += static_cast<T>(other.m_x);
-        this->m_y += static_cast<T>(other.m_y);
-
+        Details::addComponents(*this, other);
         return *this;
     }
 
@@ -141,9 +142,7 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator-=(const TVector2<U>& other)
     {
-        this->m_x -= static_cast<T>(other.m_x);
-        this->m_y -= static_cast<T>(other.m_y);
-
+        Details::subtractComponents(*this, other);
         return *this;
     }
 
@@ -151,9 +150,7 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator*=(const TVector2<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x * other.m_x);
-        this->m_y = static_cast<T>(this->m_y * other.m_y);
-
+        Details::multiplyComponents(*this, other);
         return *this;
     }
 
@@ -161,9 +158,7 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator/=(const TVector2<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x / other.m_x);
-        this->m_y = static_cast<T>(this->m_y / other.m_y);
-
+        Details::divideComponents(*this, other);
         return *this;
     }
 
@@ -171,11 +166,9 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator+=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x += static_cast<T>(value);
-        this->m_y += static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::addScalar(*this, value);
         return *this;
     }
 
@@ -183,11 +176,9 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator-=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x -= static_cast<T>(value);
-        this->m_y -= static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::subtractScalar(*this, value);
         return *this;
     }
 
@@ -195,11 +186,9 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator*=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x * value);
-        this->m_y = static_cast<T>(this->m_y * value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::multiplyScalar(*this, value);
         return *this;
     }
 
@@ -207,11 +196,9 @@ namespace LibMath
     template <class U>
     constexpr TVector2<T>& TVector2<T>::operator/=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x / value);
-        this->m_y = static_cast<T>(this->m_y / value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::divideScalar(*this, value);
         return *this;
     }
 
@@ -260,24 +247,24 @@ namespace LibMath
     template <class U>
     constexpr T TVector2<T>::distanceSquaredFrom(const TVector2<U>& other) const
     {
-        const T xDist = static_cast<T>(other.m_x - this->m_x);
-        const T yDist = static_cast<T>(other.m_y - this->m_y);
-
-        return xDist * xDist + yDist * yDist;
+        return Details::distanceSquaredComponents(*this, other);
     }
 
     template <class T>
     template <class U>
     constexpr T TVector2<T>::dot(const TVector2<U>& other) const
     {
-        return static_cast<T>(this->m_x * other.m_x + this->m_y * other.m_y);
+        return Details::dotComponents(*this, other);
     }
 
     template <class T>
     template <class U>
     constexpr bool TVector2<T>::isLongerThan(const TVector2<U>& other) const
     {
-        return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
+        if constexpr (Details::IS_PACKET<T>)
+            return all(this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared()));
+        else
+            return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
     }
 
     template <class T>
@@ -302,19 +289,25 @@ namespace LibMath
     template <class T>
     constexpr T TVector2<T>::magnitudeSquared() const
     {
-        return this->m_x * this->m_x + this->m_y * this->m_y;
+        return Details::magnitudeSquaredComponents(*this);
     }
 
     template <class T>
     void TVector2<T>::normalize()
     {
-        *this /= this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            *this *= inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            *this /= this->magnitude();
     }
 
     template <class T>
     constexpr TVector2<T> TVector2<T>::normalized() const
     {
-        return *this / this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            return *this * inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            return *this / this->magnitude();
     }
 
     template <class T>
@@ -333,8 +326,7 @@ namespace LibMath
     template <class T>
     void TVector2<T>::rotate(const Radian& angle)
     {
-        const float c = cos(angle);
-        const float s = sin(angle);
+        const auto [s, c] = sinCos(angle);
 
         const T x = m_x * c - m_y * s;
         const T y = m_x * s + m_y * c;
@@ -352,21 +344,22 @@ namespace LibMath
     template <class T>
     std::string TVector2<T>::string() const
     {
-        std::ostringstream oss;
-
-        oss << "{" << this->m_x << "," << this->m_y << "}";
+        char buffer[2 * Details::MAX_COMPONENT_CHARS + 3];
 
-        return oss.str();
+        const std::to_chars_result result = formatTo(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, result.ptr);
     }
 
     template <class T>
     std::string TVector2<T>::stringLong() const
     {
-        std::ostringstream oss;
-
-        oss << "Vector2{ x:" << this->m_x << ", y:" << this->m_y << " }";
+        std::string str = "Vector2{ x:";
+        Details::appendComponent(str, this->m_x);
+        str += ", y:";
+        Details::appendComponent(str, this->m_y);
+        str += " }";
 
-        return oss.str();
+        return str;
     }
 
     template <class T>
@@ -378,8 +371,7 @@ namespace LibMath
     template <class T, class U>
     constexpr bool operator==(const TVector2<T>& left, const TVector2<U>& right)
     {
-        return floatEquals(left.m_x, right.m_x)
-            && floatEquals(left.m_y, right.m_y);
+        return Details::componentsEqual(left, right);
     }
 
     template <class T, class U>
@@ -403,19 +395,27 @@ namespace LibMath
     template <class T, class U>
     constexpr bool operator>=(const TVector2<T>& left, const TVector2<U>& right)
     {
-        return !(left < right);
+        // Negating "<" would hold as soon as a single lane isn't shorter
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() >= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left < right);
     }
 
     template <class T, class U>
     constexpr bool operator<=(const TVector2<T>& left, const TVector2<U>& right)
     {
-        return !(left > right);
+        // Negating ">" would hold as soon as a single lane isn't longer
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() <= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left > right);
     }
 
     template <class T>
     constexpr TVector2<T> operator-(const TVector2<T>& vector)
     {
-        return vector * -1;
+        return Details::negateComponents(vector);
     }
 
     template <class T, class U>
@@ -442,31 +442,31 @@ namespace LibMath
         return left /= right;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator+(TVector2<T> vector, U value)
     {
         return vector += value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator-(TVector2<T> vector, U value)
     {
         return vector -= value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator*(TVector2<T> vector, U scalar)
     {
         return vector *= scalar;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<U> operator*(U scalar, TVector2<T> vector)
     {
         return vector *= static_cast<T>(scalar);
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector2<T> operator/(TVector2<T> vector, U scalar)
     {
         return vector /= scalar;
@@ -487,34 +487,55 @@ namespace LibMath
 
         std::getline(stream, line, '}');
 
-        int    component = 0;
-        size_t valStart  = 0;
+        T values[2];
 
-        do
-        {
-            if (valStart == std::string::npos)
-                break;
+        if (Details::parseComponentList(line.data(), line.data() + line.size(), values, 2).ec == std::errc())
+            vector = TVector2<T>(values[0], values[1]);
+        else
+            vector = TVector2<T>::zero();
 
-            if (line[valStart] == '{' || std::isspace(line[valStart]))
-            {
-                valStart++;
-                continue;
-            }
+        return stream;
+    }
 
-            if (line[valStart] != '-' && !std::isdigit(line[valStart]))
-                break;
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector2<T>& vector)
+    {
+        const T values[] = { vector.m_x, vector.m_y };
+        return Details::formatComponents(first, last, values, 2);
+    }
 
-            vector[component] = std::stof(line.substr(valStart));
+    template <class T>
+    std::from_chars_result parse(const std::string_view text, TVector2<T>& vector)
+    {
+        T values[2];
 
-            valStart = line.find(',', valStart) + 1;
-            component++;
-        } while (component < 2 && valStart != 0);
+        const std::from_chars_result result = Details::parseComponents(text.data(), text.data() + text.size(), values, 2);
 
-        if (component != 2)
-            vector = TVector2<T>::zero();
+        if (result.ec == std::errc())
+            vector = TVector2<T>(values[0], values[1]);
 
-        return stream;
+        return result;
+    }
+}
+
+namespace std
+{
+    template <class T>
+        requires std::is_integral_v<T>
+    size_t hash<LibMath::TVector2<T>>::operator()(const LibMath::TVector2<T>& vector) const noexcept
+    {
+        return static_cast<size_t>(LibMath::Details::hashComponents(vector));
+    }
+
+#ifdef __cpp_lib_format
+    template <class T>
+    template <class FormatContext>
+    auto formatter<LibMath::TVector2<T>, char>::format(const LibMath::TVector2<T>& vector, FormatContext& context) const
+    {
+        const T values[] = { vector.m_x, vector.m_y };
+        return this->formatComponents(values, 2, context);
     }
+#endif // __cpp_lib_format
 }
 
 #endif // !__LIBMATH__VECTOR__VECTOR2_INL__
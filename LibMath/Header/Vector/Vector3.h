@@ -5,9 +5,13 @@
 #include <string>
 
 #include "Arithmetic.h"
+#include "Format.h"
+#include "Hash.h"
 
 #include "Angle/Radian.h"
 
+#include "Vector/TVector.h"
+
 namespace LibMath
 {
     template <class T>
@@ -16,8 +20,8 @@ namespace LibMath
     template <class T>
     class TVector3
     {
-        static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Degree> || std::is_same_v<T, Radian>,
-            "Invalid vector - Data type should be an arithmetic or angle type");
+        static_assert(Details::IS_SCALAR<T> || std::is_same_v<T, Degree> || std::is_same_v<T, Radian>,
+            "Invalid vector - Data type should be an arithmetic, packet or angle type");
 
     public:
         /**
@@ -286,7 +290,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is greater than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is greater than the other's. False otherwise
+         * \return True if this vector's magnitude is greater than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isLongerThan(const TVector3<U>& other) const;
@@ -295,7 +299,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is smaller than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is smaller than the other's. False otherwise
+         * \return True if this vector's magnitude is smaller than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isShorterThan(const TVector3<U>& other) const;
@@ -359,7 +363,7 @@ namespace LibMath
         /**
          * \brief Rotates this vector using the given quaternion
          * \tparam U The quaternion's data type
-         * \param quaternion The quaternion rotor
+         * \param quaternion The quaternion rotor. Should be a unit quaternion
          */
         template <class U>
         void rotate(const TQuaternion<U>& quaternion);
@@ -421,7 +425,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater magnitude. False otherwise
+     * \return True if the left vector has a greater magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>(const TVector3<T>& left, const TVector3<U>& right);
@@ -432,7 +436,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller magnitude. False otherwise
+     * \return True if the left vector has a smaller magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<(const TVector3<T>& left, const TVector3<U>& right);
@@ -443,7 +447,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater or equal magnitude. False otherwise
+     * \return True if the left vector has a greater or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>=(const TVector3<T>& left, const TVector3<U>& right);
@@ -454,7 +458,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller or equal magnitude. False otherwise
+     * \return True if the left vector has a smaller or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<=(const TVector3<T>& left, const TVector3<U>& right);
@@ -520,7 +524,7 @@ namespace LibMath
      * \param vector The vector to add the value to
      * \return The vector with the value added to all its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator+(TVector3<T> vector, U value);
 
     /**
@@ -531,7 +535,7 @@ namespace LibMath
      * \param vector The vector to subtract the value from
      * \return The vector with the value subtracted from all of its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator-(TVector3<T> vector, U value);
 
     /**
@@ -542,7 +546,7 @@ namespace LibMath
      * \param scalar The scalar to multiply by
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator*(TVector3<T> vector, U scalar);
 
     /**
@@ -553,7 +557,7 @@ namespace LibMath
      * \param vector The vector to multiply
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<U> operator*(U scalar, TVector3<T> vector);
 
     /**
@@ -564,7 +568,7 @@ namespace LibMath
      * \param vector The vector to divide
      * \return The vector divided by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator/(TVector3<T> vector, U scalar);
 
     /**
@@ -587,64 +591,63 @@ namespace LibMath
     template <class T>
     std::istream& operator>>(std::istream& stream, TVector3<T>& vector);
 
-#define VEC3_ALIAS_IMPL(DataType, Alias)                                             \
-    using Alias = TVector3<DataType>;                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias clamp<Alias>(const Alias value, const Alias a, const Alias b)       \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            clamp(value.m_x, a.m_x, b.m_x),                                          \
-            clamp(value.m_y, a.m_y, b.m_y),                                          \
-            clamp(value.m_z, a.m_z, b.m_z)                                           \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias snap<Alias>(const Alias value, const Alias a, const Alias b)        \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            snap(value.m_x, a.m_x, b.m_x),                                           \
-            snap(value.m_y, a.m_y, b.m_y),                                           \
-            snap(value.m_z, a.m_z, b.m_z)                                            \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    constexpr bool isInRange<Alias>(const Alias value, const Alias a, const Alias b) \
-    {                                                                                \
-        return isInRange(value.m_x, a.m_x, b.m_x)                                    \
-            && isInRange(value.m_y, a.m_y, b.m_y)                                    \
-            && isInRange(value.m_z, a.m_z, b.m_z);                                   \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias min<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            min(a.m_x, b.m_x),                                                       \
-            min(a.m_y, b.m_y),                                                       \
-            min(a.m_z, b.m_z)                                                        \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias max<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            max(a.m_x, b.m_x),                                                       \
-            max(a.m_y, b.m_y),                                                       \
-            max(a.m_z, b.m_z)                                                        \
-        };                                                                           \
-    }
-
-    VEC3_ALIAS_IMPL(float, Vector3F)
-    VEC3_ALIAS_IMPL(double, Vector3D)
-    VEC3_ALIAS_IMPL(int, Vector3I)
-    VEC3_ALIAS_IMPL(long, Vector3L)
+    /**
+     * \brief Writes the vector's string representation to the given buffer without allocating
+     * \tparam T The vector's data type
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param vector The vector to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector3<T>& vector);
+
+    /**
+     * \brief Parses a vector from the start of the given text (e.g. "{1, 2.5, -3}")
+     * \tparam T The vector's data type
+     * \param text The text to parse
+     * \param vector The output vector. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    template <class T>
+    std::from_chars_result parse(std::string_view text, TVector3<T>& vector);
+
+    VECTOR_ALIAS_IMPL(3, float, Vector3F)
+    VECTOR_ALIAS_IMPL(3, double, Vector3D)
+    VECTOR_ALIAS_IMPL(3, int, Vector3I)
+    VECTOR_ALIAS_IMPL(3, long, Vector3L)
     using Vector3 = TVector3<float>;
+
+    static_assert(std::is_trivially_copyable_v<Vector3> && std::is_standard_layout_v<Vector3>,
+        "Invalid Vector3 - should be trivially copyable and standard layout");
+    static_assert(std::is_trivially_copyable_v<TVector3<Radian>> && std::is_standard_layout_v<TVector3<Radian>>,
+        "Invalid TVector3<Radian> - should be trivially copyable and standard layout");
+}
+
+namespace std
+{
+    /**
+     * \brief Hashes integer vectors component-wise (e.g. to use grid cells as unordered container keys)
+     * \note Floating point vectors aren't hashable - their approximate operator== can't be matched by a consistent hash
+     */
+    template <class T>
+        requires std::is_integral_v<T>
+    struct hash<LibMath::TVector3<T>>
+    {
+        size_t operator()(const LibMath::TVector3<T>& vector) const noexcept;
+    };
+
+#ifdef __cpp_lib_format
+    /**
+     * \brief Formats vectors like string(). The format specification applies to each component (e.g. "{:.2f}")
+     */
+    template <class T>
+    struct formatter<LibMath::TVector3<T>, char> : LibMath::Details::TComponentsFormatter<T>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::TVector3<T>& vector, FormatContext& context) const;
+    };
+#endif // __cpp_lib_format
 }
 
 #include "Vector/Vector3.inl"
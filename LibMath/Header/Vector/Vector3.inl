@@ -2,6 +2,7 @@
 #define __LIBMATH__VECTOR__VECTOR3_INL__
 
 #include <sstream>
+#include <type_traits>
 
 #include "Quaternion.h"
 
@@ -87,13 +88,13 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator=(const TVector3<U>& other)
     {
-        if (reinterpret_cast<const TVector3*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
-        m_z = static_cast<T>(other.m_z);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -101,13 +102,13 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator=(TVector3<U>&& other)
     {
-        if (reinterpret_cast<const TVector3*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
-        m_z = static_cast<T>(other.m_z);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -143,10 +144,7 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator+=(const TVector3<U>& other)
     {
-        this->m_x += static_cast<T>(other.m_x);
-        this->m_y += static_cast<T>(other.m_y);
-        this->m_z += static_cast<T>(other.m_z);
-
+        Details::addComponents(*this, other);
         return *this;
     }
 
@@ -154,10 +152,7 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator-=(const TVector3<U>& other)
     {
-        this->m_x -= static_cast<T>(other.m_x);
-        this->m_y -= static_cast<T>(other.m_y);
-        this->m_z -= static_cast<T>(other.m_z);
-
+        Details::subtractComponents(*this, other);
         return *this;
     }
 
@@ -165,10 +160,7 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator*=(const TVector3<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x * other.m_x);
-        this->m_y = static_cast<T>(this->m_y * other.m_y);
-        this->m_z = static_cast<T>(this->m_z * other.m_z);
-
+        Details::multiplyComponents(*this, other);
         return *this;
     }
 
@@ -176,10 +168,7 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator/=(const TVector3<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x / other.m_x);
-        this->m_y = static_cast<T>(this->m_y / other.m_y);
-        this->m_z = static_cast<T>(this->m_z / other.m_z);
-
+        Details::divideComponents(*this, other);
         return *this;
     }
 
@@ -187,12 +176,9 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator+=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x += static_cast<T>(value);
-        this->m_y += static_cast<T>(value);
-        this->m_z += static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::addScalar(*this, value);
         return *this;
     }
 
@@ -200,12 +186,9 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator-=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x -= static_cast<T>(value);
-        this->m_y -= static_cast<T>(value);
-        this->m_z -= static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::subtractScalar(*this, value);
         return *this;
     }
 
@@ -213,12 +196,9 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator*=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x * value);
-        this->m_y = static_cast<T>(this->m_y * value);
-        this->m_z = static_cast<T>(this->m_z * value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::multiplyScalar(*this, value);
         return *this;
     }
 
@@ -226,12 +206,9 @@ namespace LibMath
     template <class U>
     constexpr TVector3<T>& TVector3<T>::operator/=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x / value);
-        this->m_y = static_cast<T>(this->m_y / value);
-        this->m_z = static_cast<T>(this->m_z / value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::divideScalar(*this, value);
         return *this;
     }
 
@@ -280,11 +257,7 @@ namespace LibMath
     template <class T>
     constexpr T TVector3<T>::distanceSquaredFrom(const TVector3& other) const
     {
-        const T xDist = other.m_x - this->m_x;
-        const T yDist = other.m_y - this->m_y;
-        const T zDist = other.m_z - this->m_z;
-
-        return xDist * xDist + yDist * yDist + zDist * zDist;
+        return Details::distanceSquaredComponents(*this, other);
     }
 
     template <class T>
@@ -306,14 +279,17 @@ namespace LibMath
     template <class U>
     constexpr T TVector3<T>::dot(const TVector3<U>& other) const
     {
-        return static_cast<T>(this->m_x * other.m_x + this->m_y * other.m_y + this->m_z * other.m_z);
+        return Details::dotComponents(*this, other);
     }
 
     template <class T>
     template <class U>
     constexpr bool TVector3<T>::isLongerThan(const TVector3<U>& other) const
     {
-        return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
+        if constexpr (Details::IS_PACKET<T>)
+            return all(this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared()));
+        else
+            return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
     }
 
     template <class T>
@@ -338,19 +314,25 @@ namespace LibMath
     template <class T>
     constexpr T TVector3<T>::magnitudeSquared() const
     {
-        return this->m_x * this->m_x + this->m_y * this->m_y + this->m_z * this->m_z;
+        return Details::magnitudeSquaredComponents(*this);
     }
 
     template <class T>
     void TVector3<T>::normalize()
     {
-        *this /= this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            *this *= inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            *this /= this->magnitude();
     }
 
     template <class T>
     constexpr TVector3<T> TVector3<T>::normalized() const
     {
-        return *this / this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            return *this * inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            return *this / this->magnitude();
     }
 
     template <class T>
@@ -382,8 +364,7 @@ namespace LibMath
     template <class U>
     void TVector3<T>::rotate(const TQuaternion<U>& quaternion)
     {
-        TQuaternion<U> tmp{ 0, *this };
-        *this = quaternion * tmp * quaternion.inverse();
+        *this = quaternion.rotate(*this);
     }
 
     template <class T>
@@ -401,30 +382,30 @@ namespace LibMath
     template <class T>
     std::string TVector3<T>::string() const
     {
-        std::ostringstream oss;
-
-        oss << "{" << this->m_x << "," << this->m_y << "," << this->m_z << "}";
+        char buffer[3 * Details::MAX_COMPONENT_CHARS + 4];
 
-        return oss.str();
+        const std::to_chars_result result = formatTo(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, result.ptr);
     }
 
     template <class T>
     std::string TVector3<T>::stringLong() const
     {
-        std::ostringstream oss;
+        std::string str = "Vector3{ x:";
+        Details::appendComponent(str, this->m_x);
+        str += ", y:";
+        Details::appendComponent(str, this->m_y);
+        str += ", z:";
+        Details::appendComponent(str, this->m_z);
+        str += " }";
 
-        oss << "Vector3{ x:" << this->m_x << ", y:" << this->m_y << ", z:"
-            << this->m_z << " }";
-
-        return oss.str();
+        return str;
     }
 
     template <class T, class U>
     constexpr bool operator==(const TVector3<T>& left, const TVector3<U>& right)
     {
-        return floatEquals(left.m_x, static_cast<T>(right.m_x))
-            && floatEquals(left.m_y, static_cast<T>(right.m_y))
-            && floatEquals(left.m_z, static_cast<T>(right.m_z));
+        return Details::componentsEqual(left, right);
     }
 
     template <class T, class U>
@@ -448,19 +429,27 @@ namespace LibMath
     template <class T, class U>
     constexpr bool operator>=(const TVector3<T>& left, const TVector3<U>& right)
     {
-        return !(left < right);
+        // Negating "<" would hold as soon as a single lane isn't shorter
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() >= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left < right);
     }
 
     template <class T, class U>
     constexpr bool operator<=(const TVector3<T>& left, const TVector3<U>& right)
     {
-        return !(left > right);
+        // Negating ">" would hold as soon as a single lane isn't longer
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() <= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left > right);
     }
 
     template <class T>
     constexpr TVector3<T> operator-(const TVector3<T>& vector)
     {
-        return { -vector.m_x, -vector.m_y, -vector.m_z };
+        return Details::negateComponents(vector);
     }
 
     template <class T, class U>
@@ -487,31 +476,31 @@ namespace LibMath
         return left /= right;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator+(TVector3<T> vector, U value)
     {
         return vector += value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator-(TVector3<T> vector, U value)
     {
         return vector -= value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator*(TVector3<T> vector, U scalar)
     {
         return vector *= scalar;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<U> operator*(U scalar, TVector3<T> vector)
     {
         return vector *= scalar;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector3<T> operator/(TVector3<T> vector, U scalar)
     {
         return vector /= scalar;
@@ -530,34 +519,55 @@ namespace LibMath
 
         std::getline(stream, line, '}');
 
-        int    component = 0;
-        size_t valStart  = 0;
+        T values[3];
 
-        do
-        {
-            if (valStart == std::string::npos)
-                break;
+        if (Details::parseComponentList(line.data(), line.data() + line.size(), values, 3).ec == std::errc())
+            vector = TVector3<T>(values[0], values[1], values[2]);
+        else
+            vector = TVector3<T>::zero();
 
-            if (line[valStart] == '{' || std::isspace(line[valStart]))
-            {
-                valStart++;
-                continue;
-            }
+        return stream;
+    }
 
-            if (line[valStart] != '-' && !std::isdigit(line[valStart]))
-                break;
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector3<T>& vector)
+    {
+        const T values[] = { vector.m_x, vector.m_y, vector.m_z };
+        return Details::formatComponents(first, last, values, 3);
+    }
 
-            vector[component] = std::stof(line.substr(valStart));
+    template <class T>
+    std::from_chars_result parse(const std::string_view text, TVector3<T>& vector)
+    {
+        T values[3];
 
-            valStart = line.find(',', valStart) + 1;
-            component++;
-        } while (component < 3 && valStart != 0);
+        const std::from_chars_result result = Details::parseComponents(text.data(), text.data() + text.size(), values, 3);
 
-        if (component != 3)
-            vector = TVector3<T>::zero();
+        if (result.ec == std::errc())
+            vector = TVector3<T>(values[0], values[1], values[2]);
 
-        return stream;
+        return result;
+    }
+}
+
+namespace std
+{
+    template <class T>
+        requires std::is_integral_v<T>
+    size_t hash<LibMath::TVector3<T>>::operator()(const LibMath::TVector3<T>& vector) const noexcept
+    {
+        return static_cast<size_t>(LibMath::Details::hashComponents(vector));
+    }
+
+#ifdef __cpp_lib_format
+    template <class T>
+    template <class FormatContext>
+    auto formatter<LibMath::TVector3<T>, char>::format(const LibMath::TVector3<T>& vector, FormatContext& context) const
+    {
+        const T values[] = { vector.m_x, vector.m_y, vector.m_z };
+        return this->formatComponents(values, 3, context);
     }
+#endif // __cpp_lib_format
 }
 
 #endif // !__LIBMATH__VECTOR__VECTOR3_INL__
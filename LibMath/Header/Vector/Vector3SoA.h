@@ -0,0 +1,376 @@
+#ifndef __LIBMATH__VECTOR__VECTOR3SOA_H__
+#define __LIBMATH__VECTOR__VECTOR3SOA_H__
+
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "Simd.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+    /**
+     * \brief Structure of arrays storage for 3D float vectors - each component is stored in its own contiguous array
+     * so the stream operations below can process one component of several vectors per instruction
+     */
+    class Vector3SoA
+    {
+    public:
+        /**
+         * \brief Creates an empty vector stream
+         */
+        Vector3SoA() = default;
+
+        /**
+         * \brief Creates a stream of the given number of zero vectors
+         * \param size The stream's number of vectors
+         */
+        explicit Vector3SoA(size_t size);
+
+        /**
+         * \brief Creates a stream from the given vectors
+         * \param vectors The source vectors
+         */
+        explicit Vector3SoA(std::span<const Vector3> vectors);
+
+        /**
+         * \brief Gets the stream's number of vectors
+         * \return The stream's number of vectors
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the stream contains any vector or not
+         * \return True if the stream contains no vector. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Resizes the stream. Added vectors are zero vectors
+         * \param size The stream's new number of vectors
+         */
+        void resize(size_t size);
+
+        /**
+         * \brief Reserves enough memory for the given number of vectors
+         * \param capacity The number of vectors to reserve memory for
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * \brief Gets the vector at the given index
+         * \param index The vector's index
+         * \return The vector at the given index
+         */
+        Vector3 get(size_t index) const;
+
+        /**
+         * \brief Sets the vector at the given index
+         * \param index The vector's index
+         * \param vector The vector's new value
+         */
+        void set(size_t index, const Vector3& vector);
+
+        /**
+         * \brief Appends the given vector at the end of the stream
+         * \param vector The added vector
+         */
+        void pushBack(const Vector3& vector);
+
+        /**
+         * \brief Replaces the stream's content by the given vectors
+         * \param vectors The source vectors
+         */
+        void assign(std::span<const Vector3> vectors);
+
+        /**
+         * \brief Copies the stream's vectors to the given array of vectors
+         * \param out The destination array. Should have the same size as the stream
+         */
+        void copyTo(std::span<Vector3> out) const;
+
+        /**
+         * \brief Gets a pointer to the x component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's x component. The following vectors' x components are contiguous
+         */
+        float* getX(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the x component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's x component. The following vectors' x components are contiguous
+         */
+        const float* getX(size_t index = 0) const;
+
+        /**
+         * \brief Gets a pointer to the y component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's y component. The following vectors' y components are contiguous
+         */
+        float* getY(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the y component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's y component. The following vectors' y components are contiguous
+         */
+        const float* getY(size_t index = 0) const;
+
+        /**
+         * \brief Gets a pointer to the z component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's z component. The following vectors' z components are contiguous
+         */
+        float* getZ(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the z component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's z component. The following vectors' z components are contiguous
+         */
+        const float* getZ(size_t index = 0) const;
+
+    private:
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+        std::vector<float> m_z;
+    };
+
+    /**
+     * \brief Array of structures of arrays storage for 3D float vectors - vectors are stored in fixed-size blocks holding
+     * one array per component. Keeps the stream operations' per-component access while keeping the 3 components of a vector
+     * close in memory (e.g. for random access or when each vector is streamed along with other data)
+     */
+    class Vector3AoSoA
+    {
+    public:
+        static constexpr size_t BLOCK_SIZE = 8;
+
+        static_assert(BLOCK_SIZE % Details::FLOAT_PACK_SIZE == 0, "Invalid block size - should be a multiple of the SIMD width");
+
+        struct alignas(BLOCK_SIZE * sizeof(float)) Block
+        {
+            float m_x[BLOCK_SIZE];
+            float m_y[BLOCK_SIZE];
+            float m_z[BLOCK_SIZE];
+        };
+
+        /**
+         * \brief Creates an empty vector stream
+         */
+        Vector3AoSoA() = default;
+
+        /**
+         * \brief Creates a stream of the given number of zero vectors
+         * \param size The stream's number of vectors
+         */
+        explicit Vector3AoSoA(size_t size);
+
+        /**
+         * \brief Creates a stream from the given vectors
+         * \param vectors The source vectors
+         */
+        explicit Vector3AoSoA(std::span<const Vector3> vectors);
+
+        /**
+         * \brief Gets the stream's number of vectors
+         * \return The stream's number of vectors
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the stream contains any vector or not
+         * \return True if the stream contains no vector. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Resizes the stream. Added vectors are zero vectors
+         * \param size The stream's new number of vectors
+         */
+        void resize(size_t size);
+
+        /**
+         * \brief Reserves enough memory for the given number of vectors
+         * \param capacity The number of vectors to reserve memory for
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * \brief Gets the vector at the given index
+         * \param index The vector's index
+         * \return The vector at the given index
+         */
+        Vector3 get(size_t index) const;
+
+        /**
+         * \brief Sets the vector at the given index
+         * \param index The vector's index
+         * \param vector The vector's new value
+         */
+        void set(size_t index, const Vector3& vector);
+
+        /**
+         * \brief Appends the given vector at the end of the stream
+         * \param vector The added vector
+         */
+        void pushBack(const Vector3& vector);
+
+        /**
+         * \brief Replaces the stream's content by the given vectors
+         * \param vectors The source vectors
+         */
+        void assign(std::span<const Vector3> vectors);
+
+        /**
+         * \brief Copies the stream's vectors to the given array of vectors
+         * \param out The destination array. Should have the same size as the stream
+         */
+        void copyTo(std::span<Vector3> out) const;
+
+        /**
+         * \brief Gets the stream's blocks. The last block's unused vectors are zero vectors
+         * \return The stream's blocks
+         */
+        std::span<Block> getBlocks();
+
+        /**
+         * \brief Gets the stream's blocks. The last block's unused vectors are zero vectors
+         * \return The stream's blocks
+         */
+        std::span<const Block> getBlocks() const;
+
+        /**
+         * \brief Gets a pointer to the x component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's x component. The x components are contiguous up to the end of the vector's block
+         */
+        float* getX(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the x component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's x component. The x components are contiguous up to the end of the vector's block
+         */
+        const float* getX(size_t index = 0) const;
+
+        /**
+         * \brief Gets a pointer to the y component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's y component. The y components are contiguous up to the end of the vector's block
+         */
+        float* getY(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the y component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's y component. The y components are contiguous up to the end of the vector's block
+         */
+        const float* getY(size_t index = 0) const;
+
+        /**
+         * \brief Gets a pointer to the z component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's z component. The z components are contiguous up to the end of the vector's block
+         */
+        float* getZ(size_t index = 0);
+
+        /**
+         * \brief Gets a pointer to the z component of the vector at the given index
+         * \param index The vector's index
+         * \return A pointer to the vector's z component. The z components are contiguous up to the end of the vector's block
+         */
+        const float* getZ(size_t index = 0) const;
+
+    private:
+        std::vector<Block> m_blocks;
+        size_t             m_size = 0;
+    };
+
+    /**
+     * \brief A structure of arrays vector stream (Vector3SoA or Vector3AoSoA)
+     */
+    template <class T>
+    concept Vector3Stream = std::same_as<T, Vector3SoA> || std::same_as<T, Vector3AoSoA>;
+
+    /*
+     * Stream operations. They have the same semantics as the matching TVector3 operations, applied to each vector of the
+     * operands. Operands should have the same size, and the output stream is resized to match. The output can be one of the
+     * operands. Both stream layouts can be mixed freely.
+     */
+
+    /**
+     * \brief Computes out[i] = left[i] + right[i]
+     */
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void add(const Left& left, const Right& right, Out& out);
+
+    /**
+     * \brief Computes out[i] = left[i] - right[i]
+     */
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void subtract(const Left& left, const Right& right, Out& out);
+
+    /**
+     * \brief Computes out[i] = vectors[i] * factor
+     */
+    template <Vector3Stream Stream, Vector3Stream Out>
+    void scale(const Stream& vectors, float factor, Out& out);
+
+    /**
+     * \brief Computes out[i] = left[i].dot(right[i])
+     * \note The output span should have the same size as the operands
+     */
+    template <Vector3Stream Left, Vector3Stream Right>
+    void dot(const Left& left, const Right& right, std::span<float> out);
+
+    /**
+     * \brief Computes out[i] = left[i].cross(right[i])
+     */
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void cross(const Left& left, const Right& right, Out& out);
+
+    /**
+     * \brief Computes out[i] = vectors[i].magnitude()
+     * \note The output span should have the same size as the stream
+     */
+    template <Vector3Stream Stream>
+    void magnitude(const Stream& vectors, std::span<float> out);
+
+    /**
+     * \brief Computes out[i] = vectors[i].normalized()
+     */
+    template <Vector3Stream Stream, Vector3Stream Out>
+    void normalize(const Stream& vectors, Out& out);
+
+    /**
+     * \brief Computes out[i] = left[i].distanceFrom(right[i])
+     * \note The output span should have the same size as the operands
+     */
+    template <Vector3Stream Left, Vector3Stream Right>
+    void distance(const Left& left, const Right& right, std::span<float> out);
+
+    /**
+     * \brief Computes out[i] = lerp(from[i], to[i], alpha)
+     */
+    template <Vector3Stream From, Vector3Stream To, Vector3Stream Out>
+    void lerp(const From& from, const To& to, float alpha, Out& out);
+
+    /**
+     * \brief Computes out[i] = min(left[i], right[i]) (component-wise)
+     */
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void min(const Left& left, const Right& right, Out& out);
+
+    /**
+     * \brief Computes out[i] = max(left[i], right[i]) (component-wise)
+     */
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void max(const Left& left, const Right& right, Out& out);
+}
+
+#include "Vector/Vector3SoA.inl"
+
+#endif // !__LIBMATH__VECTOR__VECTOR3SOA_H__
@@ -0,0 +1,439 @@
+#ifndef __LIBMATH__VECTOR__VECTOR3SOA_INL__
+#define __LIBMATH__VECTOR__VECTOR3SOA_INL__
+
+#include <cassert>
+
+#include "Vector/Vector3SoA.h"
+
+namespace LibMath
+{
+    namespace Details
+    {
+        /**
+         * \brief Copies the given array of vectors to the given stream, which should already have the right size
+         */
+        template <Vector3Stream Stream>
+        void loadStream(Stream& stream, const std::span<const Vector3> vectors)
+        {
+            assert(stream.size() == vectors.size() && "Invalid stream - sizes differ");
+
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE
+            static_assert(sizeof(Vector3) == 3 * sizeof(float), "Invalid Vector3 - should be tightly packed");
+
+            for (; index + 4 <= vectors.size(); index += 4)
+            {
+                __m128 xs, ys, zs;
+                loadDeinterleaved3(&vectors[index].m_x, xs, ys, zs);
+
+                _mm_storeu_ps(stream.getX(index), xs);
+                _mm_storeu_ps(stream.getY(index), ys);
+                _mm_storeu_ps(stream.getZ(index), zs);
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; index < vectors.size(); index++)
+                stream.set(index, vectors[index]);
+        }
+
+        /**
+         * \brief Copies the given stream to the given array of vectors
+         */
+        template <Vector3Stream Stream>
+        void storeStream(const Stream& stream, const std::span<Vector3> out)
+        {
+            assert(stream.size() == out.size() && "Invalid stream - sizes differ");
+
+            size_t index = 0;
+
+#ifdef LIBMATH_SIMD_SSE
+            for (; index + 4 <= out.size(); index += 4)
+            {
+                storeInterleaved3(&out[index].m_x, _mm_loadu_ps(stream.getX(index)), _mm_loadu_ps(stream.getY(index)),
+                    _mm_loadu_ps(stream.getZ(index)));
+            }
+#endif // LIBMATH_SIMD_SSE
+
+            for (; index < out.size(); index++)
+                out[index] = stream.get(index);
+        }
+
+        /**
+         * \brief Computes out[i] = op(left[i], right[i]) for each component of each vector
+         */
+        template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out, class Operation>
+        void componentWise(const Left& left, const Right& right, Out& out, Operation&& operation)
+        {
+            assert(left.size() == right.size() && "Invalid stream operation - operand sizes differ");
+            out.resize(left.size());
+
+            forEachPack(left.size(), [&left, &right, &out, &operation]<class Pack>(const size_t i)
+            {
+                storePack(out.getX(i), operation(loadPack<Pack>(left.getX(i)), loadPack<Pack>(right.getX(i))));
+                storePack(out.getY(i), operation(loadPack<Pack>(left.getY(i)), loadPack<Pack>(right.getY(i))));
+                storePack(out.getZ(i), operation(loadPack<Pack>(left.getZ(i)), loadPack<Pack>(right.getZ(i))));
+            });
+        }
+
+        /**
+         * \brief Computes the dot product of the given components
+         */
+        template <class Pack>
+        Pack dot(const Pack leftX, const Pack leftY, const Pack leftZ, const Pack rightX, const Pack rightY, const Pack rightZ)
+        {
+            return packAdd(packAdd(packMul(leftX, rightX), packMul(leftY, rightY)), packMul(leftZ, rightZ));
+        }
+    }
+
+    inline Vector3SoA::Vector3SoA(const size_t size)
+        : m_x(size), m_y(size), m_z(size)
+    {
+    }
+
+    inline Vector3SoA::Vector3SoA(const std::span<const Vector3> vectors)
+        : Vector3SoA(vectors.size())
+    {
+        Details::loadStream(*this, vectors);
+    }
+
+    inline size_t Vector3SoA::size() const
+    {
+        return m_x.size();
+    }
+
+    inline bool Vector3SoA::empty() const
+    {
+        return m_x.empty();
+    }
+
+    inline void Vector3SoA::resize(const size_t size)
+    {
+        m_x.resize(size);
+        m_y.resize(size);
+        m_z.resize(size);
+    }
+
+    inline void Vector3SoA::reserve(const size_t capacity)
+    {
+        m_x.reserve(capacity);
+        m_y.reserve(capacity);
+        m_z.reserve(capacity);
+    }
+
+    inline Vector3 Vector3SoA::get(const size_t index) const
+    {
+        assert(index < size() && "Index out of range");
+        return { m_x[index], m_y[index], m_z[index] };
+    }
+
+    inline void Vector3SoA::set(const size_t index, const Vector3& vector)
+    {
+        assert(index < size() && "Index out of range");
+
+        m_x[index] = vector.m_x;
+        m_y[index] = vector.m_y;
+        m_z[index] = vector.m_z;
+    }
+
+    inline void Vector3SoA::pushBack(const Vector3& vector)
+    {
+        m_x.push_back(vector.m_x);
+        m_y.push_back(vector.m_y);
+        m_z.push_back(vector.m_z);
+    }
+
+    inline void Vector3SoA::assign(const std::span<const Vector3> vectors)
+    {
+        resize(vectors.size());
+        Details::loadStream(*this, vectors);
+    }
+
+    inline void Vector3SoA::copyTo(const std::span<Vector3> out) const
+    {
+        Details::storeStream(*this, out);
+    }
+
+    inline float* Vector3SoA::getX(const size_t index)
+    {
+        return m_x.data() + index;
+    }
+
+    inline const float* Vector3SoA::getX(const size_t index) const
+    {
+        return m_x.data() + index;
+    }
+
+    inline float* Vector3SoA::getY(const size_t index)
+    {
+        return m_y.data() + index;
+    }
+
+    inline const float* Vector3SoA::getY(const size_t index) const
+    {
+        return m_y.data() + index;
+    }
+
+    inline float* Vector3SoA::getZ(const size_t index)
+    {
+        return m_z.data() + index;
+    }
+
+    inline const float* Vector3SoA::getZ(const size_t index) const
+    {
+        return m_z.data() + index;
+    }
+
+    inline Vector3AoSoA::Vector3AoSoA(const size_t size)
+    {
+        resize(size);
+    }
+
+    inline Vector3AoSoA::Vector3AoSoA(const std::span<const Vector3> vectors)
+        : Vector3AoSoA(vectors.size())
+    {
+        Details::loadStream(*this, vectors);
+    }
+
+    inline size_t Vector3AoSoA::size() const
+    {
+        return m_size;
+    }
+
+    inline bool Vector3AoSoA::empty() const
+    {
+        return m_size == 0;
+    }
+
+    inline void Vector3AoSoA::resize(const size_t size)
+    {
+        // Clear the last block's unused vectors so they stay zero vectors
+        for (size_t index = size; index < m_size && index % BLOCK_SIZE != 0; index++)
+            set(index, Vector3::zero());
+
+        m_blocks.resize((size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        m_size = size;
+    }
+
+    inline void Vector3AoSoA::reserve(const size_t capacity)
+    {
+        m_blocks.reserve((capacity + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    }
+
+    inline Vector3 Vector3AoSoA::get(const size_t index) const
+    {
+        assert(index < size() && "Index out of range");
+        return { *getX(index), *getY(index), *getZ(index) };
+    }
+
+    inline void Vector3AoSoA::set(const size_t index, const Vector3& vector)
+    {
+        assert(index < m_blocks.size() * BLOCK_SIZE && "Index out of range");
+
+        *getX(index) = vector.m_x;
+        *getY(index) = vector.m_y;
+        *getZ(index) = vector.m_z;
+    }
+
+    inline void Vector3AoSoA::pushBack(const Vector3& vector)
+    {
+        resize(m_size + 1);
+        set(m_size - 1, vector);
+    }
+
+    inline void Vector3AoSoA::assign(const std::span<const Vector3> vectors)
+    {
+        resize(vectors.size());
+        Details::loadStream(*this, vectors);
+    }
+
+    inline void Vector3AoSoA::copyTo(const std::span<Vector3> out) const
+    {
+        Details::storeStream(*this, out);
+    }
+
+    inline std::span<Vector3AoSoA::Block> Vector3AoSoA::getBlocks()
+    {
+        return m_blocks;
+    }
+
+    inline std::span<const Vector3AoSoA::Block> Vector3AoSoA::getBlocks() const
+    {
+        return m_blocks;
+    }
+
+    inline float* Vector3AoSoA::getX(const size_t index)
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_x + index % BLOCK_SIZE;
+    }
+
+    inline const float* Vector3AoSoA::getX(const size_t index) const
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_x + index % BLOCK_SIZE;
+    }
+
+    inline float* Vector3AoSoA::getY(const size_t index)
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_y + index % BLOCK_SIZE;
+    }
+
+    inline const float* Vector3AoSoA::getY(const size_t index) const
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_y + index % BLOCK_SIZE;
+    }
+
+    inline float* Vector3AoSoA::getZ(const size_t index)
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_z + index % BLOCK_SIZE;
+    }
+
+    inline const float* Vector3AoSoA::getZ(const size_t index) const
+    {
+        return m_blocks.data()[index / BLOCK_SIZE].m_z + index % BLOCK_SIZE;
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void add(const Left& left, const Right& right, Out& out)
+    {
+        Details::componentWise(left, right, out, [](const auto a, const auto b)
+        {
+            return Details::packAdd(a, b);
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void subtract(const Left& left, const Right& right, Out& out)
+    {
+        Details::componentWise(left, right, out, [](const auto a, const auto b)
+        {
+            return Details::packSub(a, b);
+        });
+    }
+
+    template <Vector3Stream Stream, Vector3Stream Out>
+    void scale(const Stream& vectors, const float factor, Out& out)
+    {
+        out.resize(vectors.size());
+
+        Details::forEachPack(vectors.size(), [&vectors, &out, factor]<class Pack>(const size_t i)
+        {
+            const Pack factors = Details::broadcastPack<Pack>(factor);
+
+            Details::storePack(out.getX(i), Details::packMul(Details::loadPack<Pack>(vectors.getX(i)), factors));
+            Details::storePack(out.getY(i), Details::packMul(Details::loadPack<Pack>(vectors.getY(i)), factors));
+            Details::storePack(out.getZ(i), Details::packMul(Details::loadPack<Pack>(vectors.getZ(i)), factors));
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right>
+    void dot(const Left& left, const Right& right, const std::span<float> out)
+    {
+        assert(left.size() == right.size() && left.size() == out.size() && "Invalid stream operation - sizes differ");
+
+        Details::forEachPack(out.size(), [&left, &right, out]<class Pack>(const size_t i)
+        {
+            Details::storePack(out.data() + i, Details::dot(
+                Details::loadPack<Pack>(left.getX(i)), Details::loadPack<Pack>(left.getY(i)), Details::loadPack<Pack>(left.getZ(i)),
+                Details::loadPack<Pack>(right.getX(i)), Details::loadPack<Pack>(right.getY(i)), Details::loadPack<Pack>(right.getZ(i))));
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void cross(const Left& left, const Right& right, Out& out)
+    {
+        assert(left.size() == right.size() && "Invalid stream operation - operand sizes differ");
+        out.resize(left.size());
+
+        Details::forEachPack(left.size(), [&left, &right, &out]<class Pack>(const size_t i)
+        {
+            const Pack leftX  = Details::loadPack<Pack>(left.getX(i));
+            const Pack leftY  = Details::loadPack<Pack>(left.getY(i));
+            const Pack leftZ  = Details::loadPack<Pack>(left.getZ(i));
+            const Pack rightX = Details::loadPack<Pack>(right.getX(i));
+            const Pack rightY = Details::loadPack<Pack>(right.getY(i));
+            const Pack rightZ = Details::loadPack<Pack>(right.getZ(i));
+
+            Details::storePack(out.getX(i), Details::packSub(Details::packMul(leftY, rightZ), Details::packMul(leftZ, rightY)));
+            Details::storePack(out.getY(i), Details::packSub(Details::packMul(leftZ, rightX), Details::packMul(leftX, rightZ)));
+            Details::storePack(out.getZ(i), Details::packSub(Details::packMul(leftX, rightY), Details::packMul(leftY, rightX)));
+        });
+    }
+
+    template <Vector3Stream Stream>
+    void magnitude(const Stream& vectors, const std::span<float> out)
+    {
+        assert(vectors.size() == out.size() && "Invalid stream operation - sizes differ");
+
+        Details::forEachPack(out.size(), [&vectors, out]<class Pack>(const size_t i)
+        {
+            const Pack x = Details::loadPack<Pack>(vectors.getX(i));
+            const Pack y = Details::loadPack<Pack>(vectors.getY(i));
+            const Pack z = Details::loadPack<Pack>(vectors.getZ(i));
+
+            Details::storePack(out.data() + i, Details::packSqrt(Details::dot(x, y, z, x, y, z)));
+        });
+    }
+
+    template <Vector3Stream Stream, Vector3Stream Out>
+    void normalize(const Stream& vectors, Out& out)
+    {
+        out.resize(vectors.size());
+
+        Details::forEachPack(vectors.size(), [&vectors, &out]<class Pack>(const size_t i)
+        {
+            const Pack x         = Details::loadPack<Pack>(vectors.getX(i));
+            const Pack y         = Details::loadPack<Pack>(vectors.getY(i));
+            const Pack z         = Details::loadPack<Pack>(vectors.getZ(i));
+            const Pack scale = Details::packInverseSqrt(Details::dot(x, y, z, x, y, z), EPrecision::BALANCED);
+
+            Details::storePack(out.getX(i), Details::packMul(x, scale));
+            Details::storePack(out.getY(i), Details::packMul(y, scale));
+            Details::storePack(out.getZ(i), Details::packMul(z, scale));
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right>
+    void distance(const Left& left, const Right& right, const std::span<float> out)
+    {
+        assert(left.size() == right.size() && left.size() == out.size() && "Invalid stream operation - sizes differ");
+
+        Details::forEachPack(out.size(), [&left, &right, out]<class Pack>(const size_t i)
+        {
+            const Pack x = Details::packSub(Details::loadPack<Pack>(right.getX(i)), Details::loadPack<Pack>(left.getX(i)));
+            const Pack y = Details::packSub(Details::loadPack<Pack>(right.getY(i)), Details::loadPack<Pack>(left.getY(i)));
+            const Pack z = Details::packSub(Details::loadPack<Pack>(right.getZ(i)), Details::loadPack<Pack>(left.getZ(i)));
+
+            Details::storePack(out.data() + i, Details::packSqrt(Details::dot(x, y, z, x, y, z)));
+        });
+    }
+
+    template <Vector3Stream From, Vector3Stream To, Vector3Stream Out>
+    void lerp(const From& from, const To& to, const float alpha, Out& out)
+    {
+        Details::componentWise(from, to, out, [alpha](const auto a, const auto b)
+        {
+            using Pack = std::remove_const_t<decltype(a)>;
+            return Details::packAdd(a, Details::packMul(Details::packSub(b, a), Details::broadcastPack<Pack>(alpha)));
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void min(const Left& left, const Right& right, Out& out)
+    {
+        Details::componentWise(left, right, out, [](const auto a, const auto b)
+        {
+            return Details::packMin(a, b);
+        });
+    }
+
+    template <Vector3Stream Left, Vector3Stream Right, Vector3Stream Out>
+    void max(const Left& left, const Right& right, Out& out)
+    {
+        Details::componentWise(left, right, out, [](const auto a, const auto b)
+        {
+            return Details::packMax(a, b);
+        });
+    }
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR3SOA_INL__
@@ -3,7 +3,12 @@
 
 #include <string>
 
+#include "Aligned.h"
 #include "Arithmetic.h"
+#include "Format.h"
+#include "Hash.h"
+
+#include "Vector/TVector.h"
 
 namespace LibMath
 {
@@ -15,10 +20,11 @@ namespace LibMath
     template <class T>
     class TQuaternion;
 
+    // Single precision vectors are 16 bytes aligned to be loaded in one SSE register
     template <class T>
-    class TVector4
+    class alignas(std::is_same_v<T, float> ? 16 : alignof(T)) TVector4
     {
-        static_assert(std::is_arithmetic_v<T>, "Invalid vector - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<T>, "Invalid vector - Data type should be an arithmetic or packet type");
 
     public:
         /**
@@ -265,7 +271,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is greater than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is greater than the other's. False otherwise
+         * \return True if this vector's magnitude is greater than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isLongerThan(const TVector4<U>& other) const;
@@ -274,7 +280,7 @@ namespace LibMath
          * \brief Checks whether this vector's magnitude is smaller than the given one's
          * \tparam U The other vector's data type
          * \param other The vector of which magnitude should be compared to this one
-         * \return True if this vector's magnitude is smaller than the other's. False otherwise
+         * \return True if this vector's magnitude is smaller than the other's (in all lanes for packets). False otherwise
          */
         template <class U>
         constexpr bool isShorterThan(const TVector4<U>& other) const;
@@ -326,7 +332,7 @@ namespace LibMath
         /**
          * \brief Rotates this vector using the given quaternion
          * \tparam U The quaternion's data type
-         * \param quaternion The quaternion rotor
+         * \param quaternion The quaternion rotor. Should be a unit quaternion
          */
         template <class U>
         void rotate(const TQuaternion<U>& quaternion);
@@ -389,7 +395,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater magnitude. False otherwise
+     * \return True if the left vector has a greater magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>(const TVector4<T>& left, const TVector4<U>& right);
@@ -400,7 +406,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller magnitude. False otherwise
+     * \return True if the left vector has a smaller magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<(const TVector4<T>& left, const TVector4<U>& right);
@@ -411,7 +417,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a greater or equal magnitude. False otherwise
+     * \return True if the left vector has a greater or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator>=(const TVector4<T>& left, const TVector4<U>& right);
@@ -422,7 +428,7 @@ namespace LibMath
      * \tparam U The right vector's data type
      * \param left The left vector
      * \param right The right vector
-     * \return True if the left vector has a smaller or equal magnitude. False otherwise
+     * \return True if the left vector has a smaller or equal magnitude (in all lanes for packets). False otherwise
      */
     template <class T, class U>
     constexpr bool operator<=(const TVector4<T>& left, const TVector4<U>& right);
@@ -488,7 +494,7 @@ namespace LibMath
      * \param vector The vector to add the value to
      * \return The vector with the value added to all its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator+(TVector4<T> vector, U value);
 
     /**
@@ -499,7 +505,7 @@ namespace LibMath
      * \param vector The vector to subtract the value from
      * \return The vector with the value subtracted from all of its components
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator-(TVector4<T> vector, U value);
 
     /**
@@ -510,7 +516,7 @@ namespace LibMath
      * \param scalar The scalar to multiply by
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator*(TVector4<T> vector, U scalar);
 
     /**
@@ -521,7 +527,7 @@ namespace LibMath
      * \param vector The vector to multiply
      * \return The vector multiplied by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<U> operator*(U scalar, TVector4<T> vector);
 
     /**
@@ -532,7 +538,7 @@ namespace LibMath
      * \param vector The vector to divide
      * \return The vector divided by the scalar
      */
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator/(TVector4<T> vector, U scalar);
 
     /**
@@ -555,69 +561,66 @@ namespace LibMath
     template <class T>
     std::istream& operator>>(std::istream& stream, TVector4<T>& vector);
 
-#define VEC4_ALIAS_IMPL(DataType, Alias)                                             \
-    using Alias = TVector4<DataType>;                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias clamp<Alias>(const Alias value, const Alias a, const Alias b)       \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            clamp(value.m_x, a.m_x, b.m_x),                                          \
-            clamp(value.m_y, a.m_y, b.m_y),                                          \
-            clamp(value.m_z, a.m_z, b.m_z),                                          \
-            clamp(value.m_w, a.m_w, b.m_w)                                           \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias snap<Alias>(const Alias value, const Alias a, const Alias b)        \
-    {                                                                                \
-        return                                                                       \
-        {                                                                            \
-            snap(value.m_x, a.m_x, b.m_x),                                           \
-            snap(value.m_y, a.m_y, b.m_y),                                           \
-            snap(value.m_z, a.m_z, b.m_z),                                           \
-            snap(value.m_w, a.m_w, b.m_w)                                            \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    constexpr bool isInRange<Alias>(const Alias value, const Alias a, const Alias b) \
-    {                                                                                \
-        return isInRange(value.m_x, a.m_x, b.m_x)                                    \
-            && isInRange(value.m_y, a.m_y, b.m_y)                                    \
-            && isInRange(value.m_z, a.m_z, b.m_z)                                    \
-            && isInRange(value.m_w, a.m_w, b.m_w);                                   \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias min<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            min(a.m_x, b.m_x),                                                       \
-            min(a.m_y, b.m_y),                                                       \
-            min(a.m_z, b.m_z),                                                       \
-            min(a.m_w, b.m_w)                                                        \
-        };                                                                           \
-    }                                                                                \
-                                                                                     \
-    template <>                                                                      \
-    inline Alias max<Alias>(const Alias a, const Alias b)                            \
-    {                                                                                \
-        return {                                                                     \
-            max(a.m_x, b.m_x),                                                       \
-            max(a.m_y, b.m_y),                                                       \
-            max(a.m_z, b.m_z),                                                       \
-            max(a.m_w, b.m_w)                                                        \
-        };                                                                           \
-    }
-
-    VEC4_ALIAS_IMPL(float, Vector4F)
-    VEC4_ALIAS_IMPL(double, Vector4D)
-    VEC4_ALIAS_IMPL(int, Vector4I)
-    VEC4_ALIAS_IMPL(long, Vector4L)
+    /**
+     * \brief Writes the vector's string representation to the given buffer without allocating
+     * \tparam T The vector's data type
+     * \param first The output buffer's start
+     * \param last The output buffer's end
+     * \param vector The vector to write
+     * \return The end of the written characters. std::errc::value_too_large if the buffer is too small
+     */
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector4<T>& vector);
+
+    /**
+     * \brief Parses a vector from the start of the given text (e.g. "{1, 2.5, -3, 0.5}")
+     * \tparam T The vector's data type
+     * \param text The text to parse
+     * \param vector The output vector. Left unchanged if the text is invalid
+     * \return The end of the parsed text and the parsing error if any
+     */
+    template <class T>
+    std::from_chars_result parse(std::string_view text, TVector4<T>& vector);
+
+    VECTOR_ALIAS_IMPL(4, float, Vector4F)
+    VECTOR_ALIAS_IMPL(4, double, Vector4D)
+    VECTOR_ALIAS_IMPL(4, int, Vector4I)
+    VECTOR_ALIAS_IMPL(4, long, Vector4L)
     using Vector4 = TVector4<float>;
+
+    // 16 bytes aligned variant for aligned SIMD loads and stores (Vector4 itself is now 16 bytes aligned - kept for compatibility)
+    using Vector4A = TAligned<Vector4, 16>;
+
+    static_assert(std::is_trivially_copyable_v<Vector4> && std::is_standard_layout_v<Vector4>,
+        "Invalid Vector4 - should be trivially copyable and standard layout");
+    static_assert(std::is_trivially_copyable_v<Vector4A> && std::is_standard_layout_v<Vector4A>,
+        "Invalid Vector4A - should be trivially copyable and standard layout");
+}
+
+namespace std
+{
+    /**
+     * \brief Hashes integer vectors component-wise (e.g. to use grid cells as unordered container keys)
+     * \note Floating point vectors aren't hashable - their approximate operator== can't be matched by a consistent hash
+     */
+    template <class T>
+        requires std::is_integral_v<T>
+    struct hash<LibMath::TVector4<T>>
+    {
+        size_t operator()(const LibMath::TVector4<T>& vector) const noexcept;
+    };
+
+#ifdef __cpp_lib_format
+    /**
+     * \brief Formats vectors like string(). The format specification applies to each component (e.g. "{:.2f}")
+     */
+    template <class T>
+    struct formatter<LibMath::TVector4<T>, char> : LibMath::Details::TComponentsFormatter<T>
+    {
+        template <class FormatContext>
+        auto format(const LibMath::TVector4<T>& vector, FormatContext& context) const;
+    };
+#endif // __cpp_lib_format
 }
 
 #include "Vector/Vector4.inl"
@@ -1,7 +1,10 @@
 #ifndef __LIBMATH__VECTOR__VECTOR4_INL__
 #define __LIBMATH__VECTOR__VECTOR4_INL__
 
+#include <type_traits>
+
 #include "Quaternion.h"
+#include "Simd.h"
 
 #include "Angle/Radian.h"
 
@@ -76,7 +79,7 @@ namespace LibMath
     constexpr TVector4<T>::TVector4(const TVector3<U>& other, const W w)
         : m_x(static_cast<T>(other.m_x)), m_y(static_cast<T>(other.m_y)), m_z(static_cast<T>(other.m_z)), m_w(static_cast<T>(w))
     {
-        static_assert(std::is_arithmetic_v<W>, "Invalid value - Data type should be an arithmetic type");
+        static_assert(Details::IS_SCALAR<W>, "Invalid value - Data type should be an arithmetic or packet type");
     }
 
     template <class T>
@@ -97,14 +100,13 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator=(const TVector4<U>& other)
     {
-        if (reinterpret_cast<const TVector4*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
-        m_z = static_cast<T>(other.m_z);
-        m_w = static_cast<T>(other.m_w);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -112,14 +114,13 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator=(TVector4<U>&& other)
     {
-        if (reinterpret_cast<const TVector4*>(&other) == this)
-            return *this;
-
-        m_x = static_cast<T>(other.m_x);
-        m_y = static_cast<T>(other.m_y);
-        m_z = static_cast<T>(other.m_z);
-        m_w = static_cast<T>(other.m_w);
+        if constexpr (std::is_same_v<T, U>)
+        {
+            if (&other == this)
+                return *this;
+        }
 
+        Details::assignComponents(*this, other);
         return *this;
     }
 
@@ -159,11 +160,7 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator+=(const TVector4<U>& other)
     {
-        this->m_x += static_cast<T>(other.m_x);
-        this->m_y += static_cast<T>(other.m_y);
-        this->m_z += static_cast<T>(other.m_z);
-        this->m_w += static_cast<T>(other.m_w);
-
+        Details::addComponents(*this, other);
         return *this;
     }
 
@@ -171,11 +168,7 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator-=(const TVector4<U>& other)
     {
-        this->m_x -= static_cast<T>(other.m_x);
-        this->m_y -= static_cast<T>(other.m_y);
-        this->m_z -= static_cast<T>(other.m_z);
-        this->m_w -= static_cast<T>(other.m_w);
-
+        Details::subtractComponents(*this, other);
         return *this;
     }
 
@@ -183,11 +176,7 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator*=(const TVector4<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x * other.m_x);
-        this->m_y = static_cast<T>(this->m_y * other.m_y);
-        this->m_z = static_cast<T>(this->m_z * other.m_z);
-        this->m_w = static_cast<T>(this->m_w * other.m_w);
-
+        Details::multiplyComponents(*this, other);
         return *this;
     }
 
@@ -195,11 +184,7 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator/=(const TVector4<U>& other)
     {
-        this->m_x = static_cast<T>(this->m_x / other.m_x);
-        this->m_y = static_cast<T>(this->m_y / other.m_y);
-        this->m_z = static_cast<T>(this->m_z / other.m_z);
-        this->m_w = static_cast<T>(this->m_w / other.m_w);
-
+        Details::divideComponents(*this, other);
         return *this;
     }
 
@@ -207,13 +192,9 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator+=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x += static_cast<T>(value);
-        this->m_y += static_cast<T>(value);
-        this->m_z += static_cast<T>(value);
-        this->m_w += static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::addScalar(*this, value);
         return *this;
     }
 
@@ -221,13 +202,9 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator-=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x -= static_cast<T>(value);
-        this->m_y -= static_cast<T>(value);
-        this->m_z -= static_cast<T>(value);
-        this->m_w -= static_cast<T>(value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::subtractScalar(*this, value);
         return *this;
     }
 
@@ -235,13 +212,9 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator*=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x * value);
-        this->m_y = static_cast<T>(this->m_y * value);
-        this->m_z = static_cast<T>(this->m_z * value);
-        this->m_w = static_cast<T>(this->m_w * value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::multiplyScalar(*this, value);
         return *this;
     }
 
@@ -249,13 +222,9 @@ namespace LibMath
     template <class U>
     constexpr TVector4<T>& TVector4<T>::operator/=(U value)
     {
-        static_assert(std::is_arithmetic_v<U>, "Invalid value - Data type should be an arithmetic type");
-
-        this->m_x = static_cast<T>(this->m_x / value);
-        this->m_y = static_cast<T>(this->m_y / value);
-        this->m_z = static_cast<T>(this->m_z / value);
-        this->m_w = static_cast<T>(this->m_w / value);
+        static_assert(Details::IS_SCALAR<U>, "Invalid value - Data type should be an arithmetic or packet type");
 
+        Details::divideScalar(*this, value);
         return *this;
     }
 
@@ -288,29 +257,24 @@ namespace LibMath
     template <class U>
     constexpr T TVector4<T>::distanceSquaredFrom(const TVector4<U>& other) const
     {
-        const T xDist = other.m_x - this->m_x;
-        const T yDist = other.m_y - this->m_y;
-        const T zDist = other.m_z - this->m_z;
-        const T wDist = other.m_w - this->m_w;
-
-        return xDist * xDist + yDist * yDist + zDist * zDist + wDist * wDist;
+        return Details::distanceSquaredComponents(*this, other);
     }
 
     template <class T>
     template <class U>
     constexpr T TVector4<T>::dot(const TVector4<U>& other) const
     {
-        return static_cast<T>(this->m_x * other.m_x +
-            this->m_y * other.m_y +
-            this->m_z * other.m_z +
-            this->m_w * other.m_w);
+        return Details::dotComponents(*this, other);
     }
 
     template <class T>
     template <class U>
     constexpr bool TVector4<T>::isLongerThan(const TVector4<U>& other) const
     {
-        return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
+        if constexpr (Details::IS_PACKET<T>)
+            return all(this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared()));
+        else
+            return this->magnitudeSquared() > static_cast<T>(other.magnitudeSquared());
     }
 
     template <class T>
@@ -335,22 +299,25 @@ namespace LibMath
     template <class T>
     constexpr T TVector4<T>::magnitudeSquared() const
     {
-        return this->m_x * this->m_x +
-            this->m_y * this->m_y +
-            this->m_z * this->m_z +
-            this->m_w * this->m_w;
+        return Details::magnitudeSquaredComponents(*this);
     }
 
     template <class T>
     void TVector4<T>::normalize()
     {
-        *this /= this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            *this *= inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            *this /= this->magnitude();
     }
 
     template <class T>
     constexpr TVector4<T> TVector4<T>::normalized() const
     {
-        return *this / this->magnitude();
+        if constexpr (std::is_floating_point_v<T> || Details::IS_PACKET<T>)
+            return *this * inverseSquareRoot(this->magnitudeSquared(), EPrecision::BALANCED);
+        else
+            return *this / this->magnitude();
     }
 
     template <class T>
@@ -371,12 +338,11 @@ namespace LibMath
     template <class U>
     void TVector4<T>::rotate(const TQuaternion<U>& quaternion)
     {
-        TQuaternion<U> tmp{ m_w, this->xyz() };
-        tmp = quaternion * tmp * quaternion.inverse();
-        m_x = tmp.m_x;
-        m_y = tmp.m_y;
-        m_z = tmp.m_z;
-        m_w = tmp.m_w;
+        // The rotation leaves the w component untouched
+        const TVector3<T> rotated = quaternion.rotate(this->xyz());
+        m_x                       = rotated.m_x;
+        m_y                       = rotated.m_y;
+        m_z                       = rotated.m_z;
     }
 
     template <class T>
@@ -394,32 +360,32 @@ namespace LibMath
     template <class T>
     std::string TVector4<T>::string() const
     {
-        std::ostringstream oss;
-
-        oss << "{" << this->m_x << "," << this->m_y
-            << "," << this->m_z << "," << this->m_w << "}";
+        char buffer[4 * Details::MAX_COMPONENT_CHARS + 5];
 
-        return oss.str();
+        const std::to_chars_result result = formatTo(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, result.ptr);
     }
 
     template <class T>
     std::string TVector4<T>::stringLong() const
     {
-        std::ostringstream oss;
+        std::string str = "Vector4{ x:";
+        Details::appendComponent(str, this->m_x);
+        str += ", y:";
+        Details::appendComponent(str, this->m_y);
+        str += ", z:";
+        Details::appendComponent(str, this->m_z);
+        str += ", w:";
+        Details::appendComponent(str, this->m_w);
+        str += " }";
 
-        oss << "Vector4{ x:" << this->m_x << ", y:" << this->m_y
-            << ", z:" << this->m_z << ", w:" << this->m_w << " }";
-
-        return oss.str();
+        return str;
     }
 
     template <class T, class U>
     constexpr bool operator==(const TVector4<T>& left, const TVector4<U>& right)
     {
-        return floatEquals(left.m_x, static_cast<T>(right.m_x)) &&
-            floatEquals(left.m_y, static_cast<T>(right.m_y)) &&
-            floatEquals(left.m_z, static_cast<T>(right.m_z)) &&
-            floatEquals(left.m_w, static_cast<T>(right.m_w));
+        return Details::componentsEqual(left, right);
     }
 
     template <class T, class U>
@@ -443,19 +409,27 @@ namespace LibMath
     template <class T, class U>
     constexpr bool operator>=(const TVector4<T>& left, const TVector4<U>& right)
     {
-        return !(left < right);
+        // Negating "<" would hold as soon as a single lane isn't shorter
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() >= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left < right);
     }
 
     template <class T, class U>
     constexpr bool operator<=(const TVector4<T>& left, const TVector4<U>& right)
     {
-        return !(left > right);
+        // Negating ">" would hold as soon as a single lane isn't longer
+        if constexpr (Details::IS_PACKET<T>)
+            return all(left.magnitudeSquared() <= static_cast<T>(right.magnitudeSquared()));
+        else
+            return !(left > right);
     }
 
     template <class T>
     constexpr TVector4<T> operator-(const TVector4<T>& vector)
     {
-        return { -vector.m_x, -vector.m_y, -vector.m_z, -vector.m_w };
+        return Details::negateComponents(vector);
     }
 
     template <class T, class U>
@@ -482,31 +456,31 @@ namespace LibMath
         return left /= right;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator+(TVector4<T> vector, U value)
     {
         return vector += value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator-(TVector4<T> vector, U value)
     {
         return vector -= value;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator*(TVector4<T> vector, U scalar)
     {
         return vector *= scalar;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<U> operator*(U scalar, TVector4<T> vector)
     {
         return vector *= scalar;
     }
 
-    template <class T, class U>
+    template <class T, class U> requires Details::IS_SCALAR<U>
     constexpr TVector4<T> operator/(TVector4<T> vector, U scalar)
     {
         return vector /= scalar;
@@ -525,34 +499,55 @@ namespace LibMath
 
         std::getline(stream, line, '}');
 
-        int    component = 0;
-        size_t valStart  = 0;
+        T values[4];
 
-        do
-        {
-            if (valStart == std::string::npos)
-                break;
+        if (Details::parseComponentList(line.data(), line.data() + line.size(), values, 4).ec == std::errc())
+            vector = TVector4<T>(values[0], values[1], values[2], values[3]);
+        else
+            vector = TVector4<T>::zero();
 
-            if (line[valStart] == '{' || std::isspace(line[valStart]))
-            {
-                valStart++;
-                continue;
-            }
+        return stream;
+    }
 
-            if (line[valStart] != '-' && !std::isdigit(line[valStart]))
-                break;
+    template <class T>
+    std::to_chars_result formatTo(char* first, char* last, const TVector4<T>& vector)
+    {
+        const T values[] = { vector.m_x, vector.m_y, vector.m_z, vector.m_w };
+        return Details::formatComponents(first, last, values, 4);
+    }
 
-            vector[component] = std::stof(line.substr(valStart));
+    template <class T>
+    std::from_chars_result parse(const std::string_view text, TVector4<T>& vector)
+    {
+        T values[4];
 
-            valStart = line.find(',', valStart) + 1;
-            component++;
-        } while (component < 4 && valStart != 0);
+        const std::from_chars_result result = Details::parseComponents(text.data(), text.data() + text.size(), values, 4);
 
-        if (component != 4)
-            vector = TVector4<T>::zero();
+        if (result.ec == std::errc())
+            vector = TVector4<T>(values[0], values[1], values[2], values[3]);
 
-        return stream;
+        return result;
+    }
+}
+
+namespace std
+{
+    template <class T>
+        requires std::is_integral_v<T>
+    size_t hash<LibMath::TVector4<T>>::operator()(const LibMath::TVector4<T>& vector) const noexcept
+    {
+        return static_cast<size_t>(LibMath::Details::hashComponents(vector));
+    }
+
+#ifdef __cpp_lib_format
+    template <class T>
+    template <class FormatContext>
+    auto formatter<LibMath::TVector4<T>, char>::format(const LibMath::TVector4<T>& vector, FormatContext& context) const
+    {
+        const T values[] = { vector.m_x, vector.m_y, vector.m_z, vector.m_w };
+        return this->formatComponents(values, 4, context);
     }
+#endif // __cpp_lib_format
 }
 
 #endif // !__LIBMATH__VECTOR__VECTOR4_INL__
@@ -409,5 +409,13 @@ TEST_CASE("Radian", "[.all][angle]")
 
         LibMath::Degree degree{ LibMath::Radian{ 1.2f } };
         CHECK(degree.raw() == Catch::Approx(glm::degrees(1.2f)));
+
+        // Conversions and trigonometry can be evaluated at compile time
+        constexpr LibMath::Radian constRadian{ LibMath::Degree{ 60.f } };
+        STATIC_CHECK(LibMath::abs(constRadian.raw() - 1.04719755f) < 1e-6f);
+        STATIC_CHECK(LibMath::abs(LibMath::Degree(LibMath::acos(.5f)).raw() - 60.f) < 1e-4f);
+        STATIC_CHECK(LibMath::abs(LibMath::Degree(LibMath::atan(-1.f, -1.f)).degree(true) + 135.f) < 1e-4f);
+        STATIC_CHECK(LibMath::abs(LibMath::sin(LibMath::Degree{ 30.f }) - .5f) < 1e-7f);
+        STATIC_CHECK(LibMath::abs(LibMath::cos(constRadian) - .5f) < 1e-7f);
     }
 }
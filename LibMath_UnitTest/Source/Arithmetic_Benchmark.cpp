@@ -0,0 +1,152 @@
+#include <Arithmetic.h>
+#include <ArithmeticBatch.h>
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+TEST_CASE("Arithmetic benchmark", "[.benchmark][arithmetic]")
+{
+    using LibMath::EPrecision;
+
+    constexpr size_t size = 4096;
+
+    std::vector<float> powers(size);
+    std::vector<float> values(size);
+    std::vector<float> out(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        powers[i] = (static_cast<float>(i) - static_cast<float>(size) * .5f) * .0213f;
+        values[i] = (static_cast<float>(i) + .5f) / static_cast<float>(size);
+    }
+
+    // Accuracy report - max relative error against the double precision standard library
+    for (const EPrecision precision : { EPrecision::FAST, EPrecision::BALANCED, EPrecision::PRECISE })
+    {
+        double maxExpError = 0, maxLogError = 0, maxPowError = 0;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const double exp = std::exp(static_cast<double>(powers[i]));
+            const double log = std::log(static_cast<double>(values[i]));
+            const double pow = std::pow(static_cast<double>(values[i]), static_cast<double>(2.2f));
+
+            maxExpError = std::max(maxExpError, std::abs(LibMath::exp(powers[i], precision) - exp) / exp);
+            maxLogError = std::max(maxLogError, std::abs(LibMath::log(values[i], precision) - log) / std::abs(log));
+            maxPowError = std::max(maxPowError, std::abs(LibMath::pow(values[i], 2.2f, precision) - pow) / pow);
+        }
+
+        const char* names[] = { "FAST", "BALANCED", "PRECISE" };
+
+        std::ostringstream report;
+        report << names[static_cast<int>(precision)] << " max relative error - exp: " << maxExpError << " log: " << maxLogError
+            << " pow: " << maxPowError;
+        WARN(report.str());
+    }
+
+    BENCHMARK("std::exp (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = std::exp(powers[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("exp BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::exp(powers[i], EPrecision::BALANCED);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("exp FAST (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::exp(powers[i], EPrecision::FAST);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("exp batch BALANCED (4096)")
+    {
+        LibMath::exp(powers, out, EPrecision::BALANCED);
+        return out[size - 1];
+    };
+
+    BENCHMARK("exp batch FAST (4096)")
+    {
+        LibMath::exp(powers, out, EPrecision::FAST);
+        return out[size - 1];
+    };
+
+    BENCHMARK("std::log (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = std::log(values[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("log BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::log(values[i], EPrecision::BALANCED);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("log batch BALANCED (4096)")
+    {
+        LibMath::log(values, out, EPrecision::BALANCED);
+        return out[size - 1];
+    };
+
+    BENCHMARK("std::pow (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = std::pow(values[i], 2.2f);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("pow BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::pow(values[i], 2.2f, EPrecision::BALANCED);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("pow batch BALANCED (4096)")
+    {
+        LibMath::pow(values, 2.2f, out, EPrecision::BALANCED);
+        return out[size - 1];
+    };
+
+    BENCHMARK("pow batch FAST (4096)")
+    {
+        LibMath::pow(values, 2.2f, out, EPrecision::FAST);
+        return out[size - 1];
+    };
+
+    BENCHMARK("pow(value, 13) (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::pow(values[i] + 1.f, 13);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("pow<13>(value) (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::pow<13>(values[i] + 1.f);
+
+        return out[size - 1];
+    };
+}
@@ -1,4 +1,9 @@
 #include <Arithmetic.h>
+#include <ArithmeticBatch.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
@@ -30,6 +35,40 @@ TEST_CASE("Arithmetic", "[.all][arithmetic]")
     CHECK(LibMath::squareRoot(val * .01f) == Catch::Approx(glm::sqrt(val * .01f)));
     CHECK(LibMath::squareRoot(val * .001f) == Catch::Approx(glm::sqrt(val * .001f)));
 
+    CHECK(LibMath::squareRoot(0.f) == 0.f);
+    CHECK(LibMath::squareRoot(1e-6f) == Catch::Approx(glm::sqrt(1e-6f)));
+    CHECK(LibMath::squareRoot(1e30f) == Catch::Approx(glm::sqrt(1e30f)));
+    CHECK(LibMath::squareRoot(2.0) == Catch::Approx(glm::sqrt(2.0)));
+    CHECK(std::isnan(LibMath::squareRoot(-val)));
+
+    // Constant evaluation uses the babylonian approximation
+    static_assert(LibMath::floatEquals(LibMath::squareRoot(4.f), 2.f));
+    static_assert(LibMath::floatEquals(LibMath::squareRoot(2.f), 1.41421356f));
+    static_assert(LibMath::floatEquals(LibMath::inverseSquareRoot(4.f), .5f));
+
+    for (const float value : { val, val * .01f, val * 20.f, 1e-6f, 1e6f })
+    {
+        const float expected = 1.f / std::sqrt(value);
+
+        CHECK(LibMath::inverseSquareRoot(value) == Catch::Approx(expected));
+        CHECK(LibMath::inverseSquareRoot(value, LibMath::EPrecision::BALANCED) == Catch::Approx(expected).epsilon(1e-6));
+        CHECK(LibMath::inverseSquareRoot(value, LibMath::EPrecision::FAST) == Catch::Approx(expected).epsilon(4e-4));
+    }
+
+    for (const LibMath::EPrecision precision : { LibMath::EPrecision::FAST, LibMath::EPrecision::BALANCED, LibMath::EPrecision::PRECISE })
+    {
+        CHECK(LibMath::inverseSquareRoot(0.f, precision) == std::numeric_limits<float>::infinity());
+        CHECK(LibMath::inverseSquareRoot(std::numeric_limits<float>::infinity(), precision) == 0.f);
+        CHECK(std::isnan(LibMath::inverseSquareRoot(-val, precision)));
+
+        // Subnormals are out of the hardware estimate's range
+        for (const float value : { 1e-40f, std::numeric_limits<float>::denorm_min() })
+        {
+            const auto expected = static_cast<float>(1. / std::sqrt(static_cast<double>(value)));
+            CHECK(LibMath::inverseSquareRoot(value, precision) == Catch::Approx(expected).epsilon(4e-4));
+        }
+    }
+
     CHECK(LibMath::pow(val, 3) == Catch::Approx(glm::pow(val, 3)));
     CHECK(LibMath::pow(val, 2) == Catch::Approx(glm::pow(val, 2)));
     CHECK(LibMath::pow(val, 1) == Catch::Approx(glm::pow(val, 1)));
@@ -65,3 +104,203 @@ TEST_CASE("Arithmetic", "[.all][arithmetic]")
     CHECK(!LibMath::floatEquals(10.00001f, 10.000001f, 1.f));
     CHECK(!LibMath::floatEquals(100.0001f, 100.00001f, 1.f));
 }
+
+TEST_CASE("Arithmetic powers", "[.all][arithmetic]")
+{
+    using LibMath::EPrecision;
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+
+    SECTION("Integer exponent")
+    {
+        static_assert(LibMath::pow(2, 10) == 1024);
+        static_assert(LibMath::pow(2.f, -3) == .125f);
+        static_assert(LibMath::pow(-3, 5) == -243);
+
+        CHECK(LibMath::pow(2.f, 31) == 2147483648.f);
+        CHECK(LibMath::pow(-2.f, 7) == -128.f);
+        CHECK(LibMath::pow(10.0, -4) == Catch::Approx(1e-4));
+        CHECK(LibMath::pow(1.0001, 10000) == Catch::Approx(std::pow(1.0001, 10000)));
+        CHECK(LibMath::pow(2.0, std::numeric_limits<int>::min()) == 0.0);
+
+        static_assert(LibMath::pow<0>(3) == 1);
+        static_assert(LibMath::pow<1>(3) == 3);
+        static_assert(LibMath::pow<13>(2) == 8192);
+        static_assert(LibMath::pow<-2>(2.f) == .25f);
+
+        const LibMath::Float4 packet = LibMath::Float4::load(std::vector<float>{ 1.f, 2.f, -3.f, .5f }.data());
+        const LibMath::Float4 cube   = LibMath::pow<3>(packet);
+
+        CHECK(cube[0] == 1.f);
+        CHECK(cube[1] == 8.f);
+        CHECK(cube[2] == -27.f);
+        CHECK(cube[3] == .125f);
+    }
+
+    SECTION("Exponential and logarithm")
+    {
+        // Constant evaluation uses double precision series
+        static_assert(LibMath::exp(0.f) == 1.f);
+        static_assert(LibMath::exp(1.f) == 2.71828175f);
+        static_assert(LibMath::exp2(10.f) == 1024.f);
+        static_assert(LibMath::exp2(-149.f) == std::numeric_limits<float>::denorm_min());
+        static_assert(LibMath::exp(100.f) == inf);
+        static_assert(LibMath::log(1.f) == 0.f);
+        static_assert(LibMath::log(10.f) == 2.30258512f);
+        static_assert(LibMath::log2(1024.f) == 10.f);
+        static_assert(LibMath::log(0.f) == -inf);
+
+        for (const float value : { -87.f, -20.f, -1.5f, -.3f, 0.f, .1f, 1.f, 2.5f, 10.f, 42.f, 88.f })
+        {
+            CHECK(LibMath::exp(value) == std::exp(value));
+            CHECK(LibMath::exp(value, EPrecision::BALANCED) == Catch::Approx(std::exp(value)).epsilon(3e-7));
+            CHECK(LibMath::exp(value, EPrecision::FAST) == Catch::Approx(std::exp(value)).epsilon(1e-4));
+
+            CHECK(LibMath::exp2(value) == std::exp2(value));
+            CHECK(LibMath::exp2(value, EPrecision::BALANCED) == Catch::Approx(std::exp2(value)).epsilon(3e-7));
+            CHECK(LibMath::exp2(value, EPrecision::FAST) == Catch::Approx(std::exp2(value)).epsilon(1e-4));
+        }
+
+        for (const float value : { 1e-40f, 1e-20f, .01f, .5f, .9f, 1.f, 1.1f, 2.f, 3.f, 1e10f, 3e38f })
+        {
+            CHECK(LibMath::log(value) == std::log(value));
+            CHECK(LibMath::log(value, EPrecision::BALANCED) == Catch::Approx(std::log(value)).epsilon(3e-7).margin(1e-7));
+            CHECK(LibMath::log(value, EPrecision::FAST) == Catch::Approx(std::log(value)).margin(2e-5));
+
+            CHECK(LibMath::log2(value) == std::log2(value));
+            CHECK(LibMath::log2(value, EPrecision::BALANCED) == Catch::Approx(std::log2(value)).epsilon(3e-7).margin(1e-7));
+            CHECK(LibMath::log2(value, EPrecision::FAST) == Catch::Approx(std::log2(value)).margin(2e-5));
+        }
+
+        for (const EPrecision precision : { EPrecision::FAST, EPrecision::BALANCED, EPrecision::PRECISE })
+        {
+            CHECK(LibMath::exp(inf, precision) == inf);
+            CHECK(LibMath::exp(-inf, precision) == 0.f);
+            CHECK(LibMath::exp(-200.f, precision) == 0.f);
+            CHECK(std::isnan(LibMath::exp(std::nanf(""), precision)));
+            CHECK(LibMath::exp2(-150.f, precision) == 0.f);
+            CHECK(LibMath::exp2(130.f, precision) == inf);
+
+            CHECK(LibMath::log(0.f, precision) == -inf);
+            CHECK(LibMath::log(inf, precision) == inf);
+            CHECK(std::isnan(LibMath::log(-1.f, precision)));
+            CHECK(std::isnan(LibMath::log2(std::nanf(""), precision)));
+            CHECK(LibMath::log2(1.f, precision) == 0.f);
+
+            CHECK(LibMath::exp(0.f, precision) == 1.f);
+            CHECK(LibMath::exp2(0.f, precision) == 1.f);
+        }
+    }
+
+    SECTION("Real exponent")
+    {
+        static_assert(LibMath::pow(4.f, .5f) == 2.f);
+        static_assert(LibMath::pow(-2.f, 3.f) == -8.f);
+        static_assert(LibMath::pow(2.f, .5f) == 1.41421354f);
+        static_assert(LibMath::pow(-1.f, inf) == 1.f);
+        static_assert(LibMath::pow(-1.f, -inf) == 1.f);
+        static_assert(LibMath::pow(-0.f, -3.f) == -inf);
+        static_assert(std::signbit(LibMath::pow(-0.f, 3.f)));
+        static_assert(LibMath::pow(-inf, .5f) == inf);
+
+        for (const float value : { 1e-3f, .2f, .5f, 1.f, 1.5f, 7.f, 100.f })
+        {
+            for (const float exponent : { -3.5f, -1.f, .4545f, 1.f, 2.2f, 10.f })
+            {
+                const float expected = std::pow(value, exponent);
+
+                CHECK(LibMath::pow(value, exponent) == expected);
+                CHECK(LibMath::pow(value, exponent, EPrecision::BALANCED) == Catch::Approx(expected).epsilon(5e-6));
+                CHECK(LibMath::pow(value, exponent, EPrecision::FAST) == Catch::Approx(expected).epsilon(5e-4));
+            }
+        }
+
+        for (const EPrecision precision : { EPrecision::FAST, EPrecision::BALANCED, EPrecision::PRECISE })
+        {
+            CHECK(LibMath::pow(0.f, 2.f, precision) == 0.f);
+            CHECK(LibMath::pow(0.f, -2.f, precision) == inf);
+            CHECK(LibMath::pow(std::nanf(""), 0.f, precision) == 1.f);
+            CHECK(LibMath::pow(1.f, std::nanf(""), precision) == 1.f);
+            CHECK(LibMath::pow(-2.f, 3.f, precision) == Catch::Approx(-8.f).epsilon(1e-4));
+            CHECK(LibMath::pow(-2.f, 4.f, precision) == Catch::Approx(16.f).epsilon(1e-4));
+            CHECK(std::isnan(LibMath::pow(-2.f, .5f, precision)));
+
+            // Special values from std::pow
+            CHECK(LibMath::pow(-1.f, inf, precision) == 1.f);
+            CHECK(LibMath::pow(-1.f, -inf, precision) == 1.f);
+            CHECK(LibMath::pow(-0.f, -3.f, precision) == -inf);
+            CHECK(LibMath::pow(-0.f, -2.f, precision) == inf);
+            CHECK(std::signbit(LibMath::pow(-0.f, 3.f, precision)));
+            CHECK(!std::signbit(LibMath::pow(-0.f, 2.f, precision)));
+            CHECK(LibMath::pow(-inf, 3.f, precision) == -inf);
+            CHECK(LibMath::pow(-inf, .5f, precision) == inf);
+            CHECK(LibMath::pow(-inf, -3.f, precision) == 0.f);
+        }
+    }
+
+    SECTION("Batch")
+    {
+        constexpr size_t size = 1027;
+
+        std::vector<float> powers(size);
+        std::vector<float> values(size);
+        std::vector<float> out(size);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            powers[i] = (static_cast<float>(i) - static_cast<float>(size) * .5f) * .17f;
+            values[i] = static_cast<float>(i) * .37f;
+        }
+
+        // Special values in both the packets and the scalar tail
+        values[5] = -1.f;
+        values[size - 1] = inf;
+
+        for (const EPrecision precision : { EPrecision::FAST, EPrecision::BALANCED, EPrecision::PRECISE })
+        {
+            LibMath::exp(powers, out, precision);
+
+            for (size_t i = 0; i < size; i++)
+                CHECK(out[i] == Catch::Approx(LibMath::exp(powers[i], precision)).epsilon(1e-6));
+
+            LibMath::exp2(powers, out, precision, LibMath::EExecutionPolicy::PARALLEL);
+
+            for (size_t i = 0; i < size; i++)
+                CHECK(out[i] == Catch::Approx(LibMath::exp2(powers[i], precision)).epsilon(1e-6));
+
+            LibMath::log(values, out, precision);
+
+            CHECK(std::isnan(out[5]));
+
+            for (size_t i = 0; i < size; i++)
+            {
+                if (i != 5)
+                    CHECK(out[i] == Catch::Approx(LibMath::log(values[i], precision)).epsilon(1e-6));
+            }
+
+            LibMath::log2(values, out, precision);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                if (i != 5)
+                    CHECK(out[i] == Catch::Approx(LibMath::log2(values[i], precision)).epsilon(1e-6));
+            }
+
+            LibMath::pow(values, 2.2f, out, precision);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                if (i != 5)
+                    CHECK(out[i] == Catch::Approx(LibMath::pow(values[i], 2.2f, precision)).epsilon(1e-6));
+            }
+
+            LibMath::pow(values, powers, out, precision);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                if (i != 5)
+                    CHECK(out[i] == Catch::Approx(LibMath::pow(values[i], powers[i], precision)).epsilon(1e-6));
+            }
+        }
+    }
+}
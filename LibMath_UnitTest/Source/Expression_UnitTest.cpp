@@ -0,0 +1,120 @@
+#include <Expression.h>
+#include <Matrix.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#define CHECK_MATRIX(matrix, expected) for (LibMath::length_t row = 0; row < (expected).getRowCount(); row++) \
+    for (LibMath::length_t col = 0; col < (expected).getColumnCount(); col++) \
+        CHECK((matrix)(row, col) == Catch::Approx((expected)(row, col)))
+
+#define CHECK_VECTOR3(vector, expected) CHECK((vector).m_x == Catch::Approx((expected).m_x)); CHECK((vector).m_y == Catch::Approx((expected).m_y)); CHECK((vector).m_z == Catch::Approx((expected).m_z))
+
+TEST_CASE("Expression", "[.all][expression]")
+{
+    LibMath::Matrix4 a;
+    LibMath::Matrix4 b;
+    LibMath::Matrix4 c;
+
+    for (LibMath::length_t row = 0; row < 4; row++)
+    {
+        for (LibMath::length_t col = 0; col < 4; col++)
+        {
+            a(row, col) = static_cast<float>(row * 4 + col) * .25f - 1.5f;
+            b(row, col) = static_cast<float>((row + 1) * (col + 3) % 5) * .5f - 1.f;
+            c(row, col) = static_cast<float>((row + 2) * (col + 1) % 7) - 3.f;
+        }
+    }
+
+    SECTION("Matrix")
+    {
+        // element-wise operations
+        LibMath::Matrix4 result = LibMath::lazy(a) + b - c;
+        CHECK_MATRIX(result, a + b - c);
+
+        result = LibMath::lazy(a) * 2.f - b / 4.f;
+        CHECK_MATRIX(result, a * 2.f - b / 4.f);
+
+        result = 3.f * LibMath::lazy(a) + -LibMath::lazy(c);
+        CHECK_MATRIX(result, a * 3.f - c);
+
+        // plain matrix on the left
+        result = b + LibMath::lazy(a) * .5f;
+        CHECK_MATRIX(result, b + a * .5f);
+
+        // products
+        result = LibMath::lazy(a) * b;
+        CHECK(result == a * b);
+
+        result = LibMath::lazy(a) * b + c;
+        CHECK_MATRIX(result, a * b + c);
+
+        result = (LibMath::lazy(a) + b) * (LibMath::lazy(c) - a) * 2.f;
+        CHECK_MATRIX(result, (a + b) * (c - a) * 2.f);
+
+        result = c - a * LibMath::lazy(b);
+        CHECK_MATRIX(result, c - a * b);
+
+        // aliasing on the product's operands is safe since they are evaluated first
+        result = a;
+        result = (LibMath::lazy(result) + b) * result;
+        CHECK_MATRIX(result, (a + b) * a);
+
+        // non-square products
+        LibMath::TMatrix<2, 3, float> left;
+        LibMath::TMatrix<3, 2, float> right;
+
+        for (LibMath::length_t row = 0; row < 2; row++)
+        {
+            for (LibMath::length_t col = 0; col < 3; col++)
+            {
+                left(row, col)  = static_cast<float>(row * 3 + col) - 2.f;
+                right(col, row) = static_cast<float>(col * 2 + row) * .5f + 1.f;
+            }
+        }
+
+        const LibMath::Matrix2 product = LibMath::lazy(left) * right * 2.f;
+        CHECK_MATRIX(product, left * right * 2.f);
+
+        // explicit evaluation
+        const auto evaluated = (LibMath::lazy(a) - b).evaluate();
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(evaluated)>, LibMath::Matrix4>);
+        CHECK_MATRIX(evaluated, a - b);
+
+        // compile-time evaluation
+        constexpr LibMath::Matrix3 identity(1.f);
+        constexpr LibMath::Matrix3 twice = LibMath::lazy(identity) + identity;
+        STATIC_CHECK(twice(1, 1) == 2.f);
+        STATIC_CHECK(twice(0, 1) == 0.f);
+    }
+
+    SECTION("Vector")
+    {
+        const LibMath::Vector3 u{ 1.5f, -2.f, .25f };
+        const LibMath::Vector3 v{ -.5f, 4.f, 3.f };
+        const LibMath::Vector3 w{ 2.f, .75f, -1.f };
+
+        LibMath::Vector3 result = LibMath::lazy(u) + v * 2.f - w;
+        CHECK_VECTOR3(result, u + v * 2.f - w);
+
+        result = (LibMath::lazy(u) - v) / 2.f + -LibMath::lazy(w);
+        CHECK_VECTOR3(result, (u - v) / 2.f - w);
+
+        result = .5f * LibMath::lazy(u) + LibMath::lazy(w) * 3.f;
+        CHECK_VECTOR3(result, u * .5f + w * 3.f);
+
+        // plain vector on the left
+        result = u - LibMath::lazy(v) * 2.f;
+        CHECK_VECTOR3(result, u - v * 2.f);
+
+        const LibMath::Vector2 vec2 = LibMath::lazy(LibMath::Vector2(1.f, 2.f)) * 3.f - LibMath::Vector2(.5f, 1.f);
+        CHECK(vec2.m_x == Catch::Approx(2.5f));
+        CHECK(vec2.m_y == Catch::Approx(5.f));
+
+        const LibMath::Vector4 vec4 = LibMath::lazy(LibMath::Vector4(1.f, 2.f, 3.f, 4.f)) + LibMath::Vector4(4.f, 3.f, 2.f, 1.f);
+        CHECK(vec4.m_x == Catch::Approx(5.f));
+        CHECK(vec4.m_y == Catch::Approx(5.f));
+        CHECK(vec4.m_z == Catch::Approx(5.f));
+        CHECK(vec4.m_w == Catch::Approx(5.f));
+    }
+}
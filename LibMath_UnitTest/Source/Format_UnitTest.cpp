@@ -0,0 +1,164 @@
+#include <Format.h>
+#include <Matrix.h>
+#include <Quaternion.h>
+#include <Vector.h>
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Literal;
+
+namespace
+{
+    template <class Value>
+    std::string formatToString(const Value& value)
+    {
+        char                       buffer[1024];
+        const std::to_chars_result result = LibMath::formatTo(buffer, buffer + sizeof(buffer), value);
+
+        REQUIRE(result.ec == std::errc());
+        return std::string(buffer, result.ptr);
+    }
+}
+
+TEST_CASE("Format", "[.all][Format]")
+{
+    SECTION("Formatting")
+    {
+        CHECK(formatToString(LibMath::Vector2(2.5f, -.5f)) == "{2.5,-0.5}");
+        CHECK(formatToString(LibMath::Vector3(2.5f, -.5f, 2.f)) == "{2.5,-0.5,2}");
+        CHECK(formatToString(LibMath::Vector4(2.5f, -.5f, 2.f, 1.f)) == "{2.5,-0.5,2,1}");
+        CHECK(formatToString(LibMath::Vector3I(-1, 0, 42)) == "{-1,0,42}");
+        CHECK(formatToString(LibMath::Quaternion(3.f, 2.5f, -.5f, 2.f)) == "{2.5,-0.5,2,3}");
+        CHECK(formatToString(LibMath::Matrix2(1.f)) == "{1,0,0,1}");
+        CHECK(formatToString(1.5_rad) == "1.5");
+        CHECK(formatToString(90_deg) == "90");
+
+        // Floats are written in their shortest exact form
+        const LibMath::Vector3 thirds(1.f / 3.f, 2.f / 3.f, 1e-20f);
+        CHECK(formatToString(thirds) == "{0.33333334,0.6666667,1e-20}");
+        CHECK(thirds.string() == formatToString(thirds));
+        CHECK(thirds.stringLong() == "Vector3{ x:0.33333334, y:0.6666667, z:1e-20 }");
+        CHECK(LibMath::Vector2(1.f / 3.f, 123456789.f).stringLong() == "Vector2{ x:0.33333334, y:123456792 }");
+        CHECK(LibMath::Vector4(1.f / 3.f, 0.f, -1.f, 2.f).stringLong() == "Vector4{ x:0.33333334, y:0, z:-1, w:2 }");
+        CHECK(LibMath::Quaternion(2.f, 1.f / 3.f, 0.f, -1.f).stringLong() == "Quaternion{ x:0.33333334, y:0, z:-1, w:2 }");
+        CHECK(LibMath::Matrix2(1.f / 3.f).stringLong() == "Matrix2x2{ 0_0: 0.33333334, 0_1: 0, 1_0: 0, 1_1: 0.33333334 }");
+
+        // Too small buffers are reported
+        char buffer[8];
+        CHECK(LibMath::formatTo(buffer, buffer + sizeof(buffer), LibMath::Vector3(1.f, 2.f, 3.f)).ec == std::errc());
+        CHECK(LibMath::formatTo(buffer, buffer + 6, LibMath::Vector3(1.f, 2.f, 3.f)).ec == std::errc::value_too_large);
+        CHECK(LibMath::formatTo(buffer, buffer + 3, LibMath::Vector3(100.f, 2.f, 3.f)).ec == std::errc::value_too_large);
+        CHECK(LibMath::formatTo(buffer, buffer, LibMath::Vector3(1.f, 2.f, 3.f)).ec == std::errc::value_too_large);
+    }
+
+    SECTION("Parsing")
+    {
+        LibMath::Vector3 vector;
+        std::string_view text = "{2.5, -0.5 ,2}extra";
+
+        std::from_chars_result result = LibMath::parse(text, vector);
+        CHECK(result.ec == std::errc());
+        CHECK(std::string_view(result.ptr) == "extra");
+        CHECK(vector == LibMath::Vector3(2.5f, -.5f, 2.f));
+
+        // Round trips are exact
+        const LibMath::Vector4 thirds(1.f / 3.f, -2.f / 3.f, 1e-20f, 3e38f);
+        LibMath::Vector4       parsedThirds;
+        CHECK(LibMath::parse(formatToString(thirds), parsedThirds).ec == std::errc());
+        CHECK(parsedThirds.m_x == thirds.m_x);
+        CHECK(parsedThirds.m_y == thirds.m_y);
+        CHECK(parsedThirds.m_z == thirds.m_z);
+        CHECK(parsedThirds.m_w == thirds.m_w);
+
+        LibMath::Quaternion quaternion;
+        CHECK(LibMath::parse(" { 2.5,-0.5,2,3 } ", quaternion).ec == std::errc());
+        CHECK(quaternion == LibMath::Quaternion(3.f, 2.5f, -.5f, 2.f));
+
+        LibMath::Matrix3 matrix;
+        CHECK(LibMath::parse("{1,2,3,4,5,6,7,8,9}", matrix).ec == std::errc());
+
+        for (size_t i = 0; i < matrix.getSize(); i++)
+            CHECK(matrix.getArray()[i] == static_cast<float>(i + 1));
+
+        LibMath::Vector2I integers;
+        CHECK(LibMath::parse("{-3,7}", integers).ec == std::errc());
+        CHECK(integers == LibMath::Vector2I(-3, 7));
+
+        LibMath::Radian radian;
+        CHECK(LibMath::parse("  1.25", radian).ec == std::errc());
+        CHECK(radian.raw() == 1.25f);
+
+        // Invalid texts are reported and leave the value unchanged
+        const char* invalidTexts[] = { "", "2.5,-0.5,2}", "{2.5,-0.5}", "{2.5,-0.5,2", "{2.5;-0.5;2}", "{2.5,,2}", "{a,b,c}" };
+
+        for (const char* invalidText : invalidTexts)
+        {
+            result = LibMath::parse(invalidText, vector);
+            CHECK(result.ec == std::errc::invalid_argument);
+            CHECK(vector == LibMath::Vector3(2.5f, -.5f, 2.f));
+        }
+
+        CHECK(LibMath::parse("{1e99,0,0}", vector).ec == std::errc::result_out_of_range);
+        CHECK(LibMath::parse("{1.5,2}", integers).ec == std::errc::invalid_argument);
+    }
+
+    SECTION("Arrays")
+    {
+        std::vector<LibMath::Vector3> vectors;
+
+        for (int i = 0; i < 100; i++)
+            vectors.emplace_back(static_cast<float>(i) * .1f, -static_cast<float>(i), 1.f / static_cast<float>(i + 1));
+
+        std::vector<char>          buffer(vectors.size() * 64);
+        const std::to_chars_result written = LibMath::formatArray<LibMath::Vector3>(buffer.data(), buffer.data() + buffer.size(), vectors);
+        REQUIRE(written.ec == std::errc());
+
+        std::vector<LibMath::Vector3>  parsed(vectors.size());
+        const LibMath::ArrayParseResult result = LibMath::parseArray<LibMath::Vector3>(std::string_view(buffer.data(), written.ptr), parsed);
+
+        CHECK(result.ec == std::errc());
+        CHECK(result.count == vectors.size());
+        CHECK(result.ptr == written.ptr);
+
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            CHECK(parsed[i].m_x == vectors[i].m_x);
+            CHECK(parsed[i].m_y == vectors[i].m_y);
+            CHECK(parsed[i].m_z == vectors[i].m_z);
+        }
+
+        CHECK(LibMath::formatArray<LibMath::Vector3>(buffer.data(), buffer.data() + 100, vectors).ec == std::errc::value_too_large);
+
+        // Values can be separated by commas and whitespace, and the output doesn't need to be filled
+        LibMath::Matrix2 matrices[3];
+
+        LibMath::ArrayParseResult partial = LibMath::parseArray<LibMath::Matrix2>("{1,0,0,1},\n\t{2, 0, 0, 2} ", matrices);
+        CHECK(partial.ec == std::errc());
+        CHECK(partial.count == 2);
+        CHECK(matrices[1] == LibMath::Matrix2(2.f));
+
+        // Parsing stops at the first invalid value or once the output is full
+        partial = LibMath::parseArray<LibMath::Matrix2>("{1,0,0,1} {2,0,0} {3,0,0,3}", matrices);
+        CHECK(partial.ec == std::errc::invalid_argument);
+        CHECK(partial.count == 1);
+
+        partial = LibMath::parseArray<LibMath::Matrix2>("{1,0,0,1} {2,0,0,2} {3,0,0,3} {4,0,0,4}", matrices);
+        CHECK(partial.ec == std::errc());
+        CHECK(partial.count == 3);
+        CHECK(std::string_view(partial.ptr) == " {4,0,0,4}");
+    }
+
+#ifdef __cpp_lib_format
+    SECTION("std::format")
+    {
+        CHECK(std::format("{}", LibMath::Vector3(2.5f, -.5f, 2.f)) == "{2.5,-0.5,2}");
+        CHECK(std::format("{:.2f}", LibMath::Vector2(1.f, -.5f)) == "{1.00,-0.50}");
+        CHECK(std::format("{}", LibMath::Quaternion::identity()) == "{0,0,0,1}");
+        CHECK(std::format("{:.1f}", LibMath::Matrix2(1.f)) == "{1.0,0.0,0.0,1.0}");
+        CHECK(std::format("{:>4}", 90_deg) == "  90");
+    }
+#endif // __cpp_lib_format
+}
@@ -30,6 +30,8 @@ void addGroups([[maybe_unused]] std::vector<const char*>& arguments)
     // arguments.push_back("[matrix],");
     // arguments.push_back("[quaternion],");
     // arguments.push_back("[transform],");
+    // arguments.push_back("[expression],");
+    // arguments.push_back("[benchmark],"); // Benchmarks are excluded from "[all]" since they take a while to run
 }
 
 void addTests([[maybe_unused]] std::vector<const char*>& arguments)
@@ -47,6 +49,7 @@ void addTests([[maybe_unused]] std::vector<const char*>& arguments)
     // arguments.push_back("Matrix4,");
     // arguments.push_back("Quaternion,");
     // arguments.push_back("Transform,");
+    // arguments.push_back("Expression,");
 }
 
 void addSections([[maybe_unused]] std::vector<const char*>& arguments)
@@ -0,0 +1,400 @@
+#include <Expression.h>
+#include <Matrix.h>
+#include <Matrix/Matrix4Batch.h>
+#include <Angle/Degree.h>
+#include <Vector/Vector3.h>
+#include <Vector/Vector4.h>
+
+#include <vector>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_XYZW_ONLY
+#include <glm/glm.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+TEST_CASE("Matrix4 benchmark", "[.benchmark][matrix][Matrix4]")
+{
+    LibMath::Matrix4 left;
+    LibMath::Matrix4 right;
+
+    glm::mat4 leftGlm{};
+    glm::mat4 rightGlm{};
+
+    for (LibMath::length_t row = 0; row < 4; row++)
+    {
+        for (LibMath::length_t col = 0; col < 4; col++)
+        {
+            left(row, col)  = static_cast<float>(row * 4 + col) * .25f - 1.5f;
+            right(row, col) = static_cast<float>((row + 1) * (col + 3) % 5) * .5f - 1.f;
+
+            leftGlm[col][row]  = left(row, col);
+            rightGlm[col][row] = right(row, col);
+        }
+    }
+
+    const LibMath::Vector4 vec{ 1.5f, -2.25f, .75f, 1.f };
+    const glm::vec4        vecGlm{ 1.5f, -2.25f, .75f, 1.f };
+
+    BENCHMARK("Matrix4 * Matrix4")
+    {
+        return left * right;
+    };
+
+    BENCHMARK("glm::mat4 * glm::mat4")
+    {
+        return leftGlm * rightGlm;
+    };
+
+    BENCHMARK("Matrix4 *= Matrix4")
+    {
+        LibMath::Matrix4 product = left;
+        return product *= right;
+    };
+
+    BENCHMARK("Matrix4 * Vector4")
+    {
+        return left * vec;
+    };
+
+    BENCHMARK("glm::mat4 * glm::vec4")
+    {
+        return leftGlm * vecGlm;
+    };
+
+    BENCHMARK("Matrix4::transposed")
+    {
+        return left.transposed();
+    };
+
+    BENCHMARK("glm::transpose(glm::mat4)")
+    {
+        return glm::transpose(leftGlm);
+    };
+
+    const LibMath::Matrix4 rigid = LibMath::translation(1.f, -2.f, 3.5f) *
+        LibMath::rotation(LibMath::Degree(30.f), LibMath::Vector3(1.f, 2.f, -.5f));
+
+    const LibMath::Matrix4 affine = rigid * LibMath::scaling(2.f, .5f, 1.5f);
+
+    BENCHMARK("Matrix4::inverse (affine)")
+    {
+        return affine.inverse();
+    };
+
+    BENCHMARK("Matrix4::inverseAffine")
+    {
+        return affine.inverseAffine();
+    };
+
+    BENCHMARK("Matrix4::inverseRigid")
+    {
+        return rigid.inverseRigid();
+    };
+}
+
+TEST_CASE("TMatrix benchmark", "[.benchmark][matrix]")
+{
+    LibMath::Matrix3               matrix3;
+    LibMath::Matrix4               matrix4;
+    LibMath::TMatrix<4, 4, double> matrix4d;
+    LibMath::TMatrix<5, 5, float>  matrix5;
+    glm::mat4                      matrix4Glm{};
+
+    for (LibMath::length_t row = 0; row < 5; row++)
+    {
+        for (LibMath::length_t col = 0; col < 5; col++)
+        {
+            const float value = static_cast<float>((row + 2) * (col + 3) % 7) * .5f - 1.f + (row == col ? 4.f : 0.f);
+
+            if (row < 3 && col < 3)
+                matrix3(row, col) = value;
+
+            if (row < 4 && col < 4)
+            {
+                matrix4(row, col)    = value;
+                matrix4d(row, col)   = value;
+                matrix4Glm[col][row] = value;
+            }
+
+            matrix5(row, col) = value;
+        }
+    }
+
+    BENCHMARK("Matrix3 * Matrix3")
+    {
+        return matrix3 * matrix3;
+    };
+
+    BENCHMARK("TMatrix<4, 4, double> product")
+    {
+        return matrix4d * matrix4d;
+    };
+
+    BENCHMARK("TMatrix<5, 5, float> product")
+    {
+        return matrix5 * matrix5;
+    };
+
+    BENCHMARK("Matrix3::transposed")
+    {
+        return matrix3.transposed();
+    };
+
+    BENCHMARK("Matrix4::minor")
+    {
+        return matrix4.minor(1, 2);
+    };
+
+    BENCHMARK("Matrix4::coMatrix")
+    {
+        return matrix4.coMatrix();
+    };
+
+    BENCHMARK("Matrix4::determinant")
+    {
+        return matrix4.determinant();
+    };
+
+    BENCHMARK("Matrix4 cofactor determinant")
+    {
+        float determinant = 0.f;
+
+        for (LibMath::length_t col = 0; col < 4; col++)
+            determinant += matrix4(0, col) * matrix4.cofactor(0, col);
+
+        return determinant;
+    };
+
+    BENCHMARK("glm::determinant(glm::mat4)")
+    {
+        return glm::determinant(matrix4Glm);
+    };
+
+    BENCHMARK("Matrix4::inverse")
+    {
+        return matrix4.inverse();
+    };
+
+    BENCHMARK("Matrix4 adjugate inverse")
+    {
+        return matrix4.adjugate() * (1.f / matrix4.determinant());
+    };
+
+    BENCHMARK("glm::inverse(glm::mat4)")
+    {
+        return glm::inverse(matrix4Glm);
+    };
+
+    BENCHMARK("TMatrix<5, 5, float>::determinant")
+    {
+        return matrix5.determinant();
+    };
+
+    BENCHMARK("TMatrix<5, 5> cofactor determinant")
+    {
+        float determinant = 0.f;
+
+        for (LibMath::length_t col = 0; col < 5; col++)
+            determinant += matrix5(0, col) * matrix5.cofactor(0, col);
+
+        return determinant;
+    };
+
+    BENCHMARK("TMatrix<5, 5, float>::inverse")
+    {
+        return matrix5.inverse();
+    };
+
+    BENCHMARK("TMatrix<5, 5> adjugate inverse")
+    {
+        return matrix5.adjugate() * (1.f / matrix5.determinant());
+    };
+}
+
+TEST_CASE("Expression benchmark", "[.benchmark][expression]")
+{
+    LibMath::Matrix4 a;
+    LibMath::Matrix4 b;
+    LibMath::Matrix4 c;
+    LibMath::Matrix4 d;
+
+    for (LibMath::length_t row = 0; row < 4; row++)
+    {
+        for (LibMath::length_t col = 0; col < 4; col++)
+        {
+            a(row, col) = static_cast<float>(row * 4 + col) * .25f - 1.5f;
+            b(row, col) = static_cast<float>((row + 1) * (col + 3) % 5) * .5f - 1.f;
+            c(row, col) = static_cast<float>((row + 2) * (col + 1) % 7) - 3.f;
+            d(row, col) = static_cast<float>(row + col) * .125f;
+        }
+    }
+
+    const float scalar = 1.5f;
+
+    BENCHMARK("eager a * b + c * s - d")
+    {
+        return a * b + c * scalar - d;
+    };
+
+    BENCHMARK("lazy a * b + c * s - d")
+    {
+        const LibMath::Matrix4 result = LibMath::lazy(a) * b + LibMath::lazy(c) * scalar - d;
+        return result;
+    };
+
+    BENCHMARK("eager a + b - c + d")
+    {
+        return a + b - c + d;
+    };
+
+    BENCHMARK("lazy a + b - c + d")
+    {
+        const LibMath::Matrix4 result = LibMath::lazy(a) + b - c + d;
+        return result;
+    };
+
+    const LibMath::Vector3 u{ 1.5f, -2.f, .25f };
+    const LibMath::Vector3 v{ -.5f, 4.f, 3.f };
+    const LibMath::Vector3 w{ 2.f, .75f, -1.f };
+
+    BENCHMARK("eager u + v * s - w")
+    {
+        return u + v * scalar - w;
+    };
+
+    BENCHMARK("lazy u + v * s - w")
+    {
+        const LibMath::Vector3 result = LibMath::lazy(u) + LibMath::lazy(v) * scalar - w;
+        return result;
+    };
+}
+
+// Divide the batch size by the reported mean time to get the throughput in matrices per second
+TEST_CASE("Matrix4 batch benchmark", "[.benchmark][matrix][Matrix4][batch]")
+{
+    constexpr size_t smallBatchSize = 1024;
+    constexpr size_t largeBatchSize = 65536;
+
+    std::vector<LibMath::Matrix4> left(largeBatchSize);
+    std::vector<LibMath::Matrix4> right(largeBatchSize);
+    std::vector<LibMath::Matrix4> out(largeBatchSize);
+
+    for (size_t i = 0; i < largeBatchSize; i++)
+    {
+        left[i]  = LibMath::translation(static_cast<float>(i), -2.f, .5f) * LibMath::scaling(1.f, 2.f, static_cast<float>(i % 7));
+        right[i] = LibMath::rotation(LibMath::Degree(static_cast<float>(i % 360)), LibMath::Vector3(1.f, 2.f, -.5f));
+    }
+
+    const LibMath::Matrix4 viewProjection = LibMath::perspectiveProjection(LibMath::Degree(60.f), 16.f / 9.f, .1f, 100.f) *
+        LibMath::lookAt(LibMath::Vector3(0.f, 2.f, -5.f), LibMath::Vector3::zero(), LibMath::Vector3::up());
+
+    const std::span<const LibMath::Matrix4> smallLeft(left.data(), smallBatchSize);
+    const std::span<const LibMath::Matrix4> smallRight(right.data(), smallBatchSize);
+    const std::span<LibMath::Matrix4>       smallOut(out.data(), smallBatchSize);
+
+    BENCHMARK("Matrix4 * Matrix4 loop (1024)")
+    {
+        for (size_t i = 0; i < smallBatchSize; i++)
+            out[i] = left[i] * right[i];
+
+        return out[smallBatchSize - 1];
+    };
+
+    BENCHMARK("multiply(span, span) (1024)")
+    {
+        LibMath::multiply(smallLeft, smallRight, smallOut);
+        return out[smallBatchSize - 1];
+    };
+
+    BENCHMARK("Matrix4 * Matrix4 broadcast loop (1024)")
+    {
+        for (size_t i = 0; i < smallBatchSize; i++)
+            out[i] = viewProjection * right[i];
+
+        return out[smallBatchSize - 1];
+    };
+
+    BENCHMARK("multiply(Matrix4, span) (1024)")
+    {
+        LibMath::multiply(viewProjection, smallRight, smallOut);
+        return out[smallBatchSize - 1];
+    };
+
+    BENCHMARK("multiply(span, Matrix4) (1024)")
+    {
+        LibMath::multiply(smallLeft, viewProjection, smallOut);
+        return out[smallBatchSize - 1];
+    };
+
+    BENCHMARK("multiply(span, span) (65536)")
+    {
+        LibMath::multiply(left, right, out);
+        return out[largeBatchSize - 1];
+    };
+
+    BENCHMARK("multiply(span, span) parallel (65536)")
+    {
+        LibMath::multiply(left, right, out, LibMath::EExecutionPolicy::PARALLEL);
+        return out[largeBatchSize - 1];
+    };
+}
+
+TEST_CASE("Matrix4 transform batch benchmark", "[.benchmark][matrix][Matrix4][batch]")
+{
+    constexpr size_t batchSize = 4096;
+
+    std::vector<LibMath::Vector3> points(batchSize);
+    std::vector<LibMath::Vector3> outPoints(batchSize);
+    std::vector<LibMath::Vector4> vectors(batchSize);
+    std::vector<LibMath::Vector4> outVectors(batchSize);
+
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        points[i]  = { static_cast<float>(i % 17) - 8.f, static_cast<float>(i % 5) * .5f, static_cast<float>(i % 11) + 1.f };
+        vectors[i] = { points[i], 1.f };
+    }
+
+    const LibMath::Matrix4 transform = LibMath::translation(1.f, -2.f, 3.5f) *
+        LibMath::rotation(LibMath::Degree(30.f), LibMath::Vector3(1.f, 2.f, -.5f)) * LibMath::scaling(2.f, .5f, 1.5f);
+
+    BENCHMARK("Matrix4 * Vector4(Vector3, 1) loop (4096)")
+    {
+        for (size_t i = 0; i < batchSize; i++)
+            outPoints[i] = (transform * LibMath::Vector4(points[i], 1.f)).xyz();
+
+        return outPoints[batchSize - 1];
+    };
+
+    BENCHMARK("transformPoints(Vector3) (4096)")
+    {
+        LibMath::transformPoints(transform, points, outPoints);
+        return outPoints[batchSize - 1];
+    };
+
+    BENCHMARK("transformDirections(Vector3) (4096)")
+    {
+        LibMath::transformDirections(transform, points, outPoints);
+        return outPoints[batchSize - 1];
+    };
+
+    BENCHMARK("transformPointsProjective(Vector3) (4096)")
+    {
+        LibMath::transformPointsProjective(transform, points, outPoints);
+        return outPoints[batchSize - 1];
+    };
+
+    BENCHMARK("Matrix4 * Vector4 loop (4096)")
+    {
+        for (size_t i = 0; i < batchSize; i++)
+            outVectors[i] = transform * vectors[i];
+
+        return outVectors[batchSize - 1];
+    };
+
+    BENCHMARK("transformPoints(Vector4) (4096)")
+    {
+        LibMath::transformPoints(transform, vectors, outVectors);
+        return outVectors[batchSize - 1];
+    };
+}
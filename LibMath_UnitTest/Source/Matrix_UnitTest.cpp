@@ -1,4 +1,7 @@
+#include <cstring>
+
 #include <Matrix.h>
+#include <Matrix/Matrix4Batch.h>
 #include <Vector/Vector3.h>
 #include <Angle/Radian.h>
 
@@ -12,6 +15,9 @@
 
 #include "Angle/Degree.h"
 #include "Vector/Vector2.h"
+#include "Vector/Vector4.h"
+
+#include <vector>
 
 using namespace LibMath::Literal;
 
@@ -48,6 +54,16 @@ TEST_CASE("Matrix3", "[.all][matrix][Matrix3]")
         empty    = oneParam;
         emptyGlm = oneParamGlm;
         CHECK_MATRIX(empty, emptyGlm);
+
+        // layout
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Matrix3>);
+        STATIC_CHECK(std::is_standard_layout_v<LibMath::Matrix3>);
+        STATIC_CHECK(sizeof(LibMath::Matrix3) == sizeof(glm::mat3));
+
+        LibMath::Matrix3 copies[2];
+        std::memcpy(copies, &oneParam, sizeof(LibMath::Matrix3));
+        std::memcpy(copies + 1, copies, sizeof(LibMath::Matrix3));
+        CHECK_MATRIX(copies[1], oneParamGlm);
     }
 
     SECTION("Accessor")
@@ -507,17 +523,19 @@ TEST_CASE("Matrix3", "[.all][matrix][Matrix3]")
 
     SECTION("Debug")
     {
-#if defined(_DEBUG) || defined(DEBUG) || !defined(NDEBUG)
-        LibMath::Matrix3 matrix{};
-
-        CHECK_THROWS(matrix[matrix.getIndex(-1, 0)]);
-        CHECK_THROWS(matrix[matrix.getIndex(0, -1)]);
-        CHECK_THROWS(matrix[matrix.getIndex(-1, -1)]);
-        CHECK_THROWS(matrix[matrix.getIndex(3, 0)]);
-        CHECK_THROWS(matrix[matrix.getIndex(0, 3)]);
-        CHECK_THROWS(matrix[matrix.getIndex(3, 3)]);
-        CHECK_THROWS(matrix[9]);
-#endif // DEBUG
+        // Out of range accesses are caught by assertions in debug builds, so we can only make sure accessors never throw
+        LibMath::Matrix3       matrix{};
+        const LibMath::Matrix3 constMatrix{};
+
+        STATIC_CHECK(noexcept(matrix[0]));
+        STATIC_CHECK(noexcept(matrix(0, 0)));
+        STATIC_CHECK(noexcept(constMatrix[0]));
+        STATIC_CHECK(noexcept(constMatrix(0, 0)));
+        STATIC_CHECK(noexcept(LibMath::Matrix3::getIndex(0, 0)));
+
+        STATIC_CHECK(LibMath::Matrix3::getIndex(0, 0) == 0);
+        STATIC_CHECK(LibMath::Matrix3::getIndex(1, 2) == 5);
+        STATIC_CHECK(LibMath::Matrix3::getIndex(2, 2) == 8);
     }
 }
 
@@ -525,6 +543,39 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
 {
     constexpr glm::mat4 idMatGlm{ 1 };
 
+    SECTION("Instantiation")
+    {
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Matrix4>);
+        STATIC_CHECK(std::is_standard_layout_v<LibMath::Matrix4>);
+
+        // aligned variant
+        STATIC_CHECK(alignof(LibMath::Matrix4A) == 16);
+        STATIC_CHECK(sizeof(LibMath::Matrix4A) == sizeof(LibMath::Matrix4));
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Matrix4A>);
+        STATIC_CHECK(std::is_standard_layout_v<LibMath::Matrix4A>);
+
+        constexpr LibMath::Matrix4A identity(1.f);
+        CHECK(identity.isIdentity());
+
+        const LibMath::Matrix4A translation = LibMath::translation(1.f, 2.f, 3.f);
+        LibMath::Matrix4A       product     = translation * identity;
+        CHECK(product == translation);
+
+        product *= translation;
+        CHECK(product == LibMath::translation(2.f, 4.f, 6.f));
+        CHECK(product.inverse() == LibMath::translation(-2.f, -4.f, -6.f));
+
+        const LibMath::Vector4 point = product * LibMath::Vector4(0.f, 0.f, 0.f, 1.f);
+        CHECK(point == LibMath::Vector4(2.f, 4.f, 6.f, 1.f));
+
+        LibMath::Matrix4A instances[4];
+
+        for (LibMath::Matrix4A& instance : instances)
+            std::memcpy(&instance, &product, sizeof(LibMath::Matrix4A));
+
+        CHECK(instances[3] == product);
+    }
+
     SECTION("Transformation")
     {
         const LibMath::Vector3 transformation{ -2.f, 0.f, 1.25f };
@@ -719,4 +770,533 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
             CHECK_MATRIX(lookAt, glm::transpose(lookAtGlm));
         }
     }
+
+    SECTION("Arithmetic")
+    {
+        LibMath::Matrix4 big;
+        LibMath::Matrix4 small;
+
+        glm::mat4 bigGlm{};
+        glm::mat4 smallGlm{};
+
+        for (LibMath::length_t row = 0; row < 4; row++)
+        {
+            for (LibMath::length_t col = 0; col < 4; col++)
+            {
+                big(row, col)   = static_cast<float>(row * 4 + col) * 1.25f - 3.5f;
+                small(row, col) = static_cast<float>((row + 3) * (col + 2) % 7) * -.75f + .5f;
+
+                bigGlm[row][col]   = big(row, col);
+                smallGlm[row][col] = small(row, col);
+            }
+        }
+
+        SECTION("Multiplication")
+        {
+            {
+                LibMath::Matrix4 productAssignment = big;
+                productAssignment *= small;
+
+                // Transpose since glm matrices are column major unlike ours
+                glm::mat4 productAssignmentGlm = glm::transpose(bigGlm);
+                productAssignmentGlm *= glm::transpose(smallGlm);
+
+                CHECK_MATRIX(productAssignment, glm::transpose(productAssignmentGlm));
+            }
+
+            {
+                LibMath::Matrix4 product = big * small;
+
+                // Transpose since glm matrices are column major unlike ours
+                glm::mat4 productGlm = glm::transpose(bigGlm) * glm::transpose(smallGlm);
+
+                CHECK_MATRIX(product, glm::transpose(productGlm));
+
+                // The specialized kernels should keep the generic implementation's summation order
+                for (LibMath::length_t row = 0; row < 4; row++)
+                {
+                    for (LibMath::length_t col = 0; col < 4; col++)
+                    {
+                        float expected = 0;
+
+                        for (LibMath::length_t i = 0; i < 4; i++)
+                            expected += big(row, i) * small(i, col);
+
+                        CHECK(product(row, col) == expected);
+                    }
+                }
+            }
+
+            {
+                const LibMath::Vector4 vec{ 1.5f, -2.25f, .75f, 1.f };
+                const LibMath::Vector4 product = big * vec;
+
+                // Transpose since glm matrices are column major unlike ours
+                const glm::vec4 productGlm = glm::transpose(bigGlm) * glm::vec4{ 1.5f, -2.25f, .75f, 1.f };
+
+                CHECK(product.m_x == Catch::Approx(productGlm.x));
+                CHECK(product.m_y == Catch::Approx(productGlm.y));
+                CHECK(product.m_z == Catch::Approx(productGlm.z));
+                CHECK(product.m_w == Catch::Approx(productGlm.w));
+
+                for (LibMath::length_t row = 0; row < 4; row++)
+                {
+                    const float expected = ((big(row, 0) * vec.m_x + big(row, 1) * vec.m_y) + big(row, 2) * vec.m_z) +
+                        big(row, 3) * vec.m_w;
+
+                    CHECK(product[row] == expected);
+                }
+            }
+        }
+
+        SECTION("Transpose")
+        {
+            LibMath::Matrix4 transposed    = big.transposed();
+            glm::mat4        transposedGlm = glm::transpose(bigGlm);
+
+            CHECK_MATRIX(transposed, transposedGlm);
+            CHECK(transposed.transposed() == big);
+        }
+    }
+
+    SECTION("Functionality")
+    {
+        LibMath::Matrix4 base;
+        base(0, 0) = 2.f;
+        base(0, 1) = -1.f;
+        base(0, 2) = .5f;
+        base(0, 3) = 3.f;
+        base(1, 0) = 1.5f;
+        base(1, 1) = 4.f;
+        base(1, 2) = -2.f;
+        base(1, 3) = .25f;
+        base(2, 0) = -3.f;
+        base(2, 1) = .75f;
+        base(2, 2) = 5.f;
+        base(2, 3) = 1.f;
+        base(3, 0) = .5f;
+        base(3, 1) = 2.f;
+        base(3, 2) = -1.25f;
+        base(3, 3) = 6.f;
+
+        glm::mat4 baseGlm{};
+
+        for (LibMath::length_t row = 0; row < 4; row++)
+        {
+            for (LibMath::length_t col = 0; col < 4; col++)
+                baseGlm[row][col] = base(row, col);
+        }
+
+        SECTION("Determinant")
+        {
+            float determinant = base.determinant();
+
+            float determinantGlm = glm::determinant(baseGlm);
+
+            CHECK(determinant == Catch::Approx(determinantGlm));
+
+            // Compare with the cofactor expansion along the first row
+            float cofactorDeterminant = 0.f;
+
+            for (LibMath::length_t col = 0; col < 4; col++)
+                cofactorDeterminant += base(0, col) * base.cofactor(0, col);
+
+            CHECK(determinant == Catch::Approx(cofactorDeterminant));
+
+            CHECK(LibMath::Matrix4(1.f).determinant() == 1.f);
+            CHECK(LibMath::Matrix4(2.f).determinant() == 16.f);
+        }
+
+        SECTION("Inverse")
+        {
+            LibMath::Matrix4 inverse    = base.inverse();
+            glm::mat4        inverseGlm = glm::inverse(baseGlm);
+
+            CHECK_MATRIX(inverse, inverseGlm);
+            CHECK((base * inverse).isIdentity());
+
+            LibMath::Matrix4 transform = LibMath::translation(1.f, -2.f, 3.5f) * LibMath::rotation(LibMath::Degree(30.f),
+                LibMath::Vector3(1.f, 2.f, -.5f)) * LibMath::scaling(2.f, .5f, 1.5f);
+
+            CHECK((transform * transform.inverse()).isIdentity());
+        }
+
+        SECTION("AffineInverse")
+        {
+            const LibMath::Matrix4 rigid = LibMath::translation(1.f, -2.f, 3.5f) *
+                LibMath::rotation(LibMath::Degree(30.f), LibMath::Vector3(1.f, 2.f, -.5f));
+
+            const LibMath::Matrix4 affine = rigid * LibMath::scaling(2.f, .5f, 1.5f);
+
+            glm::mat4 rigidGlm{};
+            glm::mat4 affineGlm{};
+
+            for (LibMath::length_t row = 0; row < 4; row++)
+            {
+                for (LibMath::length_t col = 0; col < 4; col++)
+                {
+                    rigidGlm[row][col]  = rigid(row, col);
+                    affineGlm[row][col] = affine(row, col);
+                }
+            }
+
+            CHECK_MATRIX(affine.inverseAffine(), glm::inverse(affineGlm));
+            CHECK_MATRIX(rigid.inverseAffine(), glm::inverse(rigidGlm));
+            CHECK_MATRIX(rigid.inverseRigid(), glm::inverse(rigidGlm));
+
+            CHECK((affine * affine.inverseAffine()).isIdentity());
+            CHECK((rigid * rigid.inverseRigid()).isIdentity());
+
+            LibMath::Matrix3 affine2D(1.f);
+            affine2D(0, 0) = 2.f;
+            affine2D(0, 1) = -1.f;
+            affine2D(1, 0) = .5f;
+            affine2D(1, 1) = 3.f;
+            affine2D(0, 2) = 4.f;
+            affine2D(1, 2) = -1.5f;
+
+            CHECK(affine2D.inverseAffine() == affine2D.inverse());
+        }
+
+        SECTION("LargeMatrix")
+        {
+            LibMath::TMatrix<5, 5, float> large;
+
+            for (LibMath::length_t row = 0; row < 5; row++)
+            {
+                for (LibMath::length_t col = 0; col < 5; col++)
+                    large(row, col) = static_cast<float>((row + 2) * (col + 3) % 7) * .5f - 1.f;
+            }
+
+            // The first pivot is zero, so the decomposition has to swap rows
+            large(0, 0) = 0.f;
+
+            float cofactorDeterminant = 0.f;
+
+            for (LibMath::length_t col = 0; col < 5; col++)
+                cofactorDeterminant += large(0, col) * large.cofactor(0, col);
+
+            CHECK(large.determinant() == Catch::Approx(cofactorDeterminant));
+            CHECK((large * large.inverse()).isIdentity());
+            CHECK((LibMath::TMatrix<5, 5, float>(3.f).inverse() == LibMath::TMatrix<5, 5, float>(1.f / 3.f)));
+
+            LibMath::TMatrix<5, 5, int> integers(2);
+            integers(0, 4) = 7;
+            integers(3, 1) = -4;
+
+            CHECK(integers.determinant() == 32);
+
+            LibMath::TMatrix<5, 5, float> singular = large;
+
+            for (LibMath::length_t col = 0; col < 5; col++)
+                singular(4, col) = singular(1, col) * 2.f;
+
+            CHECK(singular.determinant() == Catch::Approx(0.f).margin(1e-4));
+        }
+    }
+
+    SECTION("Batch")
+    {
+        // Large enough to be split across threads by the parallel policy
+        constexpr size_t batchSize = 3 * LibMath::Details::PARALLEL_BATCH_MIN_SIZE + 5;
+
+        std::vector<LibMath::Matrix4> left(batchSize);
+        std::vector<LibMath::Matrix4> right(batchSize);
+        std::vector<LibMath::Matrix4> out(batchSize);
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            left[i]  = LibMath::translation(static_cast<float>(i % 13), -2.f, .5f) * LibMath::scaling(1.f, 2.f, static_cast<float>(i % 7));
+            right[i] = LibMath::rotation(LibMath::Degree(static_cast<float>(i % 360)), LibMath::Vector3(1.f, 2.f, -.5f));
+        }
+
+        const LibMath::Matrix4 shared = LibMath::perspectiveProjection(LibMath::Degree(60.f), 16.f / 9.f, .1f, 100.f);
+
+        for (const LibMath::EExecutionPolicy policy : { LibMath::EExecutionPolicy::SEQUENTIAL, LibMath::EExecutionPolicy::PARALLEL })
+        {
+            size_t mismatches = 0;
+
+            LibMath::multiply(left, right, out, policy);
+
+            for (size_t i = 0; i < batchSize; i++)
+                mismatches += out[i] != left[i] * right[i];
+
+            LibMath::multiply(shared, right, out, policy);
+
+            for (size_t i = 0; i < batchSize; i++)
+                mismatches += out[i] != shared * right[i];
+
+            LibMath::multiply(left, shared, out, policy);
+
+            for (size_t i = 0; i < batchSize; i++)
+                mismatches += out[i] != left[i] * shared;
+
+            CHECK(mismatches == 0);
+        }
+
+        // In-place products
+        std::vector<LibMath::Matrix4> inPlace(left.begin(), left.begin() + 3);
+        LibMath::multiply(inPlace, std::span<const LibMath::Matrix4>(right.data(), 3), inPlace);
+
+        for (size_t i = 0; i < inPlace.size(); i++)
+            CHECK(inPlace[i] == left[i] * right[i]);
+
+        LibMath::multiply(shared, inPlace, inPlace);
+        CHECK(inPlace[2] == shared * (left[2] * right[2]));
+
+        // Empty batches are no-ops
+        LibMath::multiply(std::span<const LibMath::Matrix4>(), std::span<const LibMath::Matrix4>(), std::span<LibMath::Matrix4>(),
+            LibMath::EExecutionPolicy::PARALLEL);
+    }
+
+    SECTION("TransformBatch")
+    {
+        // Not a multiple of the kernels' width to cover the remainders
+        constexpr size_t batchSize = 1027;
+
+        const LibMath::Matrix4 transform = LibMath::translation(1.f, -2.f, 3.5f) *
+            LibMath::rotation(LibMath::Degree(30.f), LibMath::Vector3(1.f, 2.f, -.5f)) * LibMath::scaling(2.f, .5f, 1.5f);
+
+        const LibMath::Matrix4 viewProjection = LibMath::perspectiveProjection(LibMath::Degree(60.f), 16.f / 9.f, .1f, 100.f) *
+            LibMath::lookAt(LibMath::Vector3(0.f, 2.f, -5.f), LibMath::Vector3::zero(), LibMath::Vector3::up());
+
+        std::vector<LibMath::Vector3> points(batchSize);
+        std::vector<LibMath::Vector4> vectors(batchSize);
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            points[i]  = { static_cast<float>(i % 17) - 8.f, static_cast<float>(i % 5) * .5f, static_cast<float>(i % 11) + 1.f };
+            vectors[i] = { points[i], static_cast<float>(i % 3) + .5f };
+        }
+
+        std::vector<LibMath::Vector3> outPoints(batchSize);
+        std::vector<LibMath::Vector4> outVectors(batchSize);
+        size_t                        mismatches = 0;
+
+        LibMath::transformPoints(transform, points, outPoints);
+
+        for (size_t i = 0; i < batchSize; i++)
+            mismatches += outPoints[i] != (transform * LibMath::Vector4(points[i], 1.f)).xyz();
+
+        LibMath::transformDirections(transform, points, outPoints);
+
+        for (size_t i = 0; i < batchSize; i++)
+            mismatches += outPoints[i] != (transform * LibMath::Vector4(points[i], 0.f)).xyz();
+
+        LibMath::transformPointsProjective(viewProjection, points, outPoints);
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            const LibMath::Vector4 projected = viewProjection * LibMath::Vector4(points[i], 1.f);
+            mismatches += outPoints[i] != projected.xyz() / projected.m_w;
+        }
+
+        LibMath::transformPoints(transform, vectors, outVectors);
+
+        for (size_t i = 0; i < batchSize; i++)
+            mismatches += outVectors[i] != transform * vectors[i];
+
+        LibMath::transformPointsProjective(viewProjection, vectors, outVectors, LibMath::EExecutionPolicy::PARALLEL);
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            const LibMath::Vector4 projected = viewProjection * vectors[i];
+            mismatches += outVectors[i] != projected / projected.m_w;
+        }
+
+        CHECK(mismatches == 0);
+
+        // In place
+        std::vector<LibMath::Vector3> inPlacePoints = points;
+        LibMath::transformPoints(transform, inPlacePoints);
+        LibMath::transformDirections(transform, inPlacePoints, LibMath::EExecutionPolicy::PARALLEL);
+
+        for (size_t i = 0; i < batchSize; i++)
+            mismatches += inPlacePoints[i] != (transform * LibMath::Vector4((transform * LibMath::Vector4(points[i], 1.f)).xyz(), 0.f)).xyz();
+
+        LibMath::transformPointsProjective(viewProjection, inPlacePoints);
+
+        std::vector<LibMath::Vector4> inPlaceVectors = vectors;
+        LibMath::transformPoints(transform, inPlaceVectors);
+        LibMath::transformPointsProjective(viewProjection, inPlaceVectors);
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            const LibMath::Vector4 projected = viewProjection * (transform * vectors[i]);
+            mismatches += inPlaceVectors[i] != projected / projected.m_w;
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(inPlaceVectors.back().m_w == 1.f);
+
+        // Small batches only go through the remainder path
+        LibMath::Vector3 single[1] = { LibMath::Vector3(1.f, 2.f, 3.f) };
+        LibMath::transformPoints(LibMath::translation(1.f, 1.f, 1.f), single);
+        CHECK(single[0] == LibMath::Vector3(2.f, 3.f, 4.f));
+    }
+
+    SECTION("ColumnMajor")
+    {
+        using LibMath::EMatrixOrder;
+
+        STATIC_CHECK(LibMath::Matrix4::getOrder() == EMatrixOrder::ROW_MAJOR);
+        STATIC_CHECK(LibMath::Matrix4ColumnMajor::getOrder() == EMatrixOrder::COLUMN_MAJOR);
+        STATIC_CHECK(sizeof(LibMath::Matrix4ColumnMajor) == sizeof(LibMath::Matrix4));
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Matrix4ColumnMajor>);
+        STATIC_CHECK(!std::is_convertible_v<LibMath::Matrix4, LibMath::Matrix4ColumnMajor>);
+
+        const LibMath::Matrix4 rigid = LibMath::translation(1.f, -2.f, 3.5f) *
+            LibMath::rotation(LibMath::Degree(30.f), LibMath::Vector3(1.f, 2.f, -.5f));
+        const LibMath::Matrix4 affine = rigid * LibMath::scaling(2.f, .5f, 1.5f);
+
+        LibMath::Matrix4 other;
+
+        for (LibMath::length_t row = 0; row < 4; row++)
+        {
+            for (LibMath::length_t col = 0; col < 4; col++)
+                other(row, col) = static_cast<float>((row + 3) * (col + 2) % 7) * -.75f + .5f;
+        }
+
+        const LibMath::Matrix4ColumnMajor affineCm(affine);
+        const LibMath::Matrix4ColumnMajor rigidCm(rigid);
+        const LibMath::Matrix4ColumnMajor otherCm(other);
+
+        // Logical access is the same for both layouts
+        CHECK(affineCm.getIndex(1, 3) == 13);
+        CHECK(affine.getIndex(1, 3) == 7);
+
+        for (LibMath::length_t row = 0; row < 4; row++)
+        {
+            for (LibMath::length_t col = 0; col < 4; col++)
+            {
+                CHECK(affineCm(row, col) == affine(row, col));
+                CHECK(affineCm[col * 4 + row] == affine[row * 4 + col]);
+            }
+        }
+
+        CHECK(LibMath::Matrix4(affineCm) == affine);
+
+        // Column-major storage matches glm's
+        const glm::mat4 translationGlm = glm::translate(idMatGlm, glm::vec3{ 1.f, -2.f, 3.5f });
+        const LibMath::Matrix4ColumnMajor translationCm = LibMath::translation<float, EMatrixOrder::COLUMN_MAJOR>(1.f, -2.f, 3.5f);
+
+        CHECK(std::memcmp(translationCm.getArray(), glm::value_ptr(translationGlm), sizeof(glm::mat4)) == 0);
+
+        const glm::mat4 perspectiveGlm = glm::perspective(glm::radians(60.f), 16.f / 9.f, .1f, 100.f);
+        const LibMath::Matrix4ColumnMajor perspectiveCm = LibMath::perspectiveProjection<float, EMatrixOrder::COLUMN_MAJOR>(
+            LibMath::Degree(60.f), 16.f / 9.f, .1f, 100.f);
+
+        for (LibMath::length_t i = 0; i < 16; i++)
+            CHECK(perspectiveCm[i] == Catch::Approx(glm::value_ptr(perspectiveGlm)[i]).scale(1));
+
+        // Operations
+        CHECK(LibMath::Matrix4(affineCm * otherCm) == affine * other);
+        CHECK(LibMath::Matrix4(affineCm.transposed()) == affine.transposed());
+        CHECK(affineCm.determinant() == Catch::Approx(affine.determinant()));
+        CHECK(LibMath::Matrix4(affineCm.inverse()) == affine.inverse());
+        CHECK(LibMath::Matrix4(affineCm.inverseAffine()) == affine.inverseAffine());
+        CHECK(LibMath::Matrix4(rigidCm.inverseRigid()) == rigid.inverseRigid());
+        CHECK(LibMath::Matrix3(affineCm.minor(1, 2)) == affine.minor(1, 2));
+        CHECK(affineCm.cofactor(2, 1) == Catch::Approx(affine.cofactor(2, 1)));
+        CHECK(LibMath::Matrix4(affineCm.coMatrix()) == affine.coMatrix());
+        CHECK((affineCm * affineCm.inverse()).isIdentity());
+
+        LibMath::Matrix4ColumnMajor productAssignment = affineCm;
+        productAssignment *= otherCm;
+        CHECK(LibMath::Matrix4(productAssignment) == affine * other);
+
+        const LibMath::Vector4 point(1.f, -2.f, .5f, 1.f);
+        CHECK(affineCm * point == affine * point);
+
+        // Non-square products
+        LibMath::TColumnMajorMatrix<2, 3, float> left;
+        LibMath::TColumnMajorMatrix<3, 4, float> right;
+
+        for (LibMath::length_t i = 0; i < 3; i++)
+        {
+            for (LibMath::length_t j = 0; j < 2; j++)
+                left(j, i) = static_cast<float>(i * 2 + j) - 1.5f;
+
+            for (LibMath::length_t j = 0; j < 4; j++)
+                right(i, j) = static_cast<float>(i * 4 + j) * .5f;
+        }
+
+        const LibMath::TMatrix<2, 3, float> leftRm(left);
+        const LibMath::TMatrix<3, 4, float> rightRm(right);
+        CHECK(LibMath::TMatrix<2, 4, float>(left * right) == leftRm * rightRm);
+
+        // Builders and consumers
+        CHECK(LibMath::Matrix4(LibMath::rotation<float, EMatrixOrder::COLUMN_MAJOR>(30_deg, 45_deg, -60_deg)) ==
+            LibMath::rotation(30_deg, 45_deg, -60_deg));
+        CHECK(LibMath::Matrix4(LibMath::lookAt<float, EMatrixOrder::COLUMN_MAJOR>(LibMath::Vector3::zero(),
+            LibMath::Vector3::front(), LibMath::Vector3::up())) == LibMath::lookAt(LibMath::Vector3::zero(),
+            LibMath::Vector3::front(), LibMath::Vector3::up()));
+
+        const LibMath::TVector3<LibMath::Radian> euler   = LibMath::toEuler(rigid, LibMath::ERotationOrder::YXZ);
+        const LibMath::TVector3<LibMath::Radian> eulerCm = LibMath::toEuler(rigidCm, LibMath::ERotationOrder::YXZ);
+        CHECK(eulerCm.m_x.raw() == Catch::Approx(euler.m_x.raw()));
+        CHECK(eulerCm.m_y.raw() == Catch::Approx(euler.m_y.raw()));
+        CHECK(eulerCm.m_z.raw() == Catch::Approx(euler.m_z.raw()));
+
+        // Compile-time evaluation
+        constexpr LibMath::Matrix4ColumnMajor scalingCm = LibMath::scaling<float, EMatrixOrder::COLUMN_MAJOR>(2.f, .5f, 4.f);
+        constexpr LibMath::Matrix4ColumnMajor modelCm   = LibMath::translation<float, EMatrixOrder::COLUMN_MAJOR>(1.f, 2.f, 3.f) *
+            scalingCm;
+        STATIC_CHECK(modelCm[12] == 1.f);
+        STATIC_CHECK(modelCm(2, 3) == 3.f);
+        STATIC_CHECK(LibMath::floatEquals(modelCm.determinant(), 4.f));
+        STATIC_CHECK((modelCm * modelCm.inverse()).isIdentity());
+    }
+
+    SECTION("Constexpr")
+    {
+        // builders
+        constexpr LibMath::Matrix4 translationMat = LibMath::translation(1.f, -2.f, 3.5f);
+        STATIC_CHECK(translationMat(1, 3) == -2.f);
+
+        constexpr LibMath::Matrix4 scalingMat = LibMath::scaling(2.f, .5f, 4.f);
+        STATIC_CHECK(scalingMat(2, 2) == 4.f);
+
+        constexpr LibMath::Matrix4 rotationMat = LibMath::rotation(LibMath::Degree(90.f), LibMath::Vector3::up());
+        STATIC_CHECK(LibMath::floatEquals(rotationMat(0, 2), 1.f));
+        STATIC_CHECK(LibMath::floatEquals(rotationMat(2, 0), -1.f));
+        CHECK(rotationMat == LibMath::rotation(LibMath::Degree(90.f), LibMath::Vector3::up()));
+
+        constexpr LibMath::Matrix4 eulerMat = LibMath::rotation(30_deg, 45_deg, -60_deg);
+        CHECK(eulerMat == LibMath::rotation(30_deg, 45_deg, -60_deg));
+
+        constexpr LibMath::Matrix4 perspective = LibMath::perspectiveProjection(LibMath::Degree(90.f), 2.f, .1f, 100.f);
+        STATIC_CHECK(LibMath::floatEquals(perspective(1, 1), 1.f));
+        STATIC_CHECK(LibMath::floatEquals(perspective(0, 0), .5f));
+        CHECK(perspective == LibMath::perspectiveProjection(LibMath::Degree(90.f), 2.f, .1f, 100.f));
+
+        constexpr LibMath::Vector3 eye{ 1.f, 2.f, 3.f };
+        constexpr LibMath::Matrix4 view = LibMath::lookAt(eye, eye + LibMath::Vector3::front(), LibMath::Vector3::up());
+        STATIC_CHECK(LibMath::floatEquals(view(0, 0), -1.f));
+        CHECK(view == LibMath::lookAt(eye, eye + LibMath::Vector3::front(), LibMath::Vector3::up()));
+
+        // operations
+        constexpr LibMath::Matrix4 model = translationMat * rotationMat * scalingMat;
+        CHECK(model == translationMat * rotationMat * scalingMat);
+
+        STATIC_CHECK(LibMath::floatEquals(model.determinant(), 4.f));
+        STATIC_CHECK((model * model.inverse()).isIdentity());
+        STATIC_CHECK((model * model.inverseAffine()).isIdentity());
+        STATIC_CHECK((rotationMat.inverseRigid() == rotationMat.transposed()));
+        STATIC_CHECK((model.adjugate() == model.inverse() * model.determinant()));
+        STATIC_CHECK((-model + model * 2.f - model / 1.f == LibMath::Matrix4()));
+        STATIC_CHECK(LibMath::floatEquals(model.cofactor(0, 1), model.minor(0, 1).determinant() * -1.f));
+
+        constexpr LibMath::Vector4 point = model * LibMath::Vector4(1.f, 1.f, 1.f, 1.f);
+        STATIC_CHECK(LibMath::floatEquals(point.m_w, 1.f));
+        CHECK(point == model * LibMath::Vector4(1.f, 1.f, 1.f, 1.f));
+
+        constexpr LibMath::TMatrix<5, 5, double> large = LibMath::TMatrix<5, 5, double>(2.) + LibMath::TMatrix<5, 5, double>(1.);
+        STATIC_CHECK(LibMath::floatEquals(large.determinant(), 243.));
+        STATIC_CHECK((large.inverse() == LibMath::TMatrix<5, 5, double>(1. / 3.)));
+
+        constexpr LibMath::TMatrix<4, 4, int> integers = static_cast<LibMath::TMatrix<4, 4, int>>(scalingMat * 2.f);
+        STATIC_CHECK(integers(0, 0) == 4);
+        STATIC_CHECK(integers(1, 1) == 1);
+    }
 }
@@ -0,0 +1,143 @@
+#include <Morton.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <Vector/Vector4.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Morton", "[.all][vector][Morton]")
+{
+    SECTION("Encoding")
+    {
+        // Compile time results use the bit twiddling versions
+        static_assert(LibMath::mortonEncode(0u, 0u) == 0);
+        static_assert(LibMath::mortonEncode(1u, 0u) == 1);
+        static_assert(LibMath::mortonEncode(0u, 1u) == 2);
+        static_assert(LibMath::mortonEncode(3u, 5u) == 0b100111);
+        static_assert(LibMath::mortonEncode(0xFFFFFFFFu, 0u) == 0x5555555555555555);
+        static_assert(LibMath::mortonEncode(1u, 1u, 1u) == 0b111);
+        static_assert(LibMath::mortonEncode(0u, 0u, 1u) == 0b100);
+        static_assert(LibMath::mortonEncode(0x1FFFFFu, 0x1FFFFFu, 0x1FFFFFu) == 0x7FFFFFFFFFFFFFFF);
+        static_assert(LibMath::mortonEncode(0xFFFFFFFFu, 0u, 0u) == 0x1249249249249249);
+        static_assert(LibMath::mortonDecode2D(0b100111) == LibMath::TVector2<uint32_t>(3u, 5u));
+        static_assert(LibMath::mortonDecode3D(0x7FFFFFFFFFFFFFFF) == LibMath::TVector3<uint32_t>(0x1FFFFFu));
+
+        // Runtime results may use BMI2 - both should match
+        uint32_t seed = 12345;
+
+        const auto next = [&seed]
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return seed;
+        };
+
+        for (int i = 0; i < 1000; i++)
+        {
+            const uint32_t x = next();
+            const uint32_t y = next();
+            const uint32_t z = next();
+
+            const uint64_t code2D = LibMath::mortonEncode(x, y);
+            CHECK(code2D == (LibMath::Details::spreadBits2D(x) | LibMath::Details::spreadBits2D(y) << 1));
+            CHECK(LibMath::mortonDecode2D(code2D) == LibMath::TVector2<uint32_t>(x, y));
+
+            const uint64_t code3D = LibMath::mortonEncode(x, y, z);
+            CHECK(code3D == (LibMath::Details::spreadBits3D(x) | LibMath::Details::spreadBits3D(y) << 1
+                | LibMath::Details::spreadBits3D(z) << 2));
+            CHECK(LibMath::mortonDecode3D(code3D) == LibMath::TVector3<uint32_t>(x & 0x1FFFFF, y & 0x1FFFFF, z & 0x1FFFFF));
+        }
+
+        CHECK(LibMath::mortonEncode(LibMath::Vector2I(3, 5)) == 0b100111);
+        CHECK(LibMath::mortonEncode(LibMath::Vector3L(1, 2, 4)) == 0b100010001);
+    }
+
+    SECTION("Grid")
+    {
+        const LibMath::BoundingBox bounds{ LibMath::Vector3(-1.f, 0.f, 10.f), LibMath::Vector3(1.f, 4.f, 10.f) };
+
+        CHECK(LibMath::toGridCell(bounds.m_min, bounds, 2) == LibMath::TVector3<uint32_t>(0u));
+        CHECK(LibMath::toGridCell(bounds.m_max, bounds, 2) == LibMath::TVector3<uint32_t>(3u, 3u, 0u));
+        CHECK(LibMath::toGridCell(LibMath::Vector3(-.1f, 1.5f, 10.f), bounds, 2) == LibMath::TVector3<uint32_t>(1u, 1u, 0u));
+        CHECK(LibMath::toGridCell(LibMath::Vector3(.1f, 2.5f, 10.f), bounds, 2) == LibMath::TVector3<uint32_t>(2u, 2u, 0u));
+
+        // Outside points are clamped to the border cells
+        CHECK(LibMath::toGridCell(LibMath::Vector3(-5.f, 5.f, 20.f), bounds, 2) == LibMath::TVector3<uint32_t>(0u, 3u, 0u));
+        CHECK(LibMath::toGridCell(bounds.m_max, bounds) == LibMath::TVector3<uint32_t>(0x1FFFFFu, 0x1FFFFFu, 0u));
+
+        // Sorting by code keeps each octant contiguous
+        const LibMath::BoundingBox unitBox{ LibMath::Vector3(0.f), LibMath::Vector3(1.f) };
+
+        std::vector<LibMath::Vector3> points;
+
+        for (int i = 0; i < 1000; i++)
+            points.emplace_back(static_cast<float>(i % 10) * .1f + .05f, static_cast<float>(i / 10 % 10) * .1f + .05f, static_cast<float>(i / 100) * .1f + .05f);
+
+        std::vector<uint64_t> codes(points.size());
+        LibMath::mortonEncode(points, unitBox, codes, LibMath::EExecutionPolicy::PARALLEL);
+
+        for (size_t i = 0; i < points.size(); i++)
+            CHECK(codes[i] == LibMath::mortonEncode(points[i], unitBox));
+
+        std::vector<size_t> order(points.size());
+
+        for (size_t i = 0; i < order.size(); i++)
+            order[i] = i;
+
+        std::sort(order.begin(), order.end(), [&codes](const size_t a, const size_t b)
+        {
+            return codes[a] < codes[b];
+        });
+
+        int octantChanges = 0;
+
+        for (size_t i = 1; i < order.size(); i++)
+        {
+            const LibMath::Vector3& previous = points[order[i - 1]];
+            const LibMath::Vector3& current  = points[order[i]];
+
+            if ((previous.m_x < .5f) != (current.m_x < .5f) || (previous.m_y < .5f) != (current.m_y < .5f)
+                || (previous.m_z < .5f) != (current.m_z < .5f))
+                octantChanges++;
+        }
+
+        CHECK(octantChanges == 7);
+    }
+
+    SECTION("Hash")
+    {
+        std::unordered_set<LibMath::Vector3I> cells;
+
+        for (int x = -8; x < 8; x++)
+        {
+            for (int y = -8; y < 8; y++)
+            {
+                for (int z = -8; z < 8; z++)
+                    cells.insert(LibMath::Vector3I(x, y, z));
+            }
+        }
+
+        CHECK(cells.size() == 16 * 16 * 16);
+        CHECK(cells.contains(LibMath::Vector3I(-8, 7, 0)));
+        CHECK_FALSE(cells.contains(LibMath::Vector3I(8, 0, 0)));
+
+        const std::hash<LibMath::Vector3I> hash3;
+        CHECK(hash3(LibMath::Vector3I(1, 2, 3)) != hash3(LibMath::Vector3I(3, 2, 1)));
+
+        const std::hash<LibMath::Vector2I> hash2;
+        CHECK(hash2(LibMath::Vector2I(0, 1)) == hash2(LibMath::Vector2I(0, 1)));
+        CHECK(hash2(LibMath::Vector2I(0, 1)) != hash2(LibMath::Vector2I(1, 0)));
+
+        const std::hash<LibMath::Vector4I> hash4;
+        CHECK(hash4(LibMath::Vector4I(1, 2, 3, 4)) == hash4(LibMath::Vector4I(1, 2, 3, 4)));
+        CHECK(hash4(LibMath::Vector4I(1, 2, 3, 4)) != hash4(LibMath::Vector4I(1, 2, 3, 5)));
+
+        // Float vectors compare approximately, which no hash can be consistent with
+        STATIC_CHECK(!std::is_default_constructible_v<std::hash<LibMath::Vector2>>);
+        STATIC_CHECK(!std::is_default_constructible_v<std::hash<LibMath::Vector3>>);
+        STATIC_CHECK(!std::is_default_constructible_v<std::hash<LibMath::Vector4>>);
+    }
+}
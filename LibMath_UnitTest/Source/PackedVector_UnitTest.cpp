@@ -0,0 +1,220 @@
+#include <Vector/PackedVector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+namespace
+{
+    // Not a multiple of the SIMD width to cover the remainders
+    constexpr size_t BATCH_SIZE = 37;
+
+    template <class VectorT>
+    std::vector<VectorT> makeVectors(const float scale)
+    {
+        std::vector<VectorT> vectors(BATCH_SIZE);
+
+        for (size_t i = 0; i < BATCH_SIZE; i++)
+        {
+            float* values = &vectors[i].m_x;
+
+            for (size_t j = 0; j < sizeof(VectorT) / sizeof(float); j++)
+                values[j] = std::sin(static_cast<float>(i * 7 + j * 3) * .37f) * scale;
+        }
+
+        return vectors;
+    }
+
+    template <class PackedT>
+    void checkBatch(const std::vector<typename PackedT::vector_type>& vectors)
+    {
+        using vector_type = typename PackedT::vector_type;
+
+        std::vector<PackedT>     packed(vectors.size());
+        std::vector<vector_type> unpacked(vectors.size());
+
+        PackedT::pack(vectors, packed);
+        PackedT::unpack(packed, unpacked);
+
+        // The batch kernels should give the exact same results as the per vector conversions
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            const PackedT single(vectors[i]);
+            CHECK(std::memcmp(&packed[i], &single, sizeof(PackedT)) == 0);
+            CHECK(unpacked[i] == packed[i].unpack());
+        }
+    }
+}
+
+TEST_CASE("Half", "[.all][vector][PackedVector]")
+{
+    SECTION("Conversion")
+    {
+        CHECK(LibMath::floatToHalf(0.f) == 0x0000);
+        CHECK(LibMath::floatToHalf(-0.f) == 0x8000);
+        CHECK(LibMath::floatToHalf(1.f) == 0x3C00);
+        CHECK(LibMath::floatToHalf(-2.f) == 0xC000);
+        CHECK(LibMath::floatToHalf(.5f) == 0x3800);
+        CHECK(LibMath::floatToHalf(65504.f) == 0x7BFF);
+        CHECK(LibMath::floatToHalf(6.1035156e-5f) == 0x0400); // Smallest normal
+        CHECK(LibMath::floatToHalf(5.9604645e-8f) == 0x0001); // Smallest subnormal
+
+        // Rounding to nearest even
+        CHECK(LibMath::floatToHalf(1.f + 1.f / 2048.f) == 0x3C00);
+        CHECK(LibMath::floatToHalf(1.f + 3.f / 2048.f) == 0x3C02);
+        CHECK(LibMath::floatToHalf(2.9802322e-8f) == 0x0000);
+
+        // Out of range and special values
+        CHECK(LibMath::floatToHalf(65520.f) == 0x7C00);
+        CHECK(LibMath::floatToHalf(-1e10f) == 0xFC00);
+        CHECK(LibMath::floatToHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+        CHECK((LibMath::floatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7E00) == 0x7E00);
+
+        CHECK(LibMath::halfToFloat(0x3C00) == 1.f);
+        CHECK(LibMath::halfToFloat(0xC000) == -2.f);
+        CHECK(LibMath::halfToFloat(0x7BFF) == 65504.f);
+        CHECK(LibMath::halfToFloat(0x0001) == 5.9604645e-8f);
+        CHECK(LibMath::halfToFloat(0x03FF) == 6.0975552e-5f);
+        CHECK(LibMath::halfToFloat(0x7C00) == std::numeric_limits<float>::infinity());
+        CHECK(std::isnan(LibMath::halfToFloat(0x7E00)));
+        CHECK(std::signbit(LibMath::halfToFloat(0x8000)));
+
+        // Every finite half round trips exactly
+        for (uint32_t half = 0; half < 0x10000; half++)
+        {
+            if ((half & 0x7C00) == 0x7C00)
+                continue;
+
+            if (LibMath::floatToHalf(LibMath::halfToFloat(static_cast<uint16_t>(half))) != half)
+                FAIL("Half round trip failed for " << half);
+        }
+    }
+
+    SECTION("Vectors")
+    {
+        const LibMath::Vector4 vector(1.f, -.333333f, 1000.f, 1e-6f);
+        const LibMath::Vector4 unpacked = LibMath::Vector4Half(vector).unpack();
+
+        CHECK(unpacked.m_x == 1.f);
+        CHECK(unpacked.m_y == Catch::Approx(vector.m_y).epsilon(1.f / 2048.f));
+        CHECK(unpacked.m_z == 1000.f);
+        CHECK(std::abs(unpacked.m_w - vector.m_w) <= 2.9802322e-8f);
+
+        CHECK(LibMath::Vector3Half().unpack() == LibMath::Vector3::zero());
+        CHECK(LibMath::Vector3Half(LibMath::Vector3(-1.5f, 2.f, 0.f)).unpack() == LibMath::Vector3(-1.5f, 2.f, 0.f));
+
+        checkBatch<LibMath::Vector3Half>(makeVectors<LibMath::Vector3>(100.f));
+        checkBatch<LibMath::Vector4Half>(makeVectors<LibMath::Vector4>(100.f));
+    }
+}
+
+TEMPLATE_TEST_CASE("NormalizedVector", "[.all][vector][PackedVector]", int8_t, uint8_t, int16_t, uint16_t)
+{
+    using Vector3Norm = LibMath::TNormalizedVector<TestType, 3>;
+    using Vector4Norm = LibMath::TNormalizedVector<TestType, 4>;
+
+    constexpr float maxValue = static_cast<float>(std::numeric_limits<TestType>::max());
+    constexpr float minValue = std::is_signed_v<TestType> ? -1.f : 0.f;
+    constexpr float maxError = .5f / maxValue;
+
+    SECTION("Conversion")
+    {
+        const Vector4Norm packed(LibMath::Vector4(1.f, 0.f, minValue, 2.f));
+        CHECK(packed.m_values[0] == std::numeric_limits<TestType>::max());
+        CHECK(packed.m_values[1] == 0);
+        CHECK(packed.m_values[3] == std::numeric_limits<TestType>::max());
+
+        // Bounds and 0 are stored exactly, out of range values are clamped
+        CHECK(packed.unpack() == LibMath::Vector4(1.f, 0.f, minValue, 1.f));
+        CHECK(Vector4Norm(LibMath::Vector4(-5.f)).unpack() == LibMath::Vector4(minValue));
+
+        if constexpr (std::is_signed_v<TestType>)
+        {
+            // The extra negative value also maps to -1
+            Vector3Norm lowest;
+            lowest.m_values[0] = std::numeric_limits<TestType>::lowest();
+            CHECK(lowest.unpack().m_x == -1.f);
+        }
+
+        for (int i = 0; i <= 1000; i++)
+        {
+            const float value = minValue + (1.f - minValue) * static_cast<float>(i) / 1000.f;
+            const float error = std::abs(Vector3Norm(LibMath::Vector3(value)).unpack().m_x - value);
+
+            if (error > maxError * 1.0001f)
+                FAIL("Error of " << error << " for " << value);
+        }
+    }
+
+    SECTION("Vectors")
+    {
+        checkBatch<Vector3Norm>(makeVectors<LibMath::Vector3>(1.2f));
+        checkBatch<Vector4Norm>(makeVectors<LibMath::Vector4>(1.2f));
+
+        std::vector<LibMath::Vector4> nans(BATCH_SIZE, LibMath::Vector4(std::numeric_limits<float>::quiet_NaN()));
+        std::vector<Vector4Norm>      packed(BATCH_SIZE);
+
+        Vector4Norm::pack(nans, packed);
+        CHECK(packed.back().unpack() == LibMath::Vector4(1.f));
+        CHECK(packed.front().unpack() == LibMath::Vector4(1.f));
+    }
+}
+
+TEST_CASE("Vector3Octahedral", "[.all][vector][PackedVector]")
+{
+    SECTION("Conversion")
+    {
+        CHECK(LibMath::Vector3Octahedral().unpack() == LibMath::Vector3::front());
+
+        const LibMath::Vector3 axes[] = {
+            LibMath::Vector3::right(), LibMath::Vector3::left(), LibMath::Vector3::up(),
+            LibMath::Vector3::down(), LibMath::Vector3::front(), LibMath::Vector3::back()
+        };
+
+        for (const LibMath::Vector3& axis : axes)
+            CHECK(LibMath::Vector3Octahedral(axis).unpack() == axis);
+
+        // Packed vectors don't need to be normalized
+        CHECK(LibMath::Vector3Octahedral(LibMath::Vector3(0.f, -5.f, 0.f)).unpack() == LibMath::Vector3::down());
+
+        // Documented bound : 7e-5 radians
+        double maxAngle         = 0.;
+        float  maxMagnitudeError = 0.f;
+
+        for (int i = 0; i < 100000; i++)
+        {
+            // Fibonacci sphere
+            const float z     = 1.f - 2.f * (static_cast<float>(i) + .5f) / 100000.f;
+            const float r     = std::sqrt(1.f - z * z);
+            const float theta = 2.39996323f * static_cast<float>(i);
+
+            const LibMath::Vector3 vector(r * std::cos(theta), r * std::sin(theta), z);
+            const LibMath::Vector3 unpacked = LibMath::Vector3Octahedral(vector).unpack();
+
+            maxMagnitudeError = std::max(maxMagnitudeError, std::abs(unpacked.magnitudeSquared() - 1.f));
+
+            // atan2(|a x b|, a . b) stays accurate for tiny angles, unlike acos(a . b)
+            const double crossX = static_cast<double>(vector.m_y) * unpacked.m_z - static_cast<double>(vector.m_z) * unpacked.m_y;
+            const double crossY = static_cast<double>(vector.m_z) * unpacked.m_x - static_cast<double>(vector.m_x) * unpacked.m_z;
+            const double crossZ = static_cast<double>(vector.m_x) * unpacked.m_y - static_cast<double>(vector.m_y) * unpacked.m_x;
+            const double dot    = static_cast<double>(vector.m_x) * unpacked.m_x + static_cast<double>(vector.m_y) * unpacked.m_y
+                + static_cast<double>(vector.m_z) * unpacked.m_z;
+
+            maxAngle = std::max(maxAngle, std::atan2(std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ), dot));
+        }
+
+        CHECK(maxMagnitudeError <= 1e-6f);
+        CHECK(maxAngle <= 7e-5);
+    }
+
+    SECTION("Vectors")
+    {
+        checkBatch<LibMath::Vector3Octahedral>(makeVectors<LibMath::Vector3>(3.f));
+    }
+}
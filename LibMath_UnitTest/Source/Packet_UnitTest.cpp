@@ -0,0 +1,454 @@
+#include <Packet.h>
+#include <Quaternion.h>
+#include <Matrix.h>
+#include <Vector/Vector2.h>
+#include <Vector/Vector3.h>
+#include <Vector/Vector4.h>
+
+#include <cmath>
+#include <limits>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+template <class PacketT>
+static PacketT makePacket(const float start, const float step)
+{
+    float values[PacketT::SIZE];
+
+    for (size_t i = 0; i < PacketT::SIZE; i++)
+        values[i] = start + static_cast<float>(i) * step;
+
+    return PacketT::load(values);
+}
+
+template <class PacketT>
+static LibMath::TVector3<PacketT> makeVector(const LibMath::Vector3& start, const LibMath::Vector3& step)
+{
+    return { makePacket<PacketT>(start.m_x, step.m_x), makePacket<PacketT>(start.m_y, step.m_y),
+        makePacket<PacketT>(start.m_z, step.m_z) };
+}
+
+template <class PacketT>
+static LibMath::Vector3 getLane(const LibMath::TVector3<PacketT>& vector, const size_t lane)
+{
+    return { vector.m_x[lane], vector.m_y[lane], vector.m_z[lane] };
+}
+
+// Lanes are computed in a different order than the scalar versions - compare with a margin for the near zero results
+#define CHECK_VECTOR3(vector, expected) CHECK((vector).m_x == Catch::Approx((expected).m_x).margin(1e-4)); CHECK((vector).m_y == Catch::Approx((expected).m_y).margin(1e-4)); CHECK((vector).m_z == Catch::Approx((expected).m_z).margin(1e-4))
+
+TEMPLATE_TEST_CASE("Packet", "[.all][packet]", LibMath::Float4, LibMath::Float8, LibMath::Float16)
+{
+    constexpr size_t size = TestType::SIZE;
+
+    SECTION("Instantiation")
+    {
+        const TestType zero;
+        const TestType broadcast(2.5f);
+        const TestType loaded = makePacket<TestType>(-3.f, 1.f);
+
+        float stored[size];
+        loaded.store(stored);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK(zero[i] == 0.f);
+            CHECK(broadcast[i] == 2.5f);
+            CHECK(loaded[i] == static_cast<float>(i) - 3.f);
+            CHECK(stored[i] == loaded[i]);
+        }
+    }
+
+    SECTION("Arithmetic")
+    {
+        const TestType a = makePacket<TestType>(-3.f, 1.f);
+        const TestType b = makePacket<TestType>(1.f, .5f);
+
+        const TestType sum = a + b;
+        const TestType difference = a - b;
+        const TestType product = a * b;
+        const TestType quotient = a / b;
+        const TestType negated = -a;
+        const TestType scaled = 2.f * a + 1.f;
+        const TestType halved = a / 2.f - 1.f;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK(sum[i] == a[i] + b[i]);
+            CHECK(difference[i] == a[i] - b[i]);
+            CHECK(product[i] == a[i] * b[i]);
+            CHECK(quotient[i] == a[i] / b[i]);
+            CHECK(negated[i] == -a[i]);
+            CHECK(scaled[i] == 2.f * a[i] + 1.f);
+            CHECK(halved[i] == a[i] / 2.f - 1.f);
+        }
+
+        TestType accumulator(1.f);
+        accumulator += b;
+        accumulator *= a;
+        accumulator -= 1.f;
+        accumulator /= b;
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(accumulator[i] == ((1.f + b[i]) * a[i] - 1.f) / b[i]);
+    }
+
+    SECTION("Masks")
+    {
+        const TestType a = makePacket<TestType>(-3.f, 1.f);
+        const TestType b(0.f);
+
+        const auto negative = a < b;
+        const auto positive = a > 0.f;
+        const auto zero = a == b;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK(negative[i] == (a[i] < 0.f));
+            CHECK(positive[i] == (a[i] > 0.f));
+            CHECK(zero[i] == (a[i] == 0.f));
+            CHECK((a <= b)[i] == (a[i] <= 0.f));
+            CHECK((a >= 0.f)[i] == (a[i] >= 0.f));
+            CHECK((a != b)[i] == (a[i] != 0.f));
+            CHECK((negative | zero)[i] == (a[i] <= 0.f));
+            CHECK((negative & zero)[i] == false);
+            CHECK((negative ^ positive)[i] == (a[i] != 0.f));
+            CHECK((!positive)[i] == (a[i] <= 0.f));
+        }
+
+        CHECK(LibMath::any(negative));
+        CHECK_FALSE(LibMath::all(negative));
+        CHECK(LibMath::all(negative | zero | positive));
+        CHECK_FALSE(LibMath::any(negative & positive));
+
+        CHECK(LibMath::all(decltype(negative)(true)));
+        CHECK_FALSE(LibMath::any(decltype(negative)(false)));
+
+        const TestType selected = LibMath::select(negative, -a, a * 10.f);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(selected[i] == (a[i] < 0.f ? -a[i] : a[i] * 10.f));
+    }
+
+    SECTION("Functions")
+    {
+        const TestType a = makePacket<TestType>(-3.f, 1.f);
+        const TestType b = makePacket<TestType>(4.f, -.75f);
+        const TestType positive = makePacket<TestType>(.25f, 1.5f);
+
+        const TestType root = LibMath::squareRoot(positive);
+        const TestType inverseRoot = LibMath::inverseSquareRoot(positive);
+        const TestType balancedInverseRoot = LibMath::inverseSquareRoot(positive, LibMath::EPrecision::BALANCED);
+        const TestType fastInverseRoot = LibMath::inverseSquareRoot(positive, LibMath::EPrecision::FAST);
+        const TestType minimum = LibMath::min(a, b);
+        const TestType maximum = LibMath::max(a, b);
+        const TestType absolute = LibMath::abs(a);
+        const TestType sign = LibMath::sign(a);
+        const TestType clamped = LibMath::clamp(a, TestType(-1.f), TestType(2.f));
+        const TestType snapped = LibMath::snap(a, TestType(-1.f), TestType(2.f));
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK(root[i] == LibMath::squareRoot(positive[i]));
+            CHECK(inverseRoot[i] == LibMath::inverseSquareRoot(positive[i]));
+            CHECK(balancedInverseRoot[i] == Catch::Approx(LibMath::inverseSquareRoot(positive[i])).epsilon(1e-6));
+            CHECK(fastInverseRoot[i] == Catch::Approx(LibMath::inverseSquareRoot(positive[i])).epsilon(1e-3));
+            CHECK(minimum[i] == LibMath::min(a[i], b[i]));
+            CHECK(maximum[i] == LibMath::max(a[i], b[i]));
+            CHECK(absolute[i] == LibMath::abs(a[i]));
+            CHECK(sign[i] == LibMath::sign(a[i]));
+            CHECK(clamped[i] == LibMath::clamp(a[i], -1.f, 2.f));
+            CHECK(snapped[i] == LibMath::snap(a[i], -1.f, 2.f));
+        }
+
+        CHECK(LibMath::floatEquals(a, a + 1e-6f));
+        CHECK_FALSE(LibMath::floatEquals(a, a + makePacket<TestType>(0.f, 1.f)));
+        CHECK(LibMath::isInRange(a, TestType(-3.f), TestType(static_cast<float>(size))));
+        CHECK_FALSE(LibMath::isInRange(a, TestType(-3.f), TestType(-1.f)));
+
+        // Exact results are kept for the special values
+        const TestType zero(0.f);
+        const TestType infinity(std::numeric_limits<float>::infinity());
+
+        CHECK(LibMath::inverseSquareRoot(zero, LibMath::EPrecision::BALANCED)[0] == std::numeric_limits<float>::infinity());
+        CHECK(LibMath::inverseSquareRoot(infinity, LibMath::EPrecision::BALANCED)[0] == 0.f);
+
+        // Subnormals are out of the hardware estimate's range
+        const TestType subnormal = makePacket<TestType>(1e-40f, 1e-40f);
+        const TestType fastSubnormalRoot = LibMath::inverseSquareRoot(subnormal, LibMath::EPrecision::FAST);
+        const TestType balancedSubnormalRoot = LibMath::inverseSquareRoot(subnormal, LibMath::EPrecision::BALANCED);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const auto expected = static_cast<float>(1. / std::sqrt(static_cast<double>(subnormal[i])));
+
+            CHECK(fastSubnormalRoot[i] == Catch::Approx(expected).epsilon(1e-3));
+            CHECK(balancedSubnormalRoot[i] == Catch::Approx(expected).epsilon(1e-5));
+        }
+
+        const LibMath::TVector3<TestType> tinyVector(TestType(1e-20f), TestType(0.f), TestType(-1e-20f));
+        const LibMath::TVector3<TestType> tinyNormalized = tinyVector.normalized();
+
+        CHECK(tinyNormalized.m_x[size - 1] == Catch::Approx(.70710678f));
+        CHECK(tinyNormalized.m_z[size - 1] == Catch::Approx(-.70710678f));
+    }
+
+    SECTION("Vector")
+    {
+        using Vector3P = LibMath::TVector3<TestType>;
+
+        const LibMath::Vector3 leftStart(1.f, -2.f, .5f), leftStep(.5f, .25f, -1.f);
+        const LibMath::Vector3 rightStart(-3.f, 1.f, 2.f), rightStep(.75f, -.5f, .125f);
+
+        const Vector3P left = makeVector<TestType>(leftStart, leftStep);
+        const Vector3P right = makeVector<TestType>(rightStart, rightStep);
+
+        const TestType dot = left.dot(right);
+        const Vector3P cross = left.cross(right);
+        const Vector3P normalized = left.normalized();
+        const TestType magnitude = left.magnitude();
+        const TestType distance = left.distanceFrom(right);
+        const Vector3P combined = left * 2.f + right / TestType(4.f) - TestType(1.f);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const auto lane = static_cast<float>(i);
+            const LibMath::Vector3 leftLane = leftStart + leftStep * lane;
+            const LibMath::Vector3 rightLane = rightStart + rightStep * lane;
+
+            CHECK(getLane(left, i) == leftLane);
+            CHECK(dot[i] == Catch::Approx(leftLane.dot(rightLane)));
+            CHECK(magnitude[i] == Catch::Approx(leftLane.magnitude()));
+            CHECK(distance[i] == Catch::Approx(leftLane.distanceFrom(rightLane)));
+            CHECK_VECTOR3(getLane(cross, i), leftLane.cross(rightLane));
+            CHECK_VECTOR3(getLane(normalized, i), leftLane.normalized());
+            CHECK_VECTOR3(getLane(combined, i), leftLane * 2.f + rightLane / 4.f - 1.f);
+        }
+
+        // Vectors are only equal if all their lanes are
+        const bool isEqual = left == left + 1e-7f;
+        const bool isDifferent = left != right;
+
+        CHECK(isEqual);
+        CHECK(isDifferent);
+
+        // Magnitude comparisons only hold if they hold in every lane
+        const Vector3P longer = left * 2.f;
+
+        const bool isLonger = longer.isLongerThan(left);
+        const bool isShorter = left.isShorterThan(longer);
+        const bool isGreater = longer > left;
+        const bool isLess = left < longer;
+        const bool isGreaterOrEqual = longer >= left;
+        const bool isLessOrEqual = left <= left;
+
+        CHECK(isLonger);
+        CHECK(isShorter);
+        CHECK(isGreater);
+        CHECK(isLess);
+        CHECK(isGreaterOrEqual);
+        CHECK(isLessOrEqual);
+
+        // Some lanes of left are longer than right's and others are shorter
+        const bool isMixedLonger = left.isLongerThan(right);
+        const bool isMixedShorter = left.isShorterThan(right);
+        const bool isMixedGreaterOrEqual = left >= right;
+        const bool isMixedLessOrEqual = left <= right;
+
+        CHECK_FALSE(isMixedLonger);
+        CHECK_FALSE(isMixedShorter);
+        CHECK_FALSE(isMixedGreaterOrEqual);
+        CHECK_FALSE(isMixedLessOrEqual);
+
+        const LibMath::TVector2<TestType> left2(left.m_x, left.m_y);
+        const LibMath::TVector4<TestType> left4(left.m_x, left.m_y, left.m_z, TestType(1.f));
+
+        const bool isLonger2 = (left2 * 2.f).isLongerThan(left2);
+        const bool isShorter2 = left2.isShorterThan(left2 * 2.f);
+        const bool isLessOrEqual2 = left2 <= left2;
+        const bool isLonger4 = (left4 * 2.f).isLongerThan(left4);
+        const bool isShorter4 = left4.isShorterThan(left4 * 2.f);
+        const bool isGreaterOrEqual4 = left4 >= left4;
+
+        CHECK(isLonger2);
+        CHECK(isShorter2);
+        CHECK(isLessOrEqual2);
+        CHECK(isLonger4);
+        CHECK(isShorter4);
+        CHECK(isGreaterOrEqual4);
+    }
+
+    SECTION("Quaternion")
+    {
+        using Vector3P = LibMath::TVector3<TestType>;
+        using QuaternionP = LibMath::TQuaternion<TestType>;
+
+        const LibMath::Vector3 axisStart(0.f, 1.f, .5f), axisStep(.25f, -.5f, 1.f);
+        const LibMath::Vector3 pointStart(1.f, 2.f, -3.f), pointStep(-.5f, .25f, .75f);
+
+        const TestType angles = makePacket<TestType>(-1.5f, .375f);
+        const Vector3P axes = makeVector<TestType>(axisStart, axisStep).normalized();
+        const Vector3P points = makeVector<TestType>(pointStart, pointStep);
+
+        // Angles are scalars - build the rotations from their half angles' cosine and sine
+        float cosines[size], sines[size];
+
+        for (size_t i = 0; i < size; i++)
+        {
+            cosines[i] = std::cos(angles[i] * .5f);
+            sines[i] = std::sin(angles[i] * .5f);
+        }
+
+        const QuaternionP rotation(TestType::load(cosines), axes * TestType::load(sines));
+        const QuaternionP combined = (rotation * rotation.conjugate() * rotation).normalized();
+        const Vector3P rotated = combined.rotate(points);
+        const Vector3P restored = combined.inverse().rotate(rotated);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const LibMath::Vector3 pointLane = pointStart + pointStep * static_cast<float>(i);
+            const LibMath::Quaternion rotationLane(LibMath::Radian(angles[i]), getLane(axes, i));
+
+            CHECK_VECTOR3(getLane(rotated, i), rotationLane.rotate(pointLane));
+            CHECK_VECTOR3(getLane(restored, i), pointLane);
+        }
+
+        // Each lane takes its own branch - small angles are w dominant, half turns around x, y or z are axis dominant
+        const LibMath::Vector3 unitAxes[] = { LibMath::Vector3::right(), LibMath::Vector3::up(), LibMath::Vector3::front() };
+
+        LibMath::Quaternion rotationLanes[size];
+        LibMath::TMatrix<4, 4, TestType> matrices;
+
+        for (size_t i = 0; i < size; i++)
+            rotationLanes[i] = LibMath::Quaternion(LibMath::Radian(i % 4 == 0 ? .2f : 2.9f), unitAxes[i % 3]);
+
+        for (size_t index = 0; index < 16; index++)
+        {
+            float values[size];
+
+            for (size_t i = 0; i < size; i++)
+                values[i] = LibMath::rotation(rotationLanes[i])[index];
+
+            matrices[index] = TestType::load(values);
+        }
+
+        const QuaternionP fromMatrices(matrices);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const LibMath::Quaternion expected(LibMath::rotation(rotationLanes[i]));
+
+            CHECK(fromMatrices.m_w[i] == Catch::Approx(expected.m_w).margin(1e-5));
+            CHECK(fromMatrices.m_x[i] == Catch::Approx(expected.m_x).margin(1e-5));
+            CHECK(fromMatrices.m_y[i] == Catch::Approx(expected.m_y).margin(1e-5));
+            CHECK(fromMatrices.m_z[i] == Catch::Approx(expected.m_z).margin(1e-5));
+
+            // Same rotation as the source quaternion (up to the sign)
+            CHECK(LibMath::abs(expected.dot(rotationLanes[i])) == Catch::Approx(1.f));
+        }
+
+        // Opposite vectors in the even lanes only
+        const Vector3P from = points.normalized();
+        float toX[size], toY[size], toZ[size];
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const LibMath::Vector3 toLane = i % 2 == 0 ? -getLane(from, i) : getLane(axes, i);
+
+            toX[i] = toLane.m_x;
+            toY[i] = toLane.m_y;
+            toZ[i] = toLane.m_z;
+        }
+
+        const Vector3P to(TestType::load(toX), TestType::load(toY), TestType::load(toZ));
+        const QuaternionP fromTo = QuaternionP::fromTo(from, to);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const LibMath::Quaternion expected = LibMath::Quaternion::fromTo(getLane(from, i), getLane(to, i));
+
+            CHECK(fromTo.m_w[i] == Catch::Approx(expected.m_w).margin(1e-5));
+            CHECK(fromTo.m_x[i] == Catch::Approx(expected.m_x).margin(1e-5));
+            CHECK(fromTo.m_y[i] == Catch::Approx(expected.m_y).margin(1e-5));
+            CHECK(fromTo.m_z[i] == Catch::Approx(expected.m_z).margin(1e-5));
+        }
+    }
+
+    SECTION("Matrix")
+    {
+        using MatrixP = LibMath::TMatrix<4, 4, TestType>;
+        using MatrixF = LibMath::TMatrix<4, 4, float>;
+
+        MatrixP left, right;
+
+        for (size_t index = 0; index < 16; index++)
+        {
+            left[index] = makePacket<TestType>(static_cast<float>(index) - 8.f, .5f);
+            right[index] = makePacket<TestType>(static_cast<float>(index % 5), -.25f);
+        }
+
+        const MatrixP product = left * right;
+        const MatrixP transposed = product.transposed();
+
+        for (size_t i = 0; i < size; i++)
+        {
+            MatrixF leftLane, rightLane;
+
+            for (size_t index = 0; index < 16; index++)
+            {
+                leftLane[index] = left[index][i];
+                rightLane[index] = right[index][i];
+            }
+
+            const MatrixF productLane = leftLane * rightLane;
+
+            for (LibMath::length_t row = 0; row < 4; row++)
+            {
+                for (LibMath::length_t column = 0; column < 4; column++)
+                {
+                    CHECK(product(row, column)[i] == Catch::Approx(productLane(row, column)));
+                    CHECK(transposed(column, row)[i] == Catch::Approx(productLane(row, column)));
+                }
+            }
+        }
+
+        // Diagonally dominant matrices are invertible in every lane
+        MatrixP invertible = left;
+
+        for (LibMath::length_t index = 0; index < 4; index++)
+            invertible(index, index) += TestType(20.f);
+
+        MatrixP affine = invertible;
+
+        for (LibMath::length_t column = 0; column < 4; column++)
+            affine(3, column) = TestType(column == 3 ? 1.f : 0.f);
+
+        const TestType determinant = invertible.determinant();
+        const MatrixP  inverse = invertible.inverse();
+        const MatrixP  inverseAffine = affine.inverseAffine();
+
+        for (size_t i = 0; i < size; i++)
+        {
+            MatrixF invertibleLane, affineLane;
+
+            for (size_t index = 0; index < 16; index++)
+            {
+                invertibleLane[index] = invertible[index][i];
+                affineLane[index] = affine[index][i];
+            }
+
+            const MatrixF inverseLane = invertibleLane.inverse();
+            const MatrixF inverseAffineLane = affineLane.inverseAffine();
+
+            CHECK(determinant[i] == Catch::Approx(invertibleLane.determinant()));
+
+            for (size_t index = 0; index < 16; index++)
+            {
+                CHECK(inverse[index][i] == Catch::Approx(inverseLane[index]).margin(1e-6));
+                CHECK(inverseAffine[index][i] == Catch::Approx(inverseAffineLane[index]).margin(1e-6));
+            }
+        }
+    }
+}
@@ -1,7 +1,10 @@
 ﻿#include <Quaternion.h>
+#include <QuaternionBatch.h>
 
 #include <Angle/Degree.h>
 
+#include <vector>
+
 #define GLM_ENABLE_EXPERIMENTAL
 #define GLM_FORCE_XYZW_ONLY
 #include <catch2/catch_approx.hpp>
@@ -94,6 +97,12 @@ TEST_CASE("Quaternion", "[.all][quaternion]")
         glm::dquat           dAxisAngleGlm{ glm::angleAxis<double>(glm::radians(180.f), glm::dvec3(1, 0, 0)) };
         CHECK_QUATERNION(dAxisAngle, dAxisAngleGlm);
 
+        // Rotation constants don't need any runtime initialization
+        constexpr LibMath::Quaternion constAxisAngle{ 180_deg, LibMath::Vector3(1, 0, 0) };
+        STATIC_CHECK(LibMath::abs(constAxisAngle.m_x - 1.f) < 1e-6f);
+        STATIC_CHECK(LibMath::abs(constAxisAngle.m_w) < 1e-6f);
+        CHECK_QUATERNION(constAxisAngle, axisAngleGlm);
+
         // from-to
         LibMath::Quaternion fromTo = LibMath::Quaternion::fromTo(LibMath::Vector3::front(), LibMath::Vector3::right());
         glm::quat           fromToGlm = glm::angleAxis(glm::radians(90.f), glm::vec3{ 0, 1, 0 });
@@ -188,6 +197,11 @@ TEST_CASE("Quaternion", "[.all][quaternion]")
         CHECK_QUATERNION(matrix, yawPitchRollGlm);
         CHECK(matrix == LibMath::Quaternion(angles.m_x, angles.m_y, angles.m_z));
 
+        // column-major matrix
+        matrix = LibMath::Quaternion{ LibMath::rotation<float, LibMath::EMatrixOrder::COLUMN_MAJOR>(angles.m_x, angles.m_y,
+            angles.m_z) };
+        CHECK_QUATERNION(matrix, yawPitchRollGlm);
+
         LibMath::Matrix4 rotMat;
         rotMat(0, 0) = 1;
         rotMat(1, 1) = 1;
@@ -747,6 +761,62 @@ TEST_CASE("Quaternion", "[.all][quaternion]")
             CHECK_QUATERNION(normalize, normalizeGlm);
 
             CHECK_QUATERNION(base.normalized(), normalizeGlm);
+
+            // The squared magnitude of tiny quaternions is subnormal
+            const LibMath::Quaternion tiny = LibMath::Quaternion(1e-20f, 0.f, 0.f, 0.f).normalized();
+
+            CHECK(tiny.m_w == Catch::Approx(1.f));
+            CHECK(tiny.m_x == 0.f);
+            CHECK(tiny.m_y == 0.f);
+            CHECK(tiny.m_z == 0.f);
+        }
+
+        SECTION("Rotation")
+        {
+            constexpr LibMath::Quaternion unit = base.normalized();
+            constexpr LibMath::Vector3    vector{ 1.5f, -2.f, .25f };
+
+            const glm::vec4 rotatedGlm = baseMatNormGlm * glm::vec4{ vector.m_x, vector.m_y, vector.m_z, 0.f };
+
+            const LibMath::Vector3 rotated = unit.rotate(vector);
+            CHECK(rotated.m_x == Catch::Approx(rotatedGlm.x));
+            CHECK(rotated.m_y == Catch::Approx(rotatedGlm.y));
+            CHECK(rotated.m_z == Catch::Approx(rotatedGlm.z));
+
+            // Same result as the sandwich product
+            const LibMath::Vector3 sandwich = unit * LibMath::Quaternion(0.f, vector) * unit.inverse();
+            CHECK(rotated == sandwich);
+            CHECK(unit * vector == rotated);
+
+            constexpr LibMath::Vector3 rotatedConstexpr = unit * vector;
+            CHECK(rotatedConstexpr == rotated);
+
+            LibMath::Vector3 rotatedInPlace = vector;
+            rotatedInPlace.rotate(unit);
+            CHECK(rotatedInPlace == rotated);
+
+            // Batch - not a multiple of the kernel's width to cover the remainder
+            constexpr size_t batchSize = 1027;
+
+            std::vector<LibMath::Vector3> vectors(batchSize);
+
+            for (size_t i = 0; i < batchSize; i++)
+                vectors[i] = { static_cast<float>(i % 17) - 8.f, static_cast<float>(i % 5) * .5f, static_cast<float>(i % 11) + 1.f };
+
+            std::vector<LibMath::Vector3> out(batchSize);
+            size_t                        mismatches = 0;
+
+            LibMath::rotateVectors(unit, vectors, out);
+
+            for (size_t i = 0; i < batchSize; i++)
+                mismatches += out[i] != unit.rotate(vectors[i]);
+
+            LibMath::rotateVectors(unit, out, LibMath::EExecutionPolicy::PARALLEL);
+
+            for (size_t i = 0; i < batchSize; i++)
+                mismatches += out[i] != unit.rotate(unit.rotate(vectors[i]));
+
+            CHECK(mismatches == 0);
         }
     }
 
@@ -789,6 +859,52 @@ TEST_CASE("Quaternion", "[.all][quaternion]")
         }
     }
 
+    SECTION("Simd")
+    {
+        STATIC_CHECK(alignof(LibMath::Quaternion) == 16);
+        STATIC_CHECK(sizeof(LibMath::Quaternion) == 4 * sizeof(float));
+
+        // Runtime operations (SIMD when available) should match the constant evaluated ones (always scalar)
+        constexpr LibMath::Quaternion left{ 3.f, 2.5f, -.5f, 2.f };
+        constexpr LibMath::Quaternion right{ -1.f, .25f, 1.5f, -.75f };
+
+        LibMath::Quaternion runtimeLeft = left;
+
+        constexpr LibMath::Quaternion sum = left + right;
+        CHECK(runtimeLeft + right == sum);
+
+        constexpr LibMath::Quaternion difference = left - right;
+        CHECK(runtimeLeft - right == difference);
+
+        constexpr LibMath::Quaternion product = left * right;
+        CHECK(runtimeLeft * right == product);
+
+        constexpr LibMath::Quaternion quotient = left / right;
+        CHECK(runtimeLeft / right == quotient);
+
+        constexpr LibMath::Quaternion scaled = left * 2.5f / 2;
+        CHECK(runtimeLeft * 2.5f / 2 == scaled);
+
+        constexpr float dot = left.dot(right);
+        CHECK(runtimeLeft.dot(right) == dot);
+
+        constexpr float magnitudeSquared = left.magnitudeSquared();
+        CHECK(runtimeLeft.magnitudeSquared() == magnitudeSquared);
+
+        constexpr LibMath::Quaternion conjugate = left.conjugate();
+        CHECK(runtimeLeft.conjugate() == conjugate);
+
+        constexpr LibMath::Quaternion inverse = left.inverse();
+        CHECK(runtimeLeft.inverse() == inverse);
+
+        constexpr LibMath::Quaternion normalized = left.normalized();
+        CHECK(runtimeLeft.normalized() == normalized);
+
+        runtimeLeft.normalize();
+        CHECK(runtimeLeft == normalized);
+        CHECK(runtimeLeft.isUnit());
+    }
+
     SECTION("Debug")
     {
 #if defined(_DEBUG) || defined(DEBUG) || !defined(NDEBUG)
@@ -0,0 +1,268 @@
+#include <Serialization.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <Matrix/Matrix4.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    class Random
+    {
+    public:
+        float next(const float min, const float max)
+        {
+            m_seed = m_seed * 1664525u + 1013904223u;
+            return min + (max - min) * static_cast<float>(m_seed >> 8) / static_cast<float>(1u << 24);
+        }
+
+        LibMath::Vector3 nextVector(const float min, const float max)
+        {
+            return { next(min, max), next(min, max), next(min, max) };
+        }
+
+        LibMath::Quaternion nextRotation()
+        {
+            return LibMath::Quaternion(next(-1.f, 1.f), next(-1.f, 1.f), next(-1.f, 1.f), next(-1.f, 1.f)).normalized();
+        }
+
+    private:
+        uint32_t m_seed = 12345;
+    };
+
+    bool areBitsEqual(const float* first, const float* second, const size_t count)
+    {
+        return std::memcmp(first, second, count * sizeof(float)) == 0;
+    }
+
+    template <class T>
+    void checkRawRoundTrip(const std::vector<T>& values)
+    {
+        std::vector<std::byte> buffer(LibMath::getBinarySize<T>(values.size()));
+
+        LibMath::BinaryWriter writer(buffer);
+        REQUIRE(writer.writeArray<T>(values));
+        CHECK(writer.getOffset() == buffer.size());
+
+        std::vector<T>        read(values.size());
+        LibMath::BinaryReader reader(buffer);
+        REQUIRE(reader.readArray<T>(read));
+        CHECK(reader.getRemaining() == 0);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            float expected[LibMath::Details::BinaryLayout<T>::FLOAT_COUNT];
+            float actual[LibMath::Details::BinaryLayout<T>::FLOAT_COUNT];
+
+            LibMath::Details::BinaryLayout<T>::store(values[i], expected);
+            LibMath::Details::BinaryLayout<T>::store(read[i], actual);
+            CHECK(areBitsEqual(expected, actual, LibMath::Details::BinaryLayout<T>::FLOAT_COUNT));
+        }
+    }
+}
+
+TEST_CASE("Serialization", "[.all][Serialization]")
+{
+    Random random;
+
+    SECTION("Header")
+    {
+        std::byte buffer[16];
+
+        LibMath::BinaryWriter writer(buffer, LibMath::EBinaryEncoding::QUANTIZED);
+        REQUIRE(writer.writeHeader());
+        CHECK(writer.getOffset() == 8);
+        CHECK(static_cast<char>(buffer[0]) == 'L');
+        CHECK(static_cast<char>(buffer[3]) == 'F');
+        CHECK(buffer[4] == std::byte{ LibMath::BINARY_FORMAT_VERSION });
+        CHECK(buffer[5] == std::byte{ 0 });
+
+        LibMath::BinaryReader reader(buffer);
+        CHECK(reader.readHeader());
+        CHECK(reader.getEncoding() == LibMath::EBinaryEncoding::QUANTIZED);
+        CHECK(reader.getVersion() == LibMath::BINARY_FORMAT_VERSION);
+        CHECK(reader.getOffset() == 8);
+
+        // Invalid headers are rejected and nothing is read
+        std::byte invalid[8];
+
+        std::memcpy(invalid, buffer, sizeof(invalid));
+        invalid[0] = std::byte{ 'X' };
+        LibMath::BinaryReader badMagic(invalid);
+        CHECK_FALSE(badMagic.readHeader());
+        CHECK(badMagic.getOffset() == 0);
+
+        std::memcpy(invalid, buffer, sizeof(invalid));
+        invalid[4] = std::byte{ LibMath::BINARY_FORMAT_VERSION + 1 };
+        CHECK_FALSE(LibMath::BinaryReader(invalid).readHeader());
+
+        std::memcpy(invalid, buffer, sizeof(invalid));
+        invalid[6] = std::byte{ 42 };
+        CHECK_FALSE(LibMath::BinaryReader(invalid).readHeader());
+
+        CHECK_FALSE(LibMath::BinaryReader(std::span<const std::byte>(buffer, 7)).readHeader());
+        CHECK_FALSE(LibMath::BinaryWriter(std::span<std::byte>(buffer, 7)).writeHeader());
+    }
+
+    SECTION("Raw")
+    {
+        // Floats are stored as little-endian IEEE 754 floats
+        std::byte buffer[12];
+
+        LibMath::BinaryWriter writer(buffer);
+        REQUIRE(writer.write(LibMath::Vector3(1.f, -2.f, 0.f)));
+
+        const uint8_t expected[] = { 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00 };
+
+        for (size_t i = 0; i < sizeof(expected); i++)
+            CHECK(static_cast<uint8_t>(buffer[i]) == expected[i]);
+
+        // Integers too
+        LibMath::BinaryWriter integerWriter(buffer);
+        REQUIRE(integerWriter.write<uint32_t>(0x12345678));
+        CHECK(static_cast<uint8_t>(buffer[0]) == 0x78);
+        CHECK(static_cast<uint8_t>(buffer[3]) == 0x12);
+
+        uint32_t              integer = 0;
+        LibMath::BinaryReader integerReader(buffer);
+        CHECK(integerReader.read(integer));
+        CHECK(integer == 0x12345678);
+
+        // Every type round trips exactly
+        std::vector<LibMath::Vector3>         vectors;
+        std::vector<LibMath::Vector4>         vectors4;
+        std::vector<LibMath::Quaternion>      rotations;
+        std::vector<LibMath::Matrix4>         matrices;
+        std::vector<LibMath::BoundingBox>     boxes;
+        std::vector<LibMath::TransformRecord> transforms;
+        std::vector<LibMath::Radian>          angles;
+
+        for (int i = 0; i < 37; i++)
+        {
+            vectors.push_back(random.nextVector(-1000.f, 1000.f));
+            vectors4.emplace_back(random.nextVector(-1.f, 1.f), random.next(-1.f, 1.f));
+            rotations.push_back(random.nextRotation());
+
+            LibMath::Matrix4 matrix;
+
+            for (size_t j = 0; j < matrix.getSize(); j++)
+                matrix.getArray()[j] = random.next(-10.f, 10.f);
+
+            matrices.push_back(matrix);
+            boxes.push_back({ random.nextVector(-10.f, 0.f), random.nextVector(0.f, 10.f) });
+            transforms.push_back({ random.nextVector(-100.f, 100.f), random.nextRotation(), random.nextVector(.5f, 2.f) });
+            angles.emplace_back(random.next(-4.f, 4.f));
+        }
+
+        checkRawRoundTrip(vectors);
+        checkRawRoundTrip(vectors4);
+        checkRawRoundTrip(rotations);
+        checkRawRoundTrip(matrices);
+        checkRawRoundTrip(boxes);
+        checkRawRoundTrip(transforms);
+        checkRawRoundTrip(angles);
+
+        // Matrices are stored row by row whatever their storage order
+        LibMath::TMatrix<2, 3, float, LibMath::EMatrixOrder::COLUMN_MAJOR> columnMajor;
+
+        for (LibMath::length_t row = 0; row < 2; row++)
+        {
+            for (LibMath::length_t column = 0; column < 3; column++)
+                columnMajor(row, column) = static_cast<float>(row * 3 + column);
+        }
+
+        std::byte             matrixBuffer[6 * sizeof(float)];
+        LibMath::BinaryWriter matrixWriter(matrixBuffer);
+        REQUIRE(matrixWriter.write(columnMajor));
+
+        LibMath::TMatrix<2, 3, float> rowMajor(0.f);
+        LibMath::BinaryReader         matrixReader(matrixBuffer);
+        REQUIRE(matrixReader.read(rowMajor));
+
+        for (size_t i = 0; i < rowMajor.getSize(); i++)
+            CHECK(rowMajor.getArray()[i] == static_cast<float>(i));
+    }
+
+    SECTION("Quantized")
+    {
+        std::vector<LibMath::TransformRecord> transforms;
+
+        for (int i = 0; i < 1000; i++)
+            transforms.push_back({ random.nextVector(-100.f, 100.f), random.nextRotation(), random.nextVector(.5f, 2.f) });
+
+        CHECK(LibMath::getBinarySize<LibMath::TransformRecord>(1, LibMath::EBinaryEncoding::QUANTIZED) == 20);
+
+        std::vector<std::byte> buffer(8 + LibMath::getBinarySize<LibMath::TransformRecord>(transforms.size(), LibMath::EBinaryEncoding::QUANTIZED));
+
+        LibMath::BinaryWriter writer(buffer, LibMath::EBinaryEncoding::QUANTIZED);
+        REQUIRE(writer.writeHeader());
+        REQUIRE(writer.writeArray<LibMath::TransformRecord>(transforms));
+        CHECK(writer.getWritten().size() == buffer.size());
+
+        std::vector<LibMath::TransformRecord> read(transforms.size());
+
+        LibMath::BinaryReader reader(buffer);
+        REQUIRE(reader.readHeader());
+        REQUIRE(reader.readArray<LibMath::TransformRecord>(read));
+
+        for (size_t i = 0; i < transforms.size(); i++)
+        {
+            // Halves keep 11 significant bits and rotations are stored as snorm16
+            const LibMath::Vector3 positionError = read[i].m_position - transforms[i].m_position;
+            CHECK(positionError.magnitude() <= transforms[i].m_position.magnitude() * .0005f);
+
+            const LibMath::Vector3 scaleError = read[i].m_scale - transforms[i].m_scale;
+            CHECK(scaleError.magnitude() <= .002f);
+
+            CHECK(std::abs(read[i].m_rotation.m_x - transforms[i].m_rotation.m_x) <= 1.6e-5f);
+            CHECK(std::abs(read[i].m_rotation.m_y - transforms[i].m_rotation.m_y) <= 1.6e-5f);
+            CHECK(std::abs(read[i].m_rotation.m_z - transforms[i].m_rotation.m_z) <= 1.6e-5f);
+            CHECK(std::abs(read[i].m_rotation.m_w - transforms[i].m_rotation.m_w) <= 1.6e-5f);
+        }
+
+        // Quantized values match the packed vector conversions
+        const LibMath::Vector3 vector(1.f / 3.f, -1000.f, 65504.f);
+        std::byte              vectorBuffer[6];
+
+        LibMath::BinaryWriter vectorWriter(vectorBuffer, LibMath::EBinaryEncoding::QUANTIZED);
+        REQUIRE(vectorWriter.write(vector));
+
+        LibMath::Vector3      readVector;
+        LibMath::BinaryReader vectorReader(vectorBuffer, LibMath::EBinaryEncoding::QUANTIZED);
+        REQUIRE(vectorReader.read(readVector));
+        CHECK(readVector.m_x == LibMath::halfToFloat(LibMath::floatToHalf(vector.m_x)));
+        CHECK(readVector.m_y == -1000.f);
+        CHECK(readVector.m_z == 65504.f);
+    }
+
+    SECTION("Bounds")
+    {
+        // Nothing is written or read past the buffer's end
+        std::byte buffer[40] = {};
+
+        LibMath::BinaryWriter writer(buffer);
+        CHECK(writer.write(LibMath::Vector3(1.f)));
+        CHECK(writer.write(LibMath::Vector3(2.f)));
+        CHECK(writer.write(LibMath::Vector3(3.f)));
+        CHECK_FALSE(writer.write(LibMath::Quaternion::identity()));
+        CHECK(writer.getOffset() == 36);
+        CHECK(buffer[36] == std::byte{ 0 });
+
+        LibMath::BinaryReader reader(std::span<const std::byte>(buffer, 36));
+
+        LibMath::Vector3 vectors[4];
+        CHECK_FALSE(reader.readArray<LibMath::Vector3>(vectors));
+        CHECK(reader.getOffset() == 0);
+        CHECK(vectors[0] == LibMath::Vector3::zero());
+
+        CHECK(reader.readArray(std::span(vectors, 3)));
+        CHECK(vectors[2] == LibMath::Vector3(3.f));
+
+        LibMath::Radian angle(1.f);
+        CHECK_FALSE(reader.read(angle));
+        CHECK(angle.raw() == 1.f);
+    }
+}
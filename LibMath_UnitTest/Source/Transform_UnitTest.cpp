@@ -383,6 +383,17 @@ TEST_CASE("Transform", "[.all][transform]")
                 const LibMath::Matrix4 mat = LibMath::Transform::generateMatrix(outPos, outRot, outScale);
                 CHECK(mat == matrix);
             }
+
+            // Column-major decomposition
+            {
+                LibMath::Vector3    outPos, outScale;
+                LibMath::Quaternion outRot;
+
+                LibMath::Transform::decomposeMatrix(LibMath::Matrix4ColumnMajor(matrix), outPos, outRot, outScale);
+                CHECK(outPos == position);
+                CHECK(outRot == rotation);
+                CHECK(outScale == scale);
+            }
         }
 
         SECTION("Direction")
@@ -0,0 +1,251 @@
+#include <Trigonometry.h>
+#include <TrigonometryBatch.h>
+#include <TrigTable.h>
+
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+TEST_CASE("Trigonometry benchmark", "[.benchmark][trigonometry]")
+{
+    using LibMath::EPrecision;
+
+    constexpr size_t size = 4096;
+
+    std::vector<float> angles(size);
+    std::vector<float> out(size);
+    std::vector<LibMath::SinCos> outSinCos(size);
+
+    for (size_t i = 0; i < size; i++)
+        angles[i] = (static_cast<float>(i) - static_cast<float>(size) * .5f) * .0173f;
+
+    // Accuracy report - max absolute error against the double precision standard library
+    for (const EPrecision precision : { EPrecision::FAST, EPrecision::BALANCED, EPrecision::PRECISE })
+    {
+        double maxSinError = 0, maxCosError = 0;
+
+        for (const float angle : angles)
+        {
+            const LibMath::SinCos sinCos = LibMath::sinCos(angle, precision);
+            maxSinError = std::max(maxSinError, std::abs(sinCos.m_sin - std::sin(static_cast<double>(angle))));
+            maxCosError = std::max(maxCosError, std::abs(sinCos.m_cos - std::cos(static_cast<double>(angle))));
+        }
+
+        const char* names[] = { "FAST", "BALANCED", "PRECISE" };
+
+        std::ostringstream report;
+        report << names[static_cast<int>(precision)] << " max error - sin: " << maxSinError << " cos: " << maxCosError;
+        WARN(report.str());
+    }
+
+    BENCHMARK("std::sin (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = std::sin(angles[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("sin(Radian) PRECISE (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::sin(LibMath::Radian(angles[i]));
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("sin(Radian) BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::sin(LibMath::Radian(angles[i]), EPrecision::BALANCED);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("sin(Radian) FAST (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::sin(LibMath::Radian(angles[i]), EPrecision::FAST);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("std::sin + std::cos (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outSinCos[i] = { std::sin(angles[i]), std::cos(angles[i]) };
+
+        return outSinCos[size - 1].m_sin;
+    };
+
+    BENCHMARK("sinCos PRECISE (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outSinCos[i] = LibMath::sinCos(angles[i], EPrecision::PRECISE);
+
+        return outSinCos[size - 1].m_sin;
+    };
+
+    BENCHMARK("sinCos BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outSinCos[i] = LibMath::sinCos(angles[i], EPrecision::BALANCED);
+
+        return outSinCos[size - 1].m_sin;
+    };
+
+    BENCHMARK("sinCos FAST (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outSinCos[i] = LibMath::sinCos(angles[i], EPrecision::FAST);
+
+        return outSinCos[size - 1].m_sin;
+    };
+
+    std::vector<float> cosines(size);
+
+    BENCHMARK("sin batch (4096)")
+    {
+        LibMath::sin(angles, out);
+        return out[size - 1];
+    };
+
+    BENCHMARK("sinCos batch (4096)")
+    {
+        LibMath::sinCos(angles, out, cosines);
+        return cosines[size - 1];
+    };
+
+    std::vector<float> ys(size);
+    std::vector<float> xs(size);
+    std::vector<LibMath::Radian> outAngles(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        ys[i] = std::sin(angles[i]) * static_cast<float>(i % 7 + 1);
+        xs[i] = std::cos(angles[i]) * static_cast<float>(i % 5 + 1);
+    }
+
+    BENCHMARK("std::atan2 (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outAngles[i] = LibMath::Radian(std::atan2(ys[i], xs[i]));
+
+        return outAngles[size - 1];
+    };
+
+    BENCHMARK("atan batch (4096)")
+    {
+        LibMath::atan(ys, xs, outAngles);
+        return outAngles[size - 1];
+    };
+
+    BENCHMARK("std::acos (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            outAngles[i] = LibMath::Radian(std::acos(cosines[i]));
+
+        return outAngles[size - 1];
+    };
+
+    BENCHMARK("acos batch (4096)")
+    {
+        LibMath::acos(cosines, outAngles);
+        return outAngles[size - 1];
+    };
+
+    BENCHMARK("tan(Radian) BALANCED (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = LibMath::tan(LibMath::Radian(angles[i]), EPrecision::BALANCED);
+
+        return out[size - 1];
+    };
+}
+
+TEST_CASE("Trigonometry table benchmark", "[.benchmark][trigonometry]")
+{
+    using LibMath::EPrecision;
+
+    // Close consecutive angles (e.g. oscillators) read neighbouring entries. Random ones read anywhere in the table and,
+    // with enough of them, make the large tables miss the caches
+    std::vector<float> sweepAngles(4096);
+    std::vector<float> randomAngles(1 << 18);
+    std::vector<LibMath::SinCos> out(randomAngles.size());
+
+    for (size_t i = 0; i < sweepAngles.size(); i++)
+        sweepAngles[i] = static_cast<float>(i) * .0013f;
+
+    uint32_t seed = 12345;
+
+    for (float& angle : randomAngles)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        angle = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 6.2831853f - 3.1415927f;
+    }
+
+    const auto& smallTable   = LibMath::TrigTable<256>::get();       // 1KB - always in the L1 cache
+    const auto& mediumTable  = LibMath::TrigTable<4096>::get();      // 16KB
+    const auto& largeTable   = LibMath::TrigTable<(1 << 20)>::get(); // 4MB
+    const auto& nearestTable = LibMath::TrigTable<4096, LibMath::ETableInterpolation::NEAREST>::get();
+
+    for (const auto& [name, angles] : { std::pair{ "sweep", &sweepAngles }, std::pair{ "random", &randomAngles } })
+    {
+        const size_t      size   = angles->size();
+        const std::string suffix = std::string(" - ") + name + " (" + std::to_string(size) + ")";
+
+        BENCHMARK("sinCos BALANCED" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = LibMath::sinCos((*angles)[i], EPrecision::BALANCED);
+
+            return out[size - 1].m_sin;
+        };
+
+        BENCHMARK("sinCos FAST" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = LibMath::sinCos((*angles)[i], EPrecision::FAST);
+
+            return out[size - 1].m_sin;
+        };
+
+        BENCHMARK("TrigTable<256>::sinCos" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = smallTable.sinCos((*angles)[i]);
+
+            return out[size - 1].m_sin;
+        };
+
+        BENCHMARK("TrigTable<4096>::sinCos" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = mediumTable.sinCos((*angles)[i]);
+
+            return out[size - 1].m_sin;
+        };
+
+        BENCHMARK("TrigTable<4096, NEAREST>::sinCos" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = nearestTable.sinCos((*angles)[i]);
+
+            return out[size - 1].m_sin;
+        };
+
+        BENCHMARK("TrigTable<2^20>::sinCos" + suffix)
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = largeTable.sinCos((*angles)[i]);
+
+            return out[size - 1].m_sin;
+        };
+    }
+}
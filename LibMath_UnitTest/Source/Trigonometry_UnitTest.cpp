@@ -1,4 +1,11 @@
 #include <Trigonometry.h>
+#include <TrigonometryBatch.h>
+#include <TrigTable.h>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
@@ -30,3 +37,288 @@ TEST_CASE("Trigonometry", "[.all][trigonometry]")
     CHECK(LibMath::atan(-1.f, 2.f).radian() == Catch::Approx(glm::atan(-1.f, 2.f)));
     CHECK(LibMath::atan(-1.f, -2.f).radian() == Catch::Approx(glm::atan(-1.f, -2.f)));
 }
+
+TEST_CASE("Trigonometry precision", "[.all][trigonometry]")
+{
+    using LibMath::EPrecision;
+
+    // Maximum absolute error of each precision over the full reduction range
+    const std::pair<EPrecision, double> precisions[] = {
+        { EPrecision::FAST, 1.5e-5 }, { EPrecision::BALANCED, 2e-7 }, { EPrecision::PRECISE, 1e-7 }
+    };
+
+    for (const auto& [precision, maxError] : precisions)
+    {
+        for (float angle = -8192.f; angle <= 8192.f; angle += 4.37f)
+        {
+            const LibMath::SinCos sinCos = LibMath::sinCos(LibMath::Radian(angle), precision);
+
+            CHECK(std::abs(sinCos.m_sin - std::sin(static_cast<double>(angle))) <= maxError);
+            CHECK(std::abs(sinCos.m_cos - std::cos(static_cast<double>(angle))) <= maxError);
+
+            // The single function versions match the fused one
+            CHECK(LibMath::sin(angle, precision) == sinCos.m_sin);
+            CHECK(LibMath::cos(angle, precision) == sinCos.m_cos);
+            CHECK(LibMath::sin(LibMath::Radian(angle), precision) == sinCos.m_sin);
+            CHECK(LibMath::cos(LibMath::Radian(angle), precision) == sinCos.m_cos);
+        }
+
+        CHECK(LibMath::tan(.5f, precision) == Catch::Approx(std::tan(.5f)).epsilon(maxError * 2));
+        CHECK(LibMath::tan(-2.5_rad, precision) == Catch::Approx(std::tan(-2.5f)).epsilon(maxError * 2));
+
+        // Out of range and non finite angles fall back to the standard library
+        CHECK(LibMath::sin(1e6f, precision) == std::sin(1e6f));
+        CHECK(std::isnan(LibMath::sinCos(std::numeric_limits<float>::infinity(), precision).m_cos));
+        CHECK(std::isnan(LibMath::sin(std::numeric_limits<float>::quiet_NaN(), precision)));
+    }
+
+    constexpr LibMath::SinCos sinCos = LibMath::sinCos(1.2_rad, EPrecision::FAST);
+    STATIC_CHECK(sinCos.m_sin == LibMath::sin(1.2_rad));
+    STATIC_CHECK(sinCos.m_cos == LibMath::cos(1.2_rad));
+    CHECK(sinCos.m_sin == Catch::Approx(std::sin(1.2f)));
+    CHECK(sinCos.m_cos == Catch::Approx(std::cos(1.2f)));
+}
+
+TEST_CASE("Trigonometry constant evaluation", "[.all][trigonometry]")
+{
+    STATIC_CHECK(LibMath::sin(0_rad) == 0.f);
+    STATIC_CHECK(LibMath::cos(0_rad) == 1.f);
+    STATIC_CHECK(LibMath::abs(LibMath::tan(45_deg) - 1.f) < 1e-6f);
+
+    STATIC_CHECK(LibMath::asin(1.f).raw() == LibMath::g_pi / 2.f);
+    STATIC_CHECK(LibMath::acos(-1.f).raw() == LibMath::g_pi);
+    STATIC_CHECK(LibMath::acos(1.f).raw() == 0.f);
+    STATIC_CHECK(LibMath::atan(0.f, -1.f).raw() == LibMath::g_pi);
+    STATIC_CHECK(LibMath::atan(-1.f, 0.f).raw() == -LibMath::g_pi / 2.f);
+    STATIC_CHECK(LibMath::atan(0.f, 0.f).raw() == 0.f);
+
+    constexpr float asinNaN = LibMath::asin(1.5f).raw();
+    STATIC_CHECK(asinNaN != asinNaN);
+
+    // Compile time lookup tables match the runtime functions
+    constexpr size_t size = 64;
+
+    struct Table
+    {
+        float m_sin[size], m_cos[size], m_asin[size], m_acos[size], m_atan[size], m_atan2[size];
+    };
+
+    constexpr Table table = []
+    {
+        Table result{};
+
+        for (size_t i = 0; i < size; i++)
+        {
+            const float value = -1.f + 2.f * static_cast<float>(i) / static_cast<float>(size - 1);
+
+            result.m_sin[i]   = LibMath::sin(LibMath::Radian(value * 7.f));
+            result.m_cos[i]   = LibMath::cos(LibMath::Radian(value * 7.f));
+            result.m_asin[i]  = LibMath::asin(value).raw();
+            result.m_acos[i]  = LibMath::acos(value).raw();
+            result.m_atan[i]  = LibMath::atan(value * 40.f).raw();
+            result.m_atan2[i] = LibMath::atan(value, .3f - value).raw();
+        }
+
+        return result;
+    }();
+
+    for (size_t i = 0; i < size; i++)
+    {
+        const float value = -1.f + 2.f * static_cast<float>(i) / static_cast<float>(size - 1);
+
+        CHECK(table.m_sin[i] == Catch::Approx(std::sin(value * 7.f)).margin(1e-7));
+        CHECK(table.m_cos[i] == Catch::Approx(std::cos(value * 7.f)).margin(1e-7));
+        CHECK(table.m_asin[i] == Catch::Approx(std::asin(value)).margin(1e-7));
+        CHECK(table.m_acos[i] == Catch::Approx(std::acos(value)).margin(1e-7));
+        CHECK(table.m_atan[i] == Catch::Approx(std::atan(value * 40.f)).margin(1e-7));
+        CHECK(table.m_atan2[i] == Catch::Approx(std::atan2(value, .3f - value)).margin(1e-7));
+    }
+}
+
+TEST_CASE("Trigonometry batch", "[.all][trigonometry]")
+{
+    // Distance to the exact result, in units of the result's last place
+    const auto ulpError = [](const float value, const double expected)
+    {
+        const float rounded = static_cast<float>(std::abs(expected));
+        const float ulp     = std::nextafter(rounded, std::numeric_limits<float>::infinity()) - rounded;
+        return std::abs(value - expected) / ulp;
+    };
+
+    SECTION("Sine and cosine")
+    {
+        // Odd size so the remaining elements go through the scalar path
+        std::vector<float> angles;
+
+        for (float angle = -8192.f; angle <= 8192.f; angle += .731f)
+            angles.push_back(angle);
+
+        for (float angle = -3.1416f; angle <= 3.1416f; angle += .0013f)
+            angles.push_back(angle);
+
+        angles.insert(angles.end(), { 0.f, 1e-20f, 1e6f, -3e7f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() });
+
+        std::vector<LibMath::Radian> radians(angles.size());
+
+        for (size_t i = 0; i < angles.size(); i++)
+            radians[i] = LibMath::Radian(angles[i]);
+
+        std::vector<float> sines(angles.size()), cosines(angles.size()), sinesOnly(angles.size()), cosinesOnly(angles.size());
+        LibMath::sinCos(angles, sines, cosines);
+        LibMath::sin(radians, sinesOnly);
+        LibMath::cos(radians, cosinesOnly);
+
+        for (size_t i = 0; i < angles.size(); i++)
+        {
+            const float angle = angles[i];
+
+            if (!std::isfinite(angle))
+            {
+                CHECK(std::isnan(sines[i]));
+                CHECK(std::isnan(cosines[i]));
+                continue;
+            }
+
+            if (std::abs(angle) <= 3.1416f)
+            {
+                CHECK(ulpError(sines[i], std::sin(static_cast<double>(angle))) <= 2.f);
+                CHECK(ulpError(cosines[i], std::cos(static_cast<double>(angle))) <= 2.f);
+            }
+            else if (std::abs(angle) <= 8192.f)
+            {
+                CHECK(std::abs(sines[i] - std::sin(static_cast<double>(angle))) <= 1.2e-7);
+                CHECK(std::abs(cosines[i] - std::cos(static_cast<double>(angle))) <= 1.2e-7);
+            }
+            else
+            {
+                CHECK(sines[i] == std::sin(angle));
+                CHECK(cosines[i] == std::cos(angle));
+            }
+
+            CHECK(sinesOnly[i] == sines[i]);
+            CHECK(cosinesOnly[i] == cosines[i]);
+        }
+
+        // In place, split across threads
+        std::vector<float> inPlace(angles.begin(), angles.end() - 2);
+        inPlace.resize(8 * 4096 + 3, 1.5f);
+        LibMath::sin(inPlace, inPlace, LibMath::EExecutionPolicy::PARALLEL);
+
+        // The thread ranges can move elements between the packet and scalar paths, which may round differently
+        for (size_t i = 0; i < angles.size() - 2; i++)
+            CHECK(std::abs(inPlace[i] - sines[i]) <= 1.2e-7f);
+
+        CHECK(std::abs(inPlace.back() - std::sin(1.5)) <= 1.2e-7);
+
+        // sin(-0) is -0 like std::sin, in the packets and in the remaining elements
+        const std::vector<float> negativeZeros(19, -0.f);
+        std::vector<float>       zeroSines(negativeZeros.size()), zeroCosines(negativeZeros.size());
+
+        LibMath::sinCos(negativeZeros, zeroSines, zeroCosines);
+
+        for (size_t i = 0; i < negativeZeros.size(); i++)
+        {
+            CHECK(zeroSines[i] == 0.f);
+            CHECK(std::signbit(zeroSines[i]));
+            CHECK(zeroCosines[i] == 1.f);
+        }
+
+        LibMath::sin(negativeZeros, zeroSines);
+
+        for (const float sine : zeroSines)
+            CHECK(std::signbit(sine));
+    }
+
+    SECTION("Inverse functions")
+    {
+        std::vector<float> values;
+
+        for (float value = -1.f; value <= 1.f; value += .00037f)
+            values.push_back(value);
+
+        values.insert(values.end(), { -1.f, 1.f, 0.f, 1.5f, std::numeric_limits<float>::quiet_NaN() });
+
+        std::vector<LibMath::Radian> arcSines(values.size()), arcCosines(values.size());
+        LibMath::asin(values, arcSines);
+        LibMath::acos(values, arcCosines);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            const float value = values[i];
+
+            if (!(std::abs(value) <= 1.f))
+            {
+                CHECK(std::isnan(arcSines[i].raw()));
+                CHECK(std::isnan(arcCosines[i].raw()));
+                continue;
+            }
+
+            CHECK(ulpError(arcSines[i].raw(), std::asin(static_cast<double>(value))) <= 3.f);
+            CHECK(ulpError(arcCosines[i].raw(), std::acos(static_cast<double>(value))) <= 2.f);
+        }
+
+        std::vector<float> ys, xs;
+
+        for (float angle = -3.1f; angle <= 3.1f; angle += .0071f)
+        {
+            for (const float length : { 1e-3f, .7f, 1.f, 250.f, 1e5f })
+            {
+                ys.push_back(length * std::sin(angle));
+                xs.push_back(length * std::cos(angle));
+            }
+        }
+
+        ys.insert(ys.end(), { 0.f, 0.f, 1.f, -1.f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() });
+        xs.insert(xs.end(), { 0.f, -1.f, 0.f, 0.f, 1.f, 1.f });
+
+        std::vector<LibMath::Radian> angles(ys.size());
+        LibMath::atan(ys, xs, angles);
+
+        for (size_t i = 0; i + 1 < ys.size(); i++)
+            CHECK(ulpError(angles[i].raw(), std::atan2(static_cast<double>(ys[i]), static_cast<double>(xs[i]))) <= 4.f);
+
+        CHECK(std::isnan(angles.back().raw()));
+    }
+}
+
+TEST_CASE("Trigonometry table", "[.all][trigonometry]")
+{
+    static constexpr LibMath::TrigTable<256> table;
+    STATIC_CHECK(table.sin(0_rad) == 0.f);
+    STATIC_CHECK(table.cos(0_rad) == 1.f);
+    STATIC_CHECK(table.sin(-90_deg) == -1.f);
+
+    // The shared table is built once, with the same entries as the compile time one
+    const LibMath::TrigTable<256>& shared = LibMath::TrigTable<256>::get();
+    CHECK(&shared == &LibMath::TrigTable<256>::get());
+
+    const LibMath::TrigTable<1024>&                                        precise = LibMath::TrigTable<1024>::get();
+    const LibMath::TrigTable<1024, LibMath::ETableInterpolation::NEAREST>& nearest =
+        LibMath::TrigTable<1024, LibMath::ETableInterpolation::NEAREST>::get();
+
+    for (float angle = -20.f; angle <= 20.f; angle += .0037f)
+    {
+        const double expectedSin = std::sin(static_cast<double>(angle));
+        const double expectedCos = std::cos(static_cast<double>(angle));
+
+        const LibMath::SinCos sinCos = table.sinCos(angle);
+        CHECK(std::abs(sinCos.m_sin - expectedSin) <= 7.6e-5);
+        CHECK(std::abs(sinCos.m_cos - expectedCos) <= 7.6e-5);
+        CHECK(table.sin(angle) == sinCos.m_sin);
+        CHECK(table.cos(LibMath::Radian(angle)) == sinCos.m_cos);
+        CHECK(shared.sin(angle) == sinCos.m_sin);
+
+        CHECK(std::abs(precise.sin(angle) - expectedSin) <= 5e-6);
+        CHECK(std::abs(precise.cos(angle) - expectedCos) <= 5e-6);
+
+        CHECK(std::abs(nearest.sin(angle) - expectedSin) <= 3.1e-3);
+        CHECK(std::abs(nearest.cos(angle) - expectedCos) <= 3.1e-3);
+    }
+
+    CHECK(table.sin(LibMath::Degree(30.f)) == Catch::Approx(.5f).margin(7.6e-5));
+    CHECK(table.cos(LibMath::Degree(-120.f)) == Catch::Approx(-.5f).margin(7.6e-5));
+
+    // Out of range and non finite angles fall back to the standard library
+    CHECK(table.sin(1e6f) == std::sin(1e6f));
+    CHECK(std::isnan(table.sinCos(std::numeric_limits<float>::quiet_NaN()).m_cos));
+}
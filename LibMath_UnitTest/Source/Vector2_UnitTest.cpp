@@ -429,6 +429,12 @@ TEST_CASE("Vector2", "[.all][vector][Vector2]")
 
             CHECK_VECTOR2(normalize, normalizeGlm);
             CHECK_VECTOR2(normalized, normalizeGlm);
+
+            // The squared magnitude of tiny vectors is subnormal
+            const LibMath::Vector2 tiny = LibMath::Vector2(0.f, -1e-20f).normalized();
+
+            CHECK(tiny.m_x == 0.f);
+            CHECK(tiny.m_y == Catch::Approx(-1.f));
         }
 
         SECTION("ProjectOnto")
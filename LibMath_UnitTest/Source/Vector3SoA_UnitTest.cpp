@@ -0,0 +1,161 @@
+#include <Vector/Vector3SoA.h>
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#define CHECK_VECTOR3(vector, expected) CHECK((vector).m_x == Catch::Approx((expected).m_x)); CHECK((vector).m_y == Catch::Approx((expected).m_y)); CHECK((vector).m_z == Catch::Approx((expected).m_z))
+
+TEMPLATE_TEST_CASE("Vector3SoA", "[.all][vector][Vector3SoA]", LibMath::Vector3SoA, LibMath::Vector3AoSoA)
+{
+    // Not a multiple of the SIMD width nor of the block size to cover the remainders
+    constexpr size_t size = 37;
+
+    std::vector<LibMath::Vector3> left(size);
+    std::vector<LibMath::Vector3> right(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        left[i]  = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f };
+        right[i] = { static_cast<float>(i % 3) + 1.f, -static_cast<float>(i % 11) * .75f, 2.f - static_cast<float>(i % 4) };
+    }
+
+    const TestType leftStream(left);
+    const TestType rightStream(right);
+
+    SECTION("Instantiation")
+    {
+        CHECK(leftStream.size() == size);
+        CHECK_FALSE(leftStream.empty());
+        CHECK(TestType().empty());
+
+        std::vector<LibMath::Vector3> copy(size);
+        leftStream.copyTo(copy);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK(leftStream.get(i) == left[i]);
+            CHECK(copy[i] == left[i]);
+        }
+
+        TestType stream(3);
+        CHECK(stream.get(2) == LibMath::Vector3::zero());
+
+        stream.set(1, LibMath::Vector3(1.f, 2.f, 3.f));
+        stream.pushBack(LibMath::Vector3(4.f, 5.f, 6.f));
+        CHECK(stream.size() == 4);
+        CHECK(stream.get(1) == LibMath::Vector3(1.f, 2.f, 3.f));
+        CHECK(stream.get(3) == LibMath::Vector3(4.f, 5.f, 6.f));
+
+        // Shrinking then growing again only adds zero vectors
+        stream.resize(2);
+        stream.resize(4);
+        CHECK(stream.get(1) == LibMath::Vector3(1.f, 2.f, 3.f));
+        CHECK(stream.get(3) == LibMath::Vector3::zero());
+
+        stream.assign(right);
+        CHECK(stream.size() == size);
+        CHECK(stream.get(size - 1) == right[size - 1]);
+    }
+
+    SECTION("Arithmetic")
+    {
+        TestType out;
+
+        LibMath::add(leftStream, rightStream, out);
+        REQUIRE(out.size() == size);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == left[i] + right[i]);
+
+        LibMath::subtract(leftStream, rightStream, out);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == left[i] - right[i]);
+
+        LibMath::scale(leftStream, -2.5f, out);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == left[i] * -2.5f);
+
+        // In place and mixed layouts
+        out = leftStream;
+        LibMath::add(out, LibMath::Vector3SoA(right), out);
+        LibMath::scale(out, .5f, out);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == (left[i] + right[i]) * .5f);
+    }
+
+    SECTION("Functionality")
+    {
+        TestType           out;
+        std::vector<float> scalars(size);
+
+        LibMath::dot(leftStream, rightStream, scalars);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(scalars[i] == Catch::Approx(left[i].dot(right[i])));
+
+        LibMath::cross(leftStream, rightStream, out);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK_VECTOR3(out.get(i), left[i].cross(right[i]));
+        }
+
+        LibMath::magnitude(rightStream, scalars);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(scalars[i] == Catch::Approx(right[i].magnitude()));
+
+        LibMath::normalize(rightStream, out);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK_VECTOR3(out.get(i), right[i].normalized());
+        }
+
+        // The squared magnitude of tiny vectors is subnormal
+        std::vector<LibMath::Vector3> tiny(size);
+
+        for (size_t i = 0; i < size; i++)
+            tiny[i] = right[i] * 1e-20f;
+
+        LibMath::normalize(TestType(tiny), out);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK_VECTOR3(out.get(i), right[i].normalized());
+        }
+
+        LibMath::distance(leftStream, rightStream, scalars);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(scalars[i] == Catch::Approx(left[i].distanceFrom(right[i])));
+
+        LibMath::lerp(leftStream, rightStream, .25f, out);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            CHECK_VECTOR3(out.get(i), LibMath::lerp(left[i], right[i], .25f));
+        }
+
+        LibMath::min(leftStream, rightStream, out);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == LibMath::min(left[i], right[i]));
+
+        LibMath::max(leftStream, rightStream, out);
+
+        for (size_t i = 0; i < size; i++)
+            CHECK(out.get(i) == LibMath::max(left[i], right[i]));
+
+        // Cross product in place
+        out = leftStream;
+        LibMath::cross(out, rightStream, out);
+        CHECK_VECTOR3(out.get(size - 1), left[size - 1].cross(right[size - 1]));
+    }
+}
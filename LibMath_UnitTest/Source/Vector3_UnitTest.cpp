@@ -490,6 +490,13 @@ TEST_CASE("Vector3", "[.all][vector][Vector3]")
 
             CHECK_VECTOR3(normalize, normalizeGlm);
             CHECK_VECTOR3(normalized, normalizeGlm);
+
+            // The squared magnitude of tiny vectors is subnormal
+            const LibMath::Vector3 tiny = LibMath::Vector3(1e-20f, 0.f, -1e-20f).normalized();
+
+            CHECK(tiny.m_x == Catch::Approx(.70710678f));
+            CHECK(tiny.m_y == 0.f);
+            CHECK(tiny.m_z == Catch::Approx(-.70710678f));
         }
 
         SECTION("ProjectOnto")
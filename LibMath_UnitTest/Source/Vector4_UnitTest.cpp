@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include <Vector/Vector4.h>
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -55,6 +57,33 @@ TEST_CASE("Vector4", "[.all][vector][Vector4]")
         CHECK_VECTOR4(empty, emptyGlm);
 
         STATIC_CHECK(sizeof(LibMath::Vector4) == sizeof(glm::vec4));
+
+        // layout
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Vector4>);
+        STATIC_CHECK(std::is_standard_layout_v<LibMath::Vector4>);
+
+        LibMath::Vector4 copies[2];
+        std::memcpy(copies, &allParam, sizeof(LibMath::Vector4));
+        std::memcpy(copies + 1, &allParam, sizeof(LibMath::Vector4));
+        CHECK_VECTOR4(copies[1], allParamGlm);
+
+        // aligned variant
+        STATIC_CHECK(alignof(LibMath::Vector4A) == 16);
+        STATIC_CHECK(sizeof(LibMath::Vector4A) == sizeof(LibMath::Vector4));
+        STATIC_CHECK(std::is_trivially_copyable_v<LibMath::Vector4A>);
+        STATIC_CHECK(std::is_standard_layout_v<LibMath::Vector4A>);
+
+        constexpr LibMath::Vector4A aligned{ 2.5f, .5f, 2.f, 1.f };
+        CHECK_VECTOR4(aligned, allParamGlm);
+
+        LibMath::Vector4A alignedSum = aligned + aligned;
+        CHECK_VECTOR4(alignedSum, allParamGlm + allParamGlm);
+
+        alignedSum = allParam * 2.f;
+        CHECK_VECTOR4(alignedSum, allParamGlm * 2.f);
+
+        const LibMath::Vector4 unaligned = alignedSum;
+        CHECK_VECTOR4(unaligned, allParamGlm * 2.f);
     }
 
     SECTION("Accessor")
@@ -473,6 +502,14 @@ TEST_CASE("Vector4", "[.all][vector][Vector4]")
 
             CHECK_VECTOR4(normalize, normalizeGlm);
             CHECK_VECTOR4(normalized, normalizeGlm);
+
+            // The squared magnitude of tiny vectors is subnormal
+            const LibMath::Vector4 tiny = LibMath::Vector4(1e-20f, 0.f, 0.f, 0.f).normalized();
+
+            CHECK(tiny.m_x == Catch::Approx(1.f));
+            CHECK(tiny.m_y == 0.f);
+            CHECK(tiny.m_z == 0.f);
+            CHECK(tiny.m_w == 0.f);
         }
     }
 
@@ -502,6 +539,49 @@ TEST_CASE("Vector4", "[.all][vector][Vector4]")
         }
     }
 
+    SECTION("Simd")
+    {
+        STATIC_CHECK(alignof(LibMath::Vector4) == 16);
+        STATIC_CHECK(sizeof(LibMath::Vector4) == 4 * sizeof(float));
+
+        // Runtime operations (SIMD when available) should match the constant evaluated ones (always scalar)
+        constexpr LibMath::Vector4 left{ 2.5f, -.5f, 2.f, 1.f };
+        constexpr LibMath::Vector4 right{ -1.25f, 3.f, .75f, -4.f };
+
+        LibMath::Vector4 runtimeLeft = left;
+
+        constexpr LibMath::Vector4 sum = left + right;
+        CHECK(runtimeLeft + right == sum);
+
+        constexpr LibMath::Vector4 difference = left - right;
+        CHECK(runtimeLeft - right == difference);
+
+        constexpr LibMath::Vector4 product = left * right;
+        CHECK(runtimeLeft * right == product);
+
+        constexpr LibMath::Vector4 quotient = left / right;
+        CHECK(runtimeLeft / right == quotient);
+
+        constexpr LibMath::Vector4 scaled = (left + 1) * 2.5f / 2 - 3.0;
+        CHECK((runtimeLeft + 1) * 2.5f / 2 - 3.0 == scaled);
+
+        constexpr float dot = left.dot(right);
+        CHECK(runtimeLeft.dot(right) == dot);
+
+        constexpr float magnitudeSquared = left.magnitudeSquared();
+        CHECK(runtimeLeft.magnitudeSquared() == magnitudeSquared);
+
+        constexpr float distanceSquared = left.distanceSquaredFrom(right);
+        CHECK(runtimeLeft.distanceSquaredFrom(right) == distanceSquared);
+
+        constexpr LibMath::Vector4 normalized = left.normalized();
+        CHECK(runtimeLeft.normalized() == normalized);
+
+        runtimeLeft.normalize();
+        CHECK(runtimeLeft == normalized);
+        CHECK(runtimeLeft.isUnitVector());
+    }
+
     SECTION("Debug")
     {
 #if defined(_DEBUG) || defined(DEBUG) || !defined(NDEBUG)
@@ -0,0 +1,370 @@
+#include <Format.h>
+#include <Packet.h>
+#include <Serialization.h>
+#include <Quaternion.h>
+#include <QuaternionBatch.h>
+
+#include <Vector/Vector2.h>
+#include <Vector/Vector3.h>
+#include <Vector/Vector4.h>
+#include <Vector/Vector3SoA.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace
+{
+    template <class VectorT>
+    void benchmarkVectorArithmetic(const char* name)
+    {
+        constexpr size_t size = 4096;
+
+        using T = typename LibMath::Details::VectorTraits<VectorT>::value_type;
+
+        std::vector<VectorT> left(size);
+        std::vector<VectorT> right(size);
+        std::vector<VectorT> out(size);
+        std::vector<T>       scalars(size);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            left[i]  = VectorT(static_cast<T>(i % 7) - static_cast<T>(3));
+            right[i] = VectorT(static_cast<T>(i % 5) + static_cast<T>(1));
+            left[i].m_x += static_cast<T>(i % 3);
+            right[i].m_y -= static_cast<T>(i % 11);
+        }
+
+        const std::string prefix(name);
+
+        BENCHMARK(prefix + " multiply-add loop (4096)")
+        {
+            for (size_t i = 0; i < size; i++)
+                out[i] = left[i] + right[i] * static_cast<T>(2) - left[i] / right[i];
+
+            return out[size - 1];
+        };
+
+        BENCHMARK(prefix + "::dot loop (4096)")
+        {
+            for (size_t i = 0; i < size; i++)
+                scalars[i] = left[i].dot(right[i]);
+
+            return scalars[size - 1];
+        };
+
+        BENCHMARK(prefix + "::distanceSquaredFrom loop (4096)")
+        {
+            for (size_t i = 0; i < size; i++)
+                scalars[i] = left[i].distanceSquaredFrom(right[i]);
+
+            return scalars[size - 1];
+        };
+
+        BENCHMARK(prefix + " == loop (4096)")
+        {
+            size_t equalCount = 0;
+
+            for (size_t i = 0; i < size; i++)
+                equalCount += left[i] == right[i];
+
+            return equalCount;
+        };
+    }
+}
+
+TEST_CASE("Vector arithmetic benchmark", "[.benchmark][vector]")
+{
+    // Vector2, Vector3 and the double vectors go through the generic (scalar) TVector operations
+    benchmarkVectorArithmetic<LibMath::Vector2>("Vector2");
+    benchmarkVectorArithmetic<LibMath::Vector3>("Vector3");
+    benchmarkVectorArithmetic<LibMath::Vector4>("Vector4");
+    benchmarkVectorArithmetic<LibMath::Vector3D>("Vector3D");
+    benchmarkVectorArithmetic<LibMath::Vector4D>("Vector4D");
+}
+
+TEST_CASE("Vector3SoA benchmark", "[.benchmark][vector][Vector3SoA]")
+{
+    constexpr size_t size = 4096;
+
+    std::vector<LibMath::Vector3> left(size);
+    std::vector<LibMath::Vector3> right(size);
+    std::vector<LibMath::Vector3> out(size);
+    std::vector<float>            scalars(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        left[i]  = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f };
+        right[i] = { static_cast<float>(i % 3) + 1.f, -static_cast<float>(i % 11) * .75f, 2.f - static_cast<float>(i % 4) };
+    }
+
+    const LibMath::Vector3SoA   leftSoA(left);
+    const LibMath::Vector3SoA   rightSoA(right);
+    const LibMath::Vector3AoSoA leftAoSoA(left);
+    const LibMath::Vector3AoSoA rightAoSoA(right);
+    LibMath::Vector3SoA         outSoA(size);
+    LibMath::Vector3AoSoA       outAoSoA(size);
+
+    BENCHMARK("Vector3::dot loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            scalars[i] = left[i].dot(right[i]);
+
+        return scalars[size - 1];
+    };
+
+    BENCHMARK("dot(Vector3SoA) (4096)")
+    {
+        LibMath::dot(leftSoA, rightSoA, scalars);
+        return scalars[size - 1];
+    };
+
+    BENCHMARK("dot(Vector3AoSoA) (4096)")
+    {
+        LibMath::dot(leftAoSoA, rightAoSoA, scalars);
+        return scalars[size - 1];
+    };
+
+    BENCHMARK("Vector3::cross loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = left[i].cross(right[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("cross(Vector3SoA) (4096)")
+    {
+        LibMath::cross(leftSoA, rightSoA, outSoA);
+        return outSoA.getX()[size - 1];
+    };
+
+    BENCHMARK("Vector3::normalized loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = right[i].normalized();
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("normalize(Vector3SoA) (4096)")
+    {
+        LibMath::normalize(rightSoA, outSoA);
+        return outSoA.getX()[size - 1];
+    };
+
+    BENCHMARK("normalize(Vector3AoSoA) (4096)")
+    {
+        LibMath::normalize(rightAoSoA, outAoSoA);
+        return outAoSoA.getX()[size - 1];
+    };
+
+    BENCHMARK("Vector3SoA(span) (4096)")
+    {
+        return LibMath::Vector3SoA(left);
+    };
+}
+
+TEST_CASE("Quaternion rotation benchmark", "[.benchmark][quaternion]")
+{
+    constexpr size_t size = 4096;
+
+    const LibMath::Quaternion rotation(LibMath::Radian(.75f), LibMath::Vector3(1.f, 2.f, -.5f));
+
+    std::vector<LibMath::Vector3> vectors(size);
+    std::vector<LibMath::Vector3> out(size);
+
+    for (size_t i = 0; i < size; i++)
+        vectors[i] = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f };
+
+    BENCHMARK("q * v * q^-1 loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = rotation * LibMath::Quaternion(0.f, vectors[i]) * rotation.inverse();
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("Quaternion::rotate loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = rotation.rotate(vectors[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("rotateVectors (4096)")
+    {
+        LibMath::rotateVectors(rotation, vectors, out);
+        return out[size - 1];
+    };
+}
+
+TEST_CASE("Packet benchmark", "[.benchmark][vector][quaternion][packet]")
+{
+    constexpr size_t size = 4096;
+
+    using Vector3P = LibMath::TVector3<LibMath::Float8>;
+    using QuaternionP = LibMath::TQuaternion<LibMath::Float8>;
+
+    constexpr size_t packetCount = size / LibMath::Float8::SIZE;
+
+    const LibMath::Quaternion rotation(LibMath::Radian(.75f), LibMath::Vector3(1.f, 2.f, -.5f));
+    const QuaternionP         rotationP(rotation.m_w, rotation.m_x, rotation.m_y, rotation.m_z);
+
+    std::vector<LibMath::Vector3> vectors(size);
+    std::vector<LibMath::Vector3> out(size);
+    std::vector<Vector3P>         vectorsP(packetCount);
+    std::vector<Vector3P>         outP(packetCount);
+
+    for (size_t i = 0; i < size; i++)
+        vectors[i] = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f + .1f };
+
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        float x[LibMath::Float8::SIZE], y[LibMath::Float8::SIZE], z[LibMath::Float8::SIZE];
+
+        for (size_t lane = 0; lane < LibMath::Float8::SIZE; lane++)
+        {
+            const LibMath::Vector3& vector = vectors[i * LibMath::Float8::SIZE + lane];
+            x[lane] = vector.m_x;
+            y[lane] = vector.m_y;
+            z[lane] = vector.m_z;
+        }
+
+        vectorsP[i] = { LibMath::Float8::load(x), LibMath::Float8::load(y), LibMath::Float8::load(z) };
+    }
+
+    BENCHMARK("Vector3::normalized loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = vectors[i].normalized();
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("TVector3<Float8>::normalized loop (4096)")
+    {
+        for (size_t i = 0; i < packetCount; i++)
+            outP[i] = vectorsP[i].normalized();
+
+        return outP[packetCount - 1].m_x[0];
+    };
+
+    BENCHMARK("Quaternion::rotate loop (4096)")
+    {
+        for (size_t i = 0; i < size; i++)
+            out[i] = rotation.rotate(vectors[i]);
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("TQuaternion<Float8>::rotate loop (4096)")
+    {
+        for (size_t i = 0; i < packetCount; i++)
+            outP[i] = rotationP.rotate(vectorsP[i]);
+
+        return outP[packetCount - 1].m_x[0];
+    };
+}
+
+TEST_CASE("Vector text conversion benchmark", "[.benchmark][vector][Format]")
+{
+    constexpr size_t size = 4096;
+
+    std::vector<LibMath::Vector3> vectors(size);
+    std::vector<LibMath::Vector3> out(size);
+
+    for (size_t i = 0; i < size; i++)
+        vectors[i] = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f };
+
+    std::vector<char> buffer(size * 3 * LibMath::Details::MAX_COMPONENT_CHARS);
+
+    const std::to_chars_result written = LibMath::formatArray<LibMath::Vector3>(buffer.data(), buffer.data() + buffer.size(), vectors);
+    const std::string          text(buffer.data(), written.ptr);
+
+    BENCHMARK("operator<< (4096)")
+    {
+        std::ostringstream stream;
+
+        for (const LibMath::Vector3& vector : vectors)
+            stream << vector << '\n';
+
+        return stream.str().size();
+    };
+
+    BENCHMARK("formatArray (4096)")
+    {
+        return LibMath::formatArray<LibMath::Vector3>(buffer.data(), buffer.data() + buffer.size(), vectors).ptr;
+    };
+
+    BENCHMARK("operator>> (4096)")
+    {
+        std::istringstream stream(text);
+
+        for (LibMath::Vector3& vector : out)
+            stream >> vector;
+
+        return out[size - 1];
+    };
+
+    BENCHMARK("parseArray (4096)")
+    {
+        return LibMath::parseArray<LibMath::Vector3>(text, out).count;
+    };
+}
+
+TEST_CASE("Serialization benchmark", "[.benchmark][Serialization]")
+{
+    constexpr size_t size = 4096;
+
+    std::vector<LibMath::Vector3>         vectors(size);
+    std::vector<LibMath::TransformRecord> transforms(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        vectors[i]    = { static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) * .5f + .25f, static_cast<float>(i) * .1f };
+        transforms[i] = { vectors[i], LibMath::Quaternion(LibMath::Radian(static_cast<float>(i) * .01f), LibMath::Vector3::up()), LibMath::Vector3(2.f) };
+    }
+
+    std::vector<std::byte> buffer(LibMath::getBinarySize<LibMath::TransformRecord>(size));
+
+    BENCHMARK("Raw Vector3 write (4096)")
+    {
+        LibMath::BinaryWriter writer(buffer);
+        return writer.writeArray<LibMath::Vector3>(vectors);
+    };
+
+    BENCHMARK("Raw Vector3 read (4096)")
+    {
+        LibMath::BinaryReader reader(buffer);
+        return reader.readArray<LibMath::Vector3>(vectors);
+    };
+
+    BENCHMARK("Raw TransformRecord write (4096)")
+    {
+        LibMath::BinaryWriter writer(buffer);
+        return writer.writeArray<LibMath::TransformRecord>(transforms);
+    };
+
+    BENCHMARK("Raw TransformRecord read (4096)")
+    {
+        LibMath::BinaryReader reader(buffer);
+        return reader.readArray<LibMath::TransformRecord>(transforms);
+    };
+
+    BENCHMARK("Quantized TransformRecord write (4096)")
+    {
+        LibMath::BinaryWriter writer(buffer, LibMath::EBinaryEncoding::QUANTIZED);
+        return writer.writeArray<LibMath::TransformRecord>(transforms);
+    };
+
+    BENCHMARK("Quantized TransformRecord read (4096)")
+    {
+        LibMath::BinaryReader reader(buffer, LibMath::EBinaryEncoding::QUANTIZED);
+        return reader.readArray<LibMath::TransformRecord>(transforms);
+    };
+}